@@ -0,0 +1,141 @@
+//{{{
+// drawReplay - replay a cDrawCapture file into a backend in a tight loop, report throughput
+//   drawReplay capture.imdc [gl3|soft] [loops]
+//   gl3  - imgui_impl_opengl3, hidden glfw window
+//   soft - imgui_impl_softraster, RGBA framebuffer in memory
+//}}}
+//{{{  includes
+#include "imgui.h"
+#include "imgui_impl_opengl3.h"
+#include "imgui_impl_softraster.h"
+#include "utils/cDrawCapture.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <GLFW/glfw3.h> // Will drag system OpenGL headers
+//}}}
+
+//{{{
+static void glfw_error_callback(int error, const char* description) {
+  fprintf(stderr, "Glfw Error %d: %s\n", error, description);
+  }
+//}}}
+
+int main (int argc, char** argv) {
+
+  if (argc < 2) {
+    printf ("drawReplay capture.imdc [gl3|soft] [loops]\n");
+    return 1;
+    }
+  std::string backend = (argc > 2) ? argv[2] : "gl3";
+  int loops = (argc > 3) ? atoi (argv[3]) : 10;
+  bool gl3 = (backend == "gl3");
+  if (!gl3 && (backend != "soft")) {
+    printf ("unknown backend %s\n", backend.c_str());
+    return 1;
+    }
+
+  IMGUI_CHECKVERSION();
+  ImGui::CreateContext();
+  ImGuiIO& io = ImGui::GetIO();
+  io.IniFilename = nullptr;
+
+  // decode whole capture up front, only backend work is timed
+  cDrawCaptureReader reader;
+  if (!reader.load (argv[1]) || !reader.getNumFrames()) {
+    printf ("drawReplay %s\n", reader.getError().empty() ? "no frames" : reader.getError().c_str());
+    return 1;
+    }
+
+  ImDrawData* firstFrame = reader.getFrame (0);
+  int width = (int)(firstFrame->DisplaySize.x * firstFrame->FramebufferScale.x);
+  int height = (int)(firstFrame->DisplaySize.y * firstFrame->FramebufferScale.y);
+  io.DisplaySize = firstFrame->DisplaySize;
+
+  uint64_t vertices = 0;
+  uint64_t indices = 0;
+  for (size_t i = 0; i < reader.getNumFrames(); i++) {
+    vertices += reader.getFrame (i)->TotalVtxCount;
+    indices += reader.getFrame (i)->TotalIdxCount;
+    }
+  printf ("drawReplay %s %zu frames %dx%d, %.1f vertices %.1f indices per frame, %s %d loops\n",
+          argv[1], reader.getNumFrames(), width, height,
+          (double)vertices / reader.getNumFrames(), (double)indices / reader.getNumFrames(), backend.c_str(), loops);
+
+  // captured atlas becomes our atlas, backends upload it from GetTexDataAsRGBA32
+  if (reader.getAtlasWidth()) {
+    size_t atlasBytes = reader.getAtlasPixels().size() * 4;
+    io.Fonts->TexPixelsRGBA32 = (unsigned int*)IM_ALLOC (atlasBytes);
+    memcpy (io.Fonts->TexPixelsRGBA32, reader.getAtlasPixels().data(), atlasBytes);
+    io.Fonts->TexWidth = reader.getAtlasWidth();
+    io.Fonts->TexHeight = reader.getAtlasHeight();
+    }
+
+  GLFWwindow* window = nullptr;
+  std::vector<unsigned int> pixels;
+  if (gl3) {
+    //{{{  hidden glfw window, GL 3.0 + GLSL 130
+    glfwSetErrorCallback (glfw_error_callback);
+    if (!glfwInit())
+      return 1;
+
+    glfwWindowHint (GLFW_CONTEXT_VERSION_MAJOR, 3);
+    glfwWindowHint (GLFW_CONTEXT_VERSION_MINOR, 0);
+    glfwWindowHint (GLFW_VISIBLE, GLFW_FALSE);
+    window = glfwCreateWindow (width, height, "drawReplay", NULL, NULL);
+    if (window == NULL)
+      return 1;
+    glfwMakeContextCurrent (window);
+    glfwSwapInterval (0);
+
+    ImGui_ImplOpenGL3_Init ("#version 130");
+    ImGui_ImplOpenGL3_NewFrame();
+    //}}}
+    }
+  else {
+    ImGui_ImplSoftRaster_Init();
+    ImGui_ImplSoftRaster_NewFrame();
+    pixels.resize (width * height);
+    }
+  reader.setTextureId (io.Fonts->TexID);
+
+  auto start = std::chrono::steady_clock::now();
+  for (int loop = 0; loop < loops; loop++) {
+    for (size_t i = 0; i < reader.getNumFrames(); i++) {
+      if (gl3) {
+        glViewport (0, 0, width, height);
+        glClearColor (0.45f, 0.55f, 0.60f, 1.00f);
+        glClear (GL_COLOR_BUFFER_BIT);
+        ImGui_ImplOpenGL3_RenderDrawData (reader.getFrame (i));
+        }
+      else {
+        std::fill (pixels.begin(), pixels.end(), IM_COL32(115, 140, 153, 255));
+        ImGui_ImplSoftRaster_RenderDrawData (reader.getFrame (i), pixels.data(), width, height, width);
+        }
+      }
+    }
+  if (gl3)
+    glFinish();
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  double frames = (double)reader.getNumFrames() * loops;
+  printf ("%.3f ms/frame %.1f frames/s %.2f Mvertices/s\n",
+          seconds * 1000.0 / frames, frames / seconds, (double)vertices * loops / seconds / 1000000.0);
+
+  // Cleanup
+  if (gl3) {
+    ImGui_ImplOpenGL3_Shutdown();
+    glfwDestroyWindow (window);
+    glfwTerminate();
+    }
+  else
+    ImGui_ImplSoftRaster_Shutdown();
+
+  reader.clear();
+  ImGui::DestroyContext();
+  return 0;
+  }
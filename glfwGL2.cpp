@@ -12,6 +12,7 @@
 #include "imgui.h"
 #include "imgui_impl_glfw.h"
 #include "imgui_impl_opengl2.h"
+#include "utils/cIdleLoop.h"
 
 #include <stdio.h>
 
@@ -30,6 +31,12 @@ static void glfw_error_callback(int error, const char* description) {
   fprintf(stderr, "Glfw Error %d: %s\n", error, description);
   }
 //}}}
+//{{{
+static void glfw_refresh_callback (GLFWwindow* window) {
+// window exposed or uncovered, its contents may be lost, render even if the frame is unchanged
+  ((cIdleLoop*)glfwGetWindowUserPointer (window))->forceRender();
+  }
+//}}}
 
 int main(int, char**) {
 
@@ -80,6 +87,12 @@ int main(int, char**) {
   bool show_another_window = false;
   ImVec4 clear_color = ImVec4(0.45f, 0.55f, 0.60f, 1.00f);
 
+  // block on events when idle, skip render + swap when frame unchanged
+  cIdleLoop idleLoop;
+  idleLoop.setWakeFunc (glfwPostEmptyEvent);
+  glfwSetWindowUserPointer (window, &idleLoop);
+  glfwSetWindowRefreshCallback (window, glfw_refresh_callback);
+
   while (!glfwWindowShouldClose(window)) {
      //{{{  main loop
       // Poll and handle events (inputs, window resize, etc.)
@@ -87,7 +100,7 @@ int main(int, char**) {
       // - When io.WantCaptureMouse is true, do not dispatch mouse input data to your main application.
       // - When io.WantCaptureKeyboard is true, do not dispatch keyboard input data to your main application.
       // Generally you may always pass all inputs to dear imgui, and hide them from your application based on those two flags.
-      glfwPollEvents();
+      idleLoop.waitEvents (glfwPollEvents, glfwWaitEventsTimeout);
 
       // Start the Dear ImGui frame
       ImGui_ImplOpenGL2_NewFrame();
@@ -117,7 +130,15 @@ int main(int, char**) {
           ImGui::SameLine();
           ImGui::Text("counter = %d", counter);
 
-          ImGui::Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / ImGui::GetIO().Framerate, ImGui::GetIO().Framerate);
+          // idle loop only renders when the frame changes, a per frame fps readout would change every frame
+          bool idle = idleLoop.getEnabled();
+          if (ImGui::Checkbox("idle loop", &idle))
+              idleLoop.setEnabled (idle);
+          if (ImGui::IsItemHovered())
+              ImGui::SetTooltip("frames:%llu renders:%llu waits:%llu %.1fs", (unsigned long long)idleLoop.getFrames(), (unsigned long long)idleLoop.getRenders(),
+                                (unsigned long long)idleLoop.getWaits(), idleLoop.getWaitSeconds());
+          if (!idle)
+              ImGui::Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / ImGui::GetIO().Framerate, ImGui::GetIO().Framerate);
           ImGui::End();
       }
 
@@ -133,18 +154,22 @@ int main(int, char**) {
 
       // Rendering
       ImGui::Render();
-      int display_w, display_h;
-      glfwGetFramebufferSize(window, &display_w, &display_h);
-      glViewport(0, 0, display_w, display_h);
-      glClearColor(clear_color.x * clear_color.w, clear_color.y * clear_color.w, clear_color.z * clear_color.w, clear_color.w);
-      glClear(GL_COLOR_BUFFER_BIT);
+      bool render = idleLoop.isDrawDataChanged();
+      if (render) {
+        int display_w, display_h;
+        glfwGetFramebufferSize(window, &display_w, &display_h);
+        glViewport(0, 0, display_w, display_h);
+        glClearColor(clear_color.x * clear_color.w, clear_color.y * clear_color.w, clear_color.z * clear_color.w, clear_color.w);
+        glClear(GL_COLOR_BUFFER_BIT);
+        }
 
       // If you are using this code with non-legacy OpenGL header/contexts (which you should not, prefer using imgui_impl_opengl3.cpp!!),
       // you may need to backup/reset/restore other state, e.g. for current shader using the commented lines below.
       //GLint last_program;
       //glGetIntegerv(GL_CURRENT_PROGRAM, &last_program);
       //glUseProgram(0);
-      ImGui_ImplOpenGL2_RenderDrawData (ImGui::GetDrawData());
+      if (render)
+        ImGui_ImplOpenGL2_RenderDrawData (ImGui::GetDrawData());
       //glUseProgram(last_program);
 
       // Update and Render additional Platform Windows
@@ -154,12 +179,14 @@ int main(int, char**) {
         if (ImGui::GetIO().ConfigFlags & ImGuiConfigFlags_ViewportsEnable) {
           GLFWwindow* backup_current_context = glfwGetCurrentContext();
           ImGui::UpdatePlatformWindows();
-          ImGui::RenderPlatformWindowsDefault();
+          if (render)
+            ImGui::RenderPlatformWindowsDefault();
           glfwMakeContextCurrent(backup_current_context);
         }
       #endif
 
-      glfwSwapBuffers(window);
+      if (render)
+        glfwSwapBuffers(window);
      }
      //}}}
 
@@ -8,6 +8,8 @@
 #include "imgui.h"
 #include "imgui_impl_glfw.h"
 #include "imgui_impl_opengl3.h"
+#include "utils/cIdleLoop.h"
+#include "utils/cDrawCapture.h"
 #include <stdio.h>
 
 #if defined(IMGUI_IMPL_OPENGL_ES2)
@@ -16,6 +18,14 @@
 
 #include <GLFW/glfw3.h> // Will drag system OpenGL headers
 
+#if defined(BUFFER_AGE_GLX)
+  // GLX_EXT_buffer_age, how many swaps ago the back buffer was drawn, for partial redraw, glfw built for X11 only
+  #define GLFW_EXPOSE_NATIVE_X11
+  #define GLFW_EXPOSE_NATIVE_GLX
+  #include <GLFW/glfw3native.h>
+  #include <string.h>
+#endif
+
 // [Win32] Our example includes a copy of glfw3.lib pre-compiled with VS2010 to maximize ease of testing and compatibility with old VS compilers.
 // To link with VS2010-era libraries, VS2015+ requires linking with legacy_stdio_definitions.lib, which we do using this pragma.
 // Your own project should not be affected, as you are likely to link with a newer binary of GLFW that is adequate for your version of Visual Studio.
@@ -29,6 +39,40 @@ static void glfw_error_callback(int error, const char* description) {
   fprintf(stderr, "Glfw Error %d: %s\n", error, description);
   }
 //}}}
+//{{{
+static void glfw_refresh_callback (GLFWwindow* window) {
+// window exposed or uncovered, its contents may be lost, render even if the frame is unchanged
+  ((cIdleLoop*)glfwGetWindowUserPointer (window))->forceRender();
+  }
+//}}}
+
+//{{{
+static int getBufferAge (GLFWwindow* window) {
+// back buffer age, 0 unknown, contents undefined, render everything
+
+  #if defined(BUFFER_AGE_GLX)
+    static int supported = -1;
+    Display* display = glfwGetX11Display();
+    if (!display)
+      return 0;
+    if (supported < 0) {
+      const char* extensions = glXQueryExtensionsString (display, DefaultScreen (display));
+      supported = extensions && strstr (extensions, "GLX_EXT_buffer_age");
+      }
+
+    GLXWindow glxWindow = glfwGetGLXWindow (window);
+    if (!supported || !glxWindow)
+      return 0;
+
+    unsigned int age = 0;
+    glXQueryDrawable (display, glxWindow, 0x20F4 /* GLX_BACK_BUFFER_AGE_EXT */, &age);
+    return (int)age;
+  #else
+    (void)window;
+    return 0;
+  #endif
+  }
+//}}}
 
 int main (int, char**) {
 
@@ -121,6 +165,7 @@ int main (int, char**) {
   //io.Fonts->AddFontFromFileTTF("../../misc/fonts/ProggyTiny.ttf", 10.0f);
   //ImFont* font = io.Fonts->AddFontFromFileTTF("c:\\Windows\\Fonts\\ArialUni.ttf", 18.0f, NULL, io.Fonts->GetGlyphRangesJapanese());
   //IM_ASSERT(font != NULL);
+  //io.Fonts->BuildCached("imgui_fonts.cache"); // reuse baked atlas from a previous run, only rebuilds when fonts change
   //}}}
 
   // Our state
@@ -128,6 +173,19 @@ int main (int, char**) {
   bool show_another_window = false;
   ImVec4 clear_color = ImVec4 (0.45f, 0.55f, 0.60f, 1.00f);
 
+  // block on events when idle, skip render + swap when frame unchanged
+  cIdleLoop idleLoop;
+  idleLoop.setWakeFunc (glfwPostEmptyEvent);
+  glfwSetWindowUserPointer (window, &idleLoop);
+  glfwSetWindowRefreshCallback (window, glfw_refresh_callback);
+
+  // optional capture of rendered frames, replay with drawReplay
+  cDrawCapture drawCapture;
+
+  // optional merge of draw calls across drawLists before rendering
+  ImDrawDataMerger drawDataMerger;
+  bool mergeDrawCalls = false;
+
   while (!glfwWindowShouldClose (window)) {
     //{{{  main loop
     // Poll and handle events (inputs, window resize, etc.)
@@ -135,7 +193,7 @@ int main (int, char**) {
     // - When io.WantCaptureMouse is true, do not dispatch mouse input data to your main application.
     // - When io.WantCaptureKeyboard is true, do not dispatch keyboard input data to your main application.
     // Generally you may always pass all inputs to dear imgui, and hide them from your application based on those two flags.
-    glfwPollEvents();
+    idleLoop.waitEvents (glfwPollEvents, glfwWaitEventsTimeout);
 
     // Start the Dear ImGui frame
     ImGui_ImplOpenGL3_NewFrame();
@@ -165,7 +223,30 @@ int main (int, char**) {
       ImGui::SameLine();
       ImGui::Text("counter = %d", counter);
 
-      ImGui::Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / ImGui::GetIO().Framerate, ImGui::GetIO().Framerate);
+      // idle loop only renders when the frame changes, a per frame fps readout would change every frame
+      bool idle = idleLoop.getEnabled();
+      if (ImGui::Checkbox("idle loop", &idle))
+        idleLoop.setEnabled (idle);
+      if (ImGui::IsItemHovered())
+        ImGui::SetTooltip("frames:%llu renders:%llu waits:%llu %.1fs", (unsigned long long)idleLoop.getFrames(), (unsigned long long)idleLoop.getRenders(),
+                          (unsigned long long)idleLoop.getWaits(), idleLoop.getWaitSeconds());
+      ImGui::Checkbox("merge draw calls", &mergeDrawCalls);
+      if (mergeDrawCalls && ImGui::IsItemHovered())
+        ImGui::SetTooltip("draw calls %d -> %d", drawDataMerger.CmdCountIn, drawDataMerger.CmdCountOut);
+      // experimental, off by default, compare drawData with the last frame, only redraw what changed, a scissor box using the back buffer age
+      ImGui::Checkbox("damage tracking", &io.ConfigDamageTracking);
+      if (io.ConfigDamageTracking && ImGui::IsItemHovered())
+        ImGui::SetTooltip("buffer age %d", getBufferAge (window));
+      bool capture = drawCapture.isCapturing();
+      if (ImGui::Checkbox("capture imgui.imdc", &capture)) {
+        if (capture)
+          drawCapture.start ("imgui.imdc");
+        else
+          drawCapture.stop();
+        }
+
+      if (!idle)
+        ImGui::Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / ImGui::GetIO().Framerate, ImGui::GetIO().Framerate);
       ImGui::End();
       }
 
@@ -180,12 +261,25 @@ int main (int, char**) {
 
     // Rendering
     ImGui::Render();
-    int display_w, display_h;
-    glfwGetFramebufferSize(window, &display_w, &display_h);
-    glViewport(0, 0, display_w, display_h);
-    glClearColor(clear_color.x * clear_color.w, clear_color.y * clear_color.w, clear_color.z * clear_color.w, clear_color.w);
-    glClear(GL_COLOR_BUFFER_BIT);
-    ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+    bool render = idleLoop.isDrawDataChanged();
+    bool swap = render;
+    if (render) {
+      ImDrawData* drawData = mergeDrawCalls ? drawDataMerger.Merge (ImGui::GetDrawData()) : ImGui::GetDrawData();
+      int display_w, display_h;
+      glfwGetFramebufferSize(window, &display_w, &display_h);
+      glViewport(0, 0, display_w, display_h);
+
+      // damage scissors the clear and render, nothing damaged skips the swap
+      // - forced frames, window exposed, render everything whatever the damage
+      const bool full = idleLoop.wasForced();
+      swap = ImGui_ImplOpenGL3_SetupDamage (drawData, full ? 0 : getBufferAge (window)) || full;
+      if (swap) {
+        glClearColor(clear_color.x * clear_color.w, clear_color.y * clear_color.w, clear_color.z * clear_color.w, clear_color.w);
+        glClear(GL_COLOR_BUFFER_BIT);
+        ImGui_ImplOpenGL3_RenderDrawData(drawData);
+        drawCapture.captureFrame (ImGui::GetDrawData());
+        }
+      }
 
     // Update and Render additional Platform Windows
     // (Platform functions may change the current OpenGL context, so we save/restore it to make it easier to paste this code elsewhere.
@@ -195,16 +289,19 @@ int main (int, char**) {
       if (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable) {
         GLFWwindow* backup_current_context = glfwGetCurrentContext();
         ImGui::UpdatePlatformWindows();
-        ImGui::RenderPlatformWindowsDefault();
+        if (render)
+          ImGui::RenderPlatformWindowsDefault();
         glfwMakeContextCurrent(backup_current_context);
         }
     #endif
 
-    glfwSwapBuffers(window);
+    if (swap)
+      glfwSwapBuffers(window);
     }
     //}}}
 
   // Cleanup
+  drawDataMerger.ClearFreeMemory();
   ImGui_ImplOpenGL3_Shutdown();
   ImGui_ImplGlfw_Shutdown();
   ImGui::DestroyContext();
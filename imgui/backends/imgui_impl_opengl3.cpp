@@ -7,6 +7,7 @@
 //  [X] Renderer: User texture binding. Use 'GLuint' OpenGL texture identifier as void*/ImTextureID. Read the FAQ about ImTextureID!
 //  [X] Renderer: Multi-viewport support. Enable with 'io.ConfigFlags |= ImGuiConfigFlags_ViewportsEnable'.
 //  [x] Renderer: Desktop GL only: Support for large meshes (64k+ vertices) with 16-bit indices.
+//  [X] Renderer: Partial redraw of ImDrawData::DamageRects with ImGui_ImplOpenGL3_SetupDamage().
 
 // You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
 // Prefer including the entire imgui/ repository into your project (either as a copy or as a submodule), and only build the backends you need.
@@ -15,6 +16,9 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-18: OpenGL: Added ImGui_ImplOpenGL3_SetupDamage() to redraw the area which changed since the back buffer was drawn (io.ConfigDamageTracking + buffer age).
+//  2026-10-18: OpenGL: Support IMGUI_USE_COMPACT_DRAWVERT 12 bytes vertices: GL_SHORT positions and normalized GL_UNSIGNED_SHORT UV, ImDrawList::VtxOrigin folded into the projection per command list.
+//  2026-10-18: OpenGL: Desktop GL 4.4+/GL_ARB_buffer_storage: upload all draw lists into a persistently mapped ring buffer with one segment per frame shared by all viewports, guarded by fences, cache VAO per context, draw with glDrawElementsBaseVertex() at global offsets.
 //  2021-XX-XX: Platform: Added support for multiple windows via the ImGuiPlatformIO interface.
 //  2021-12-15: OpenGL: Using buffer orphaning + glBufferSubData(), seems to fix leaks with multi-viewports with some Intel HD drivers.
 //  2021-08-23: OpenGL: Fixed ES 3.0 shader ("#version 300 es") use normal precision floats to avoid wobbly rendering at HD resolutions.
@@ -92,6 +96,7 @@
 #include "imgui.h"
 #include "imgui_impl_opengl3.h"
 #include <stdio.h>
+#include <math.h>       // floorf, ceilf
 #if defined(_MSC_VER) && _MSC_VER <= 1500 // MSVC 2008 or earlier
 #include <stddef.h>     // intptr_t
 #else
@@ -174,6 +179,23 @@
 #define IMGUI_IMPL_OPENGL_MAY_HAVE_EXTENSIONS
 #endif
 
+// Desktop GL 4.4+ (or GL_ARB_buffer_storage) has glBufferStorage() for persistently mapped buffers
+// #define IMGUI_IMPL_OPENGL_DISABLE_BUFFER_STORAGE to always use the glBufferSubData() upload path.
+#if !defined(IMGUI_IMPL_OPENGL_ES2) && !defined(IMGUI_IMPL_OPENGL_ES3) && defined(GL_VERSION_4_4) && !defined(IMGUI_IMPL_OPENGL_DISABLE_BUFFER_STORAGE)
+#define IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+#endif
+
+// Number of frames which may be in flight before we wait on the GPU to reuse a ring buffer segment.
+// All RenderDrawData() calls of a frame (one per viewport) share a segment, ImGui_ImplOpenGL3_NewFrame() moves to the next one.
+#ifndef IMGUI_IMPL_OPENGL_RING_FRAMES
+#define IMGUI_IMPL_OPENGL_RING_FRAMES   3
+#endif
+
+// Oldest back buffer ImGui_ImplOpenGL3_SetupDamage() can repaint partially, older ones are redrawn entirely
+#ifndef IMGUI_IMPL_OPENGL_DAMAGE_HISTORY
+#define IMGUI_IMPL_OPENGL_DAMAGE_HISTORY 4
+#endif
+
 // OpenGL Data
 struct ImGui_ImplOpenGL3_Data
 {
@@ -190,8 +212,27 @@ struct ImGui_ImplOpenGL3_Data
     GLsizeiptr      VertexBufferSize;
     GLsizeiptr      IndexBufferSize;
     bool            HasClipOrigin;
+    bool            HasBufferStorage;        // Upload through persistently mapped ring buffers (VboHandle/ElementsHandle) instead of glBufferSubData()
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+    int             RingVtxCount;            // Capacity of one ring segment, in vertices/indices
+    int             RingIdxCount;
+    int             RingVtxUsed;             // Used by the RenderDrawData() calls of the current frame, in vertices/indices
+    int             RingIdxUsed;
+    char*           RingVtxMapped;
+    char*           RingIdxMapped;
+    int             RingFrame;               // Segment of the current frame
+    ImVector<GLsync> RingFences[IMGUI_IMPL_OPENGL_RING_FRAMES]; // One fence per RenderDrawData() call drawing from the segment, viewports may use different contexts
+    GLuint          MainVertexArrayObject;   // Cached VAO for the main viewport context (secondary viewports store theirs in RendererUserData)
+#endif
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    float           ProjMtx[4][4];           // Projection of the current draw data, per command list VtxOrigin and fixed point scale get folded in
+#endif
+    float           DamageHistory[IMGUI_IMPL_OPENGL_DAMAGE_HISTORY][4]; // Bounding box (x1, y1, x2, y2) of ImDrawData::DamageRects of the last frames drawn, most recent first
+    int             DamageHistoryCount;
+    const ImDrawData* DamageDrawData;        // Set by SetupDamage(): the next RenderDrawData() of this draw data only draws inside DamageScissor
+    float           DamageScissor[4];        // Framebuffer pixels (x1, y1, x2, y2), top-left origin
 
-    ImGui_ImplOpenGL3_Data() { memset(this, 0, sizeof(*this)); }
+    ImGui_ImplOpenGL3_Data() { memset((void*)this, 0, sizeof(*this)); }
 };
 
 // Backend data stored in io.BackendRendererUserData to allow support for multiple Dear ImGui contexts
@@ -204,6 +245,9 @@ static ImGui_ImplOpenGL3_Data* ImGui_ImplOpenGL3_GetBackendData()
 // Forward Declarations
 static void ImGui_ImplOpenGL3_InitPlatformInterface();
 static void ImGui_ImplOpenGL3_ShutdownPlatformInterface();
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+static void ImGui_ImplOpenGL3_RingNewFrame();
+#endif
 
 // Functions
 bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
@@ -281,8 +325,16 @@ bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
         const char* extension = (const char*)glGetStringi(GL_EXTENSIONS, i);
         if (extension != NULL && strcmp(extension, "GL_ARB_clip_control") == 0)
             bd->HasClipOrigin = true;
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+        if (extension != NULL && strcmp(extension, "GL_ARB_buffer_storage") == 0 && bd->GlVersion >= 320)
+            bd->HasBufferStorage = true;
+#endif
     }
 #endif
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+    if (bd->GlVersion >= 440)
+        bd->HasBufferStorage = true;
+#endif
 
     if (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable)
         ImGui_ImplOpenGL3_InitPlatformInterface();
@@ -310,6 +362,10 @@ void    ImGui_ImplOpenGL3_NewFrame()
 
     if (!bd->ShaderHandle)
         ImGui_ImplOpenGL3_CreateDeviceObjects();
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+    if (bd->HasBufferStorage)
+        ImGui_ImplOpenGL3_RingNewFrame();
+#endif
 }
 
 static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_width, int fb_height, GLuint vertex_array_object)
@@ -363,6 +419,9 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
     glUseProgram(bd->ShaderHandle);
     glUniform1i(bd->AttribLocationTex, 0);
     glUniformMatrix4fv(bd->AttribLocationProjMtx, 1, GL_FALSE, &ortho_projection[0][0]);
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    memcpy(bd->ProjMtx, ortho_projection, sizeof(ortho_projection));
+#endif
 
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
     if (bd->GlVersion >= 330)
@@ -380,11 +439,142 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
     glEnableVertexAttribArray(bd->AttribLocationVtxPos);
     glEnableVertexAttribArray(bd->AttribLocationVtxUV);
     glEnableVertexAttribArray(bd->AttribLocationVtxColor);
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    glVertexAttribPointer(bd->AttribLocationVtxPos,   2, GL_SHORT,          GL_FALSE, sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, pos));
+    glVertexAttribPointer(bd->AttribLocationVtxUV,    2, GL_UNSIGNED_SHORT, GL_TRUE,  sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, uv));
+#else
     glVertexAttribPointer(bd->AttribLocationVtxPos,   2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, pos));
     glVertexAttribPointer(bd->AttribLocationVtxUV,    2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, uv));
+#endif
     glVertexAttribPointer(bd->AttribLocationVtxColor, 4, GL_UNSIGNED_BYTE, GL_TRUE,  sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, col));
 }
 
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+// Compact vertex positions are fixed point relative to the command list VtxOrigin: fold both into the projection, once per command list
+static void ImGui_ImplOpenGL3_SetupVtxOrigin(const ImDrawList* cmd_list)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    float mtx[4][4];
+    memcpy(mtx, bd->ProjMtx, sizeof(mtx));
+    const float pos_scale = 1.0f / (float)(1 << IMGUI_COMPACT_DRAWVERT_SUBPIXEL_BITS);
+    mtx[3][0] += mtx[0][0] * cmd_list->VtxOrigin.x;
+    mtx[3][1] += mtx[1][1] * cmd_list->VtxOrigin.y;
+    mtx[0][0] *= pos_scale;
+    mtx[1][1] *= pos_scale;
+    glUniformMatrix4fv(bd->AttribLocationProjMtx, 1, GL_FALSE, &mtx[0][0]);
+}
+#endif
+
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+// VAO are not shared among GL contexts: cache one for the main viewport, and one per secondary viewport (which each own a context).
+static GLuint ImGui_ImplOpenGL3_GetVertexArray(ImDrawData* draw_data)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    ImGuiViewport* viewport = draw_data->OwnerViewport;
+    if (viewport == NULL || viewport == ImGui::GetMainViewport())
+    {
+        if (bd->MainVertexArrayObject == 0)
+            glGenVertexArrays(1, &bd->MainVertexArrayObject);
+        return bd->MainVertexArrayObject;
+    }
+    if (viewport->RendererUserData == NULL)
+    {
+        GLuint vertex_array_object = 0;
+        glGenVertexArrays(1, &vertex_array_object);
+        viewport->RendererUserData = (void*)(intptr_t)vertex_array_object;
+    }
+    return (GLuint)(intptr_t)viewport->RendererUserData;
+}
+
+static void ImGui_ImplOpenGL3_RingWait(ImGui_ImplOpenGL3_Data* bd, int frame)
+{
+    ImVector<GLsync>& fences = bd->RingFences[frame];
+    for (int n = 0; n < fences.Size; n++)
+    {
+        for (;;)
+        {
+            GLenum result = glClientWaitSync(fences[n], GL_SYNC_FLUSH_COMMANDS_BIT, 1000000); // 1 ms
+            if (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED || result == GL_WAIT_FAILED)
+                break;
+        }
+        glDeleteSync(fences[n]);
+    }
+    fences.resize(0);
+}
+
+// Buffer storage is immutable: growing means a new buffer, sized for all IMGUI_IMPL_OPENGL_RING_FRAMES segments and mapped once.
+static void ImGui_ImplOpenGL3_CreateRingBuffer(GLuint* handle, char** mapped, int* count, int needed_count, int elem_size)
+{
+    if (*handle)
+        glDeleteBuffers(1, handle); // Implicitly unmaps
+    *count = needed_count + needed_count / 2;
+    if (*count < 5000)
+        *count = 5000;
+    const GLsizeiptr size = (GLsizeiptr)*count * elem_size * IMGUI_IMPL_OPENGL_RING_FRAMES;
+    const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    glGenBuffers(1, handle);
+    glBindBuffer(GL_ARRAY_BUFFER, *handle);
+    glBufferStorage(GL_ARRAY_BUFFER, size, NULL, flags);
+    *mapped = (char*)glMapBufferRange(GL_ARRAY_BUFFER, 0, size, flags);
+}
+
+// Copy all command lists after the data of earlier RenderDrawData() calls in the segment of the current frame.
+// Output base vertex and index byte offset of the draw data, command lists follow each other from there.
+static void ImGui_ImplOpenGL3_RingUpload(ImDrawData* draw_data, GLint* out_vtx_base, GLsizeiptr* out_idx_offset)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    const int frame = bd->RingFrame;
+    const int vtx_needed = bd->RingVtxUsed + draw_data->TotalVtxCount;
+    const int idx_needed = bd->RingIdxUsed + draw_data->TotalIdxCount;
+    if (bd->RingVtxCount < vtx_needed || bd->RingIdxCount < idx_needed || bd->RingVtxMapped == NULL)
+    {
+        // Every segment lives in the same buffer: wait for the GPU to be done with all of them.
+        // Earlier calls of this frame keep drawing from the old buffer, which GL deletes once they are done.
+        for (int n = 0; n < IMGUI_IMPL_OPENGL_RING_FRAMES; n++)
+            ImGui_ImplOpenGL3_RingWait(bd, n);
+        if (bd->RingVtxCount < vtx_needed || bd->RingVtxMapped == NULL)
+            ImGui_ImplOpenGL3_CreateRingBuffer(&bd->VboHandle, &bd->RingVtxMapped, &bd->RingVtxCount, vtx_needed, (int)sizeof(ImDrawVert));
+        if (bd->RingIdxCount < idx_needed || bd->RingIdxMapped == NULL)
+            ImGui_ImplOpenGL3_CreateRingBuffer(&bd->ElementsHandle, &bd->RingIdxMapped, &bd->RingIdxCount, idx_needed, (int)sizeof(ImDrawIdx));
+    }
+
+    const int vtx_base = frame * bd->RingVtxCount + bd->RingVtxUsed;
+    const int idx_base = frame * bd->RingIdxCount + bd->RingIdxUsed;
+    bd->RingVtxUsed += draw_data->TotalVtxCount;
+    bd->RingIdxUsed += draw_data->TotalIdxCount;
+    ImDrawVert* vtx_dst = (ImDrawVert*)(void*)bd->RingVtxMapped + vtx_base;
+    ImDrawIdx* idx_dst = (ImDrawIdx*)(void*)bd->RingIdxMapped + idx_base;
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    {
+        const ImDrawList* cmd_list = draw_data->CmdLists[n];
+        memcpy(vtx_dst, cmd_list->VtxBuffer.Data, cmd_list->VtxBuffer.Size * sizeof(ImDrawVert));
+        memcpy(idx_dst, cmd_list->IdxBuffer.Data, cmd_list->IdxBuffer.Size * sizeof(ImDrawIdx));
+        vtx_dst += cmd_list->VtxBuffer.Size;
+        idx_dst += cmd_list->IdxBuffer.Size;
+    }
+    *out_vtx_base = (GLint)vtx_base;
+    *out_idx_offset = (GLsizeiptr)idx_base * (GLsizeiptr)sizeof(ImDrawIdx);
+}
+
+// Fence the draws from the segment, so it is only overwritten once the GPU is done with them.
+// Flush so the fence can be waited on from another context.
+static void ImGui_ImplOpenGL3_RingFence()
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    bd->RingFences[bd->RingFrame].push_back(glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+    glFlush();
+}
+
+// Move to the next segment once per frame, waiting for the GPU to be done with the frame that last used it
+static void ImGui_ImplOpenGL3_RingNewFrame()
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    bd->RingFrame = (bd->RingFrame + 1) % IMGUI_IMPL_OPENGL_RING_FRAMES;
+    bd->RingVtxUsed = bd->RingIdxUsed = 0;
+    ImGui_ImplOpenGL3_RingWait(bd, bd->RingFrame);
+}
+#endif
+
 // OpenGL3 Render function.
 // Note that this implementation is little overcomplicated because we are saving/setting up/restoring every OpenGL state explicitly.
 // This is in order to be able to run within an OpenGL engine that doesn't do so.
@@ -433,15 +623,27 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
     // Setup desired GL state
     // Recreate the VAO every time (this is to easily allow multiple GL contexts to be rendered to. VAO are not shared among GL contexts)
     // The renderer would actually work without any VAO bound, but then our VertexAttrib calls would overwrite the default one currently bound.
+    // With buffer storage, the VAO is cached per viewport/context and all command lists are uploaded at once before setting up state.
     GLuint vertex_array_object = 0;
 #ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
-    glGenVertexArrays(1, &vertex_array_object);
+    if (!bd->HasBufferStorage)
+        glGenVertexArrays(1, &vertex_array_object);
+#endif
+    GLint global_vtx_offset = 0;
+    GLsizeiptr global_idx_offset = 0;
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+    if (bd->HasBufferStorage)
+    {
+        vertex_array_object = ImGui_ImplOpenGL3_GetVertexArray(draw_data);
+        ImGui_ImplOpenGL3_RingUpload(draw_data, &global_vtx_offset, &global_idx_offset);
+    }
 #endif
     ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object);
 
     // Will project scissor/clipping rectangles into framebuffer space
     ImVec2 clip_off = draw_data->DisplayPos;         // (0,0) unless using multi-viewports
     ImVec2 clip_scale = draw_data->FramebufferScale; // (1,1) unless using retina display which are often (2,2)
+    const bool damage_scissor = (bd->DamageDrawData == draw_data);
 
     // Render command lists
     for (int n = 0; n < draw_data->CmdListsCount; n++)
@@ -449,20 +651,26 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
         const ImDrawList* cmd_list = draw_data->CmdLists[n];
 
         // Upload vertex/index buffers
-        GLsizeiptr vtx_buffer_size = (GLsizeiptr)cmd_list->VtxBuffer.Size * (int)sizeof(ImDrawVert);
-        GLsizeiptr idx_buffer_size = (GLsizeiptr)cmd_list->IdxBuffer.Size * (int)sizeof(ImDrawIdx);
-        if (bd->VertexBufferSize < vtx_buffer_size)
-        {
-            bd->VertexBufferSize = vtx_buffer_size;
-            glBufferData(GL_ARRAY_BUFFER, bd->VertexBufferSize, NULL, GL_STREAM_DRAW);
-        }
-        if (bd->IndexBufferSize < idx_buffer_size)
+        if (!bd->HasBufferStorage)
         {
-            bd->IndexBufferSize = idx_buffer_size;
-            glBufferData(GL_ELEMENT_ARRAY_BUFFER, bd->IndexBufferSize, NULL, GL_STREAM_DRAW);
+            GLsizeiptr vtx_buffer_size = (GLsizeiptr)cmd_list->VtxBuffer.Size * (int)sizeof(ImDrawVert);
+            GLsizeiptr idx_buffer_size = (GLsizeiptr)cmd_list->IdxBuffer.Size * (int)sizeof(ImDrawIdx);
+            if (bd->VertexBufferSize < vtx_buffer_size)
+            {
+                bd->VertexBufferSize = vtx_buffer_size;
+                glBufferData(GL_ARRAY_BUFFER, bd->VertexBufferSize, NULL, GL_STREAM_DRAW);
+            }
+            if (bd->IndexBufferSize < idx_buffer_size)
+            {
+                bd->IndexBufferSize = idx_buffer_size;
+                glBufferData(GL_ELEMENT_ARRAY_BUFFER, bd->IndexBufferSize, NULL, GL_STREAM_DRAW);
+            }
+            glBufferSubData(GL_ARRAY_BUFFER, 0, vtx_buffer_size, (const GLvoid*)cmd_list->VtxBuffer.Data);
+            glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, idx_buffer_size, (const GLvoid*)cmd_list->IdxBuffer.Data);
         }
-        glBufferSubData(GL_ARRAY_BUFFER, 0, vtx_buffer_size, (const GLvoid*)cmd_list->VtxBuffer.Data);
-        glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, idx_buffer_size, (const GLvoid*)cmd_list->IdxBuffer.Data);
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+        ImGui_ImplOpenGL3_SetupVtxOrigin(cmd_list);
+#endif
 
         for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
         {
@@ -472,7 +680,12 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
                 // User callback, registered via ImDrawList::AddCallback()
                 // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
                 if (pcmd->UserCallback == ImDrawCallback_ResetRenderState)
+                {
                     ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object);
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+                    ImGui_ImplOpenGL3_SetupVtxOrigin(cmd_list);
+#endif
+                }
                 else
                     pcmd->UserCallback(cmd_list, pcmd);
             }
@@ -481,6 +694,14 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
                 // Project scissor/clipping rectangles into framebuffer space
                 ImVec2 clip_min((pcmd->ClipRect.x - clip_off.x) * clip_scale.x, (pcmd->ClipRect.y - clip_off.y) * clip_scale.y);
                 ImVec2 clip_max((pcmd->ClipRect.z - clip_off.x) * clip_scale.x, (pcmd->ClipRect.w - clip_off.y) * clip_scale.y);
+                if (damage_scissor)
+                {
+                    // Partial redraw, commands outside of the damaged area are skipped
+                    if (clip_min.x < bd->DamageScissor[0]) clip_min.x = bd->DamageScissor[0];
+                    if (clip_min.y < bd->DamageScissor[1]) clip_min.y = bd->DamageScissor[1];
+                    if (clip_max.x > bd->DamageScissor[2]) clip_max.x = bd->DamageScissor[2];
+                    if (clip_max.y > bd->DamageScissor[3]) clip_max.y = bd->DamageScissor[3];
+                }
                 if (clip_max.x <= clip_min.x || clip_max.y <= clip_min.y)
                     continue;
 
@@ -489,6 +710,11 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
 
                 // Bind texture, Draw
                 glBindTexture(GL_TEXTURE_2D, (GLuint)(intptr_t)pcmd->GetTexID());
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+                if (bd->HasBufferStorage)
+                    glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(global_idx_offset + pcmd->IdxOffset * sizeof(ImDrawIdx)), (GLint)(global_vtx_offset + pcmd->VtxOffset));
+                else
+#endif
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_VTX_OFFSET
                 if (bd->GlVersion >= 320)
                     glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(pcmd->IdxOffset * sizeof(ImDrawIdx)), (GLint)pcmd->VtxOffset);
@@ -497,11 +723,18 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
                 glDrawElements(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(pcmd->IdxOffset * sizeof(ImDrawIdx)));
             }
         }
+        global_vtx_offset += cmd_list->VtxBuffer.Size;
+        global_idx_offset += (GLsizeiptr)cmd_list->IdxBuffer.Size * (GLsizeiptr)sizeof(ImDrawIdx);
     }
 
-    // Destroy the temporary VAO
+    // Destroy the temporary VAO, or fence the ring segment we used
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+    if (bd->HasBufferStorage)
+        ImGui_ImplOpenGL3_RingFence();
+#endif
 #ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
-    glDeleteVertexArrays(1, &vertex_array_object);
+    if (!bd->HasBufferStorage)
+        glDeleteVertexArrays(1, &vertex_array_object);
 #endif
 
     // Restore modified GL state
@@ -532,9 +765,75 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
 #endif
     glViewport(last_viewport[0], last_viewport[1], (GLsizei)last_viewport[2], (GLsizei)last_viewport[3]);
     glScissor(last_scissor_box[0], last_scissor_box[1], (GLsizei)last_scissor_box[2], (GLsizei)last_scissor_box[3]);
+
+    // The damage scissor set up by ImGui_ImplOpenGL3_SetupDamage() ends with this draw data
+    if (damage_scissor)
+    {
+        glDisable(GL_SCISSOR_TEST);
+        bd->DamageDrawData = NULL;
+    }
     (void)bd; // Not all compilation paths use this
 }
 
+// Back buffers keep the frame they were last drawn with, 'buffer_age' frames ago (1 = previous frame). Redrawing the bounding box of the
+// damage of the last 'buffer_age' frames brings them up to date. Damage rectangles are merged into one box as GL has a single scissor.
+bool    ImGui_ImplOpenGL3_SetupDamage(ImDrawData* draw_data, int buffer_age)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    IM_ASSERT(bd != NULL && "Did you call ImGui_ImplOpenGL3_Init()?");
+    bd->DamageDrawData = NULL;
+    int fb_width = (int)(draw_data->DisplaySize.x * draw_data->FramebufferScale.x);
+    int fb_height = (int)(draw_data->DisplaySize.y * draw_data->FramebufferScale.y);
+    if (fb_width <= 0 || fb_height <= 0)
+        return false;
+    if (!draw_data->HasDamageRects)
+    {
+        bd->DamageHistoryCount = 0;
+        glDisable(GL_SCISSOR_TEST);
+        return true;
+    }
+    if (draw_data->DamageRectsCount == 0)
+        return false;
+
+    ImVec4 damage = draw_data->DamageRects[0];
+    for (int n = 1; n < draw_data->DamageRectsCount; n++)
+    {
+        const ImVec4& r = draw_data->DamageRects[n];
+        damage = ImVec4(r.x < damage.x ? r.x : damage.x, r.y < damage.y ? r.y : damage.y, r.z > damage.z ? r.z : damage.z, r.w > damage.w ? r.w : damage.w);
+    }
+    memmove(&bd->DamageHistory[1], &bd->DamageHistory[0], (IMGUI_IMPL_OPENGL_DAMAGE_HISTORY - 1) * sizeof(bd->DamageHistory[0]));
+    bd->DamageHistory[0][0] = damage.x; bd->DamageHistory[0][1] = damage.y; bd->DamageHistory[0][2] = damage.z; bd->DamageHistory[0][3] = damage.w;
+    if (bd->DamageHistoryCount < IMGUI_IMPL_OPENGL_DAMAGE_HISTORY)
+        bd->DamageHistoryCount++;
+    if (buffer_age <= 0 || buffer_age > bd->DamageHistoryCount)
+    {
+        glDisable(GL_SCISSOR_TEST);
+        return true;
+    }
+    for (int n = 1; n < buffer_age; n++)
+    {
+        const float* h = bd->DamageHistory[n];
+        ImVec4 r(h[0], h[1], h[2], h[3]);
+        damage = ImVec4(r.x < damage.x ? r.x : damage.x, r.y < damage.y ? r.y : damage.y, r.z > damage.z ? r.z : damage.z, r.w > damage.w ? r.w : damage.w);
+    }
+
+    // Project into framebuffer space, rounded outward
+    ImVec2 clip_off = draw_data->DisplayPos;
+    ImVec2 clip_scale = draw_data->FramebufferScale;
+    float x0 = floorf((damage.x - clip_off.x) * clip_scale.x), y0 = floorf((damage.y - clip_off.y) * clip_scale.y);
+    float x1 = ceilf((damage.z - clip_off.x) * clip_scale.x), y1 = ceilf((damage.w - clip_off.y) * clip_scale.y);
+    bd->DamageScissor[0] = x0 > 0.0f ? x0 : 0.0f;
+    bd->DamageScissor[1] = y0 > 0.0f ? y0 : 0.0f;
+    bd->DamageScissor[2] = x1 < (float)fb_width ? x1 : (float)fb_width;
+    bd->DamageScissor[3] = y1 < (float)fb_height ? y1 : (float)fb_height;
+    bd->DamageDrawData = draw_data;
+
+    // Y is inverted in OpenGL
+    glEnable(GL_SCISSOR_TEST);
+    glScissor((int)bd->DamageScissor[0], (int)((float)fb_height - bd->DamageScissor[3]), (int)(bd->DamageScissor[2] - bd->DamageScissor[0]), (int)(bd->DamageScissor[3] - bd->DamageScissor[1]));
+    return true;
+}
+
 bool ImGui_ImplOpenGL3_CreateFontsTexture()
 {
     ImGuiIO& io = ImGui::GetIO();
@@ -810,6 +1109,18 @@ void    ImGui_ImplOpenGL3_DestroyDeviceObjects()
     if (bd->VboHandle)      { glDeleteBuffers(1, &bd->VboHandle); bd->VboHandle = 0; }
     if (bd->ElementsHandle) { glDeleteBuffers(1, &bd->ElementsHandle); bd->ElementsHandle = 0; }
     if (bd->ShaderHandle)   { glDeleteProgram(bd->ShaderHandle); bd->ShaderHandle = 0; }
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+    for (int n = 0; n < IMGUI_IMPL_OPENGL_RING_FRAMES; n++)
+    {
+        for (int fence_n = 0; fence_n < bd->RingFences[n].Size; fence_n++)
+            glDeleteSync(bd->RingFences[n][fence_n]);
+        bd->RingFences[n].clear();
+    }
+    if (bd->MainVertexArrayObject) { glDeleteVertexArrays(1, &bd->MainVertexArrayObject); bd->MainVertexArrayObject = 0; }
+    bd->RingVtxMapped = bd->RingIdxMapped = NULL;
+    bd->RingVtxCount = bd->RingIdxCount = 0;
+    bd->RingVtxUsed = bd->RingIdxUsed = 0;
+#endif
     ImGui_ImplOpenGL3_DestroyFontsTexture();
 }
 
@@ -830,10 +1141,17 @@ static void ImGui_ImplOpenGL3_RenderWindow(ImGuiViewport* viewport, void*)
     ImGui_ImplOpenGL3_RenderDrawData(viewport->DrawData);
 }
 
+// The cached VAO (if any) belongs to the viewport's own GL context, which goes away along with the platform window.
+static void ImGui_ImplOpenGL3_DestroyWindow(ImGuiViewport* viewport)
+{
+    viewport->RendererUserData = NULL;
+}
+
 static void ImGui_ImplOpenGL3_InitPlatformInterface()
 {
     ImGuiPlatformIO& platform_io = ImGui::GetPlatformIO();
     platform_io.Renderer_RenderWindow = ImGui_ImplOpenGL3_RenderWindow;
+    platform_io.Renderer_DestroyWindow = ImGui_ImplOpenGL3_DestroyWindow;
 }
 
 static void ImGui_ImplOpenGL3_ShutdownPlatformInterface()
@@ -27,6 +27,13 @@ IMGUI_IMPL_API void     ImGui_ImplOpenGL3_Shutdown();
 IMGUI_IMPL_API void     ImGui_ImplOpenGL3_NewFrame();
 IMGUI_IMPL_API void     ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data);
 
+// (Optional) Partial redraw with damage tracking (io.ConfigDamageTracking = true). Call before clearing the framebuffer, then render the same draw_data.
+// - 'buffer_age': frames since the back buffer was last drawn (GLX_EXT_buffer_age/EGL_EXT_buffer_age), 1 for a single buffered or copied swap, 0 if unknown.
+// - Returns false when the back buffer doesn't need to change: skip clearing, rendering and presenting.
+// - Otherwise enables a scissor rectangle around the area to repaint (or disables scissoring to repaint everything), which applies to your
+//   glClear() call. The following ImGui_ImplOpenGL3_RenderDrawData() call only draws inside it, and disables the scissor test on return.
+IMGUI_IMPL_API bool     ImGui_ImplOpenGL3_SetupDamage(ImDrawData* draw_data, int buffer_age);
+
 // (Optional) Called by Init/NewFrame/Shutdown
 IMGUI_IMPL_API bool     ImGui_ImplOpenGL3_CreateFontsTexture();
 IMGUI_IMPL_API void     ImGui_ImplOpenGL3_DestroyFontsTexture();
@@ -159,6 +159,7 @@ typedef khronos_uint8_t GLubyte;
 #define GL_PACK_ALIGNMENT                 0x0D05
 #define GL_TEXTURE_2D                     0x0DE1
 #define GL_UNSIGNED_BYTE                  0x1401
+#define GL_SHORT                          0x1402
 #define GL_UNSIGNED_SHORT                 0x1403
 #define GL_UNSIGNED_INT                   0x1405
 #define GL_FLOAT                          0x1406
@@ -177,6 +178,7 @@ typedef void (APIENTRYP PFNGLCLEARPROC) (GLbitfield mask);
 typedef void (APIENTRYP PFNGLCLEARCOLORPROC) (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha);
 typedef void (APIENTRYP PFNGLDISABLEPROC) (GLenum cap);
 typedef void (APIENTRYP PFNGLENABLEPROC) (GLenum cap);
+typedef void (APIENTRYP PFNGLFLUSHPROC) (void);
 typedef void (APIENTRYP PFNGLPIXELSTOREIPROC) (GLenum pname, GLint param);
 typedef void (APIENTRYP PFNGLREADPIXELSPROC) (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels);
 typedef GLenum (APIENTRYP PFNGLGETERRORPROC) (void);
@@ -193,6 +195,7 @@ GLAPI void APIENTRY glClear (GLbitfield mask);
 GLAPI void APIENTRY glClearColor (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha);
 GLAPI void APIENTRY glDisable (GLenum cap);
 GLAPI void APIENTRY glEnable (GLenum cap);
+GLAPI void APIENTRY glFlush (void);
 GLAPI void APIENTRY glPixelStorei (GLenum pname, GLint param);
 GLAPI void APIENTRY glReadPixels (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels);
 GLAPI GLenum APIENTRY glGetError (void);
@@ -250,12 +253,14 @@ typedef void (APIENTRYP PFNGLDELETEBUFFERSPROC) (GLsizei n, const GLuint *buffer
 typedef void (APIENTRYP PFNGLGENBUFFERSPROC) (GLsizei n, GLuint *buffers);
 typedef void (APIENTRYP PFNGLBUFFERDATAPROC) (GLenum target, GLsizeiptr size, const void *data, GLenum usage);
 typedef void (APIENTRYP PFNGLBUFFERSUBDATAPROC) (GLenum target, GLintptr offset, GLsizeiptr size, const void *data);
+typedef GLboolean (APIENTRYP PFNGLUNMAPBUFFERPROC) (GLenum target);
 #ifdef GL_GLEXT_PROTOTYPES
 GLAPI void APIENTRY glBindBuffer (GLenum target, GLuint buffer);
 GLAPI void APIENTRY glDeleteBuffers (GLsizei n, const GLuint *buffers);
 GLAPI void APIENTRY glGenBuffers (GLsizei n, GLuint *buffers);
 GLAPI void APIENTRY glBufferData (GLenum target, GLsizeiptr size, const void *data, GLenum usage);
 GLAPI void APIENTRY glBufferSubData (GLenum target, GLintptr offset, GLsizeiptr size, const void *data);
+GLAPI GLboolean APIENTRY glUnmapBuffer (GLenum target);
 #endif
 #endif /* GL_VERSION_1_5 */
 #ifndef GL_VERSION_2_0
@@ -324,14 +329,17 @@ typedef khronos_uint16_t GLhalf;
 #define GL_NUM_EXTENSIONS                 0x821D
 #define GL_FRAMEBUFFER_SRGB               0x8DB9
 #define GL_VERTEX_ARRAY_BINDING           0x85B5
+#define GL_MAP_WRITE_BIT                  0x0002
 typedef void (APIENTRYP PFNGLGETBOOLEANI_VPROC) (GLenum target, GLuint index, GLboolean *data);
 typedef void (APIENTRYP PFNGLGETINTEGERI_VPROC) (GLenum target, GLuint index, GLint *data);
 typedef const GLubyte *(APIENTRYP PFNGLGETSTRINGIPROC) (GLenum name, GLuint index);
+typedef void *(APIENTRYP PFNGLMAPBUFFERRANGEPROC) (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access);
 typedef void (APIENTRYP PFNGLBINDVERTEXARRAYPROC) (GLuint array);
 typedef void (APIENTRYP PFNGLDELETEVERTEXARRAYSPROC) (GLsizei n, const GLuint *arrays);
 typedef void (APIENTRYP PFNGLGENVERTEXARRAYSPROC) (GLsizei n, GLuint *arrays);
 #ifdef GL_GLEXT_PROTOTYPES
 GLAPI const GLubyte *APIENTRY glGetStringi (GLenum name, GLuint index);
+GLAPI void *APIENTRY glMapBufferRange (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access);
 GLAPI void APIENTRY glBindVertexArray (GLuint array);
 GLAPI void APIENTRY glDeleteVertexArrays (GLsizei n, const GLuint *arrays);
 GLAPI void APIENTRY glGenVertexArrays (GLsizei n, GLuint *arrays);
@@ -346,10 +354,21 @@ GLAPI void APIENTRY glGenVertexArrays (GLsizei n, GLuint *arrays);
 typedef struct __GLsync *GLsync;
 typedef khronos_uint64_t GLuint64;
 typedef khronos_int64_t GLint64;
+#define GL_SYNC_GPU_COMMANDS_COMPLETE     0x9117
+#define GL_ALREADY_SIGNALED               0x911A
+#define GL_CONDITION_SATISFIED            0x911C
+#define GL_WAIT_FAILED                    0x911D
+#define GL_SYNC_FLUSH_COMMANDS_BIT        0x00000001
 typedef void (APIENTRYP PFNGLDRAWELEMENTSBASEVERTEXPROC) (GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex);
+typedef GLsync (APIENTRYP PFNGLFENCESYNCPROC) (GLenum condition, GLbitfield flags);
+typedef void (APIENTRYP PFNGLDELETESYNCPROC) (GLsync sync);
+typedef GLenum (APIENTRYP PFNGLCLIENTWAITSYNCPROC) (GLsync sync, GLbitfield flags, GLuint64 timeout);
 typedef void (APIENTRYP PFNGLGETINTEGER64I_VPROC) (GLenum target, GLuint index, GLint64 *data);
 #ifdef GL_GLEXT_PROTOTYPES
 GLAPI void APIENTRY glDrawElementsBaseVertex (GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex);
+GLAPI GLsync APIENTRY glFenceSync (GLenum condition, GLbitfield flags);
+GLAPI void APIENTRY glDeleteSync (GLsync sync);
+GLAPI GLenum APIENTRY glClientWaitSync (GLsync sync, GLbitfield flags, GLuint64 timeout);
 #endif
 #endif /* GL_VERSION_3_2 */
 #ifndef GL_VERSION_3_3
@@ -367,6 +386,15 @@ typedef void (APIENTRYP PFNGLGETDOUBLEI_VPROC) (GLenum target, GLuint index, GLd
 #ifndef GL_VERSION_4_3
 typedef void (APIENTRY  *GLDEBUGPROC)(GLenum source,GLenum type,GLuint id,GLenum severity,GLsizei length,const GLchar *message,const void *userParam);
 #endif /* GL_VERSION_4_3 */
+#ifndef GL_VERSION_4_4
+#define GL_VERSION_4_4 1
+#define GL_MAP_PERSISTENT_BIT             0x0040
+#define GL_MAP_COHERENT_BIT               0x0080
+typedef void (APIENTRYP PFNGLBUFFERSTORAGEPROC) (GLenum target, GLsizeiptr size, const void *data, GLbitfield flags);
+#ifdef GL_GLEXT_PROTOTYPES
+GLAPI void APIENTRY glBufferStorage (GLenum target, GLsizeiptr size, const void *data, GLbitfield flags);
+#endif
+#endif /* GL_VERSION_4_4 */
 #ifndef GL_VERSION_4_5
 #define GL_CLIP_ORIGIN                    0x935C
 typedef void (APIENTRYP PFNGLGETTRANSFORMFEEDBACKI_VPROC) (GLuint xfb, GLenum pname, GLuint index, GLint *param);
@@ -437,7 +465,7 @@ GL3W_API GL3WglProc imgl3wGetProcAddress(const char *proc);
 
 /* gl3w internal state */
 union GL3WProcs {
-    GL3WglProc ptr[54];
+    GL3WglProc ptr[61];
     struct {
         PFNGLACTIVETEXTUREPROC           ActiveTexture;
         PFNGLATTACHSHADERPROC            AttachShader;
@@ -449,15 +477,18 @@ union GL3WProcs {
         PFNGLBLENDEQUATIONSEPARATEPROC   BlendEquationSeparate;
         PFNGLBLENDFUNCSEPARATEPROC       BlendFuncSeparate;
         PFNGLBUFFERDATAPROC              BufferData;
+        PFNGLBUFFERSTORAGEPROC           BufferStorage;
         PFNGLBUFFERSUBDATAPROC           BufferSubData;
         PFNGLCLEARPROC                   Clear;
         PFNGLCLEARCOLORPROC              ClearColor;
+        PFNGLCLIENTWAITSYNCPROC          ClientWaitSync;
         PFNGLCOMPILESHADERPROC           CompileShader;
         PFNGLCREATEPROGRAMPROC           CreateProgram;
         PFNGLCREATESHADERPROC            CreateShader;
         PFNGLDELETEBUFFERSPROC           DeleteBuffers;
         PFNGLDELETEPROGRAMPROC           DeleteProgram;
         PFNGLDELETESHADERPROC            DeleteShader;
+        PFNGLDELETESYNCPROC              DeleteSync;
         PFNGLDELETETEXTURESPROC          DeleteTextures;
         PFNGLDELETEVERTEXARRAYSPROC      DeleteVertexArrays;
         PFNGLDETACHSHADERPROC            DetachShader;
@@ -466,6 +497,8 @@ union GL3WProcs {
         PFNGLDRAWELEMENTSBASEVERTEXPROC  DrawElementsBaseVertex;
         PFNGLENABLEPROC                  Enable;
         PFNGLENABLEVERTEXATTRIBARRAYPROC EnableVertexAttribArray;
+        PFNGLFENCESYNCPROC               FenceSync;
+        PFNGLFLUSHPROC                   Flush;
         PFNGLGENBUFFERSPROC              GenBuffers;
         PFNGLGENTEXTURESPROC             GenTextures;
         PFNGLGENVERTEXARRAYSPROC         GenVertexArrays;
@@ -481,6 +514,7 @@ union GL3WProcs {
         PFNGLGETUNIFORMLOCATIONPROC      GetUniformLocation;
         PFNGLISENABLEDPROC               IsEnabled;
         PFNGLLINKPROGRAMPROC             LinkProgram;
+        PFNGLMAPBUFFERRANGEPROC          MapBufferRange;
         PFNGLPIXELSTOREIPROC             PixelStorei;
         PFNGLPOLYGONMODEPROC             PolygonMode;
         PFNGLREADPIXELSPROC              ReadPixels;
@@ -490,6 +524,7 @@ union GL3WProcs {
         PFNGLTEXPARAMETERIPROC           TexParameteri;
         PFNGLUNIFORM1IPROC               Uniform1i;
         PFNGLUNIFORMMATRIX4FVPROC        UniformMatrix4fv;
+        PFNGLUNMAPBUFFERPROC             UnmapBuffer;
         PFNGLUSEPROGRAMPROC              UseProgram;
         PFNGLVERTEXATTRIBPOINTERPROC     VertexAttribPointer;
         PFNGLVIEWPORTPROC                Viewport;
@@ -509,15 +544,18 @@ GL3W_API extern union GL3WProcs imgl3wProcs;
 #define glBlendEquationSeparate          imgl3wProcs.gl.BlendEquationSeparate
 #define glBlendFuncSeparate              imgl3wProcs.gl.BlendFuncSeparate
 #define glBufferData                     imgl3wProcs.gl.BufferData
+#define glBufferStorage                  imgl3wProcs.gl.BufferStorage
 #define glBufferSubData                  imgl3wProcs.gl.BufferSubData
 #define glClear                          imgl3wProcs.gl.Clear
 #define glClearColor                     imgl3wProcs.gl.ClearColor
+#define glClientWaitSync                 imgl3wProcs.gl.ClientWaitSync
 #define glCompileShader                  imgl3wProcs.gl.CompileShader
 #define glCreateProgram                  imgl3wProcs.gl.CreateProgram
 #define glCreateShader                   imgl3wProcs.gl.CreateShader
 #define glDeleteBuffers                  imgl3wProcs.gl.DeleteBuffers
 #define glDeleteProgram                  imgl3wProcs.gl.DeleteProgram
 #define glDeleteShader                   imgl3wProcs.gl.DeleteShader
+#define glDeleteSync                     imgl3wProcs.gl.DeleteSync
 #define glDeleteTextures                 imgl3wProcs.gl.DeleteTextures
 #define glDeleteVertexArrays             imgl3wProcs.gl.DeleteVertexArrays
 #define glDetachShader                   imgl3wProcs.gl.DetachShader
@@ -526,6 +564,8 @@ GL3W_API extern union GL3WProcs imgl3wProcs;
 #define glDrawElementsBaseVertex         imgl3wProcs.gl.DrawElementsBaseVertex
 #define glEnable                         imgl3wProcs.gl.Enable
 #define glEnableVertexAttribArray        imgl3wProcs.gl.EnableVertexAttribArray
+#define glFenceSync                      imgl3wProcs.gl.FenceSync
+#define glFlush                          imgl3wProcs.gl.Flush
 #define glGenBuffers                     imgl3wProcs.gl.GenBuffers
 #define glGenTextures                    imgl3wProcs.gl.GenTextures
 #define glGenVertexArrays                imgl3wProcs.gl.GenVertexArrays
@@ -541,6 +581,7 @@ GL3W_API extern union GL3WProcs imgl3wProcs;
 #define glGetUniformLocation             imgl3wProcs.gl.GetUniformLocation
 #define glIsEnabled                      imgl3wProcs.gl.IsEnabled
 #define glLinkProgram                    imgl3wProcs.gl.LinkProgram
+#define glMapBufferRange                 imgl3wProcs.gl.MapBufferRange
 #define glPixelStorei                    imgl3wProcs.gl.PixelStorei
 #define glPolygonMode                    imgl3wProcs.gl.PolygonMode
 #define glReadPixels                     imgl3wProcs.gl.ReadPixels
@@ -550,6 +591,7 @@ GL3W_API extern union GL3WProcs imgl3wProcs;
 #define glTexParameteri                  imgl3wProcs.gl.TexParameteri
 #define glUniform1i                      imgl3wProcs.gl.Uniform1i
 #define glUniformMatrix4fv               imgl3wProcs.gl.UniformMatrix4fv
+#define glUnmapBuffer                    imgl3wProcs.gl.UnmapBuffer
 #define glUseProgram                     imgl3wProcs.gl.UseProgram
 #define glVertexAttribPointer            imgl3wProcs.gl.VertexAttribPointer
 #define glViewport                       imgl3wProcs.gl.Viewport
@@ -696,15 +738,18 @@ static const char *proc_names[] = {
     "glBlendEquationSeparate",
     "glBlendFuncSeparate",
     "glBufferData",
+    "glBufferStorage",
     "glBufferSubData",
     "glClear",
     "glClearColor",
+    "glClientWaitSync",
     "glCompileShader",
     "glCreateProgram",
     "glCreateShader",
     "glDeleteBuffers",
     "glDeleteProgram",
     "glDeleteShader",
+    "glDeleteSync",
     "glDeleteTextures",
     "glDeleteVertexArrays",
     "glDetachShader",
@@ -713,6 +758,8 @@ static const char *proc_names[] = {
     "glDrawElementsBaseVertex",
     "glEnable",
     "glEnableVertexAttribArray",
+    "glFenceSync",
+    "glFlush",
     "glGenBuffers",
     "glGenTextures",
     "glGenVertexArrays",
@@ -728,6 +775,7 @@ static const char *proc_names[] = {
     "glGetUniformLocation",
     "glIsEnabled",
     "glLinkProgram",
+    "glMapBufferRange",
     "glPixelStorei",
     "glPolygonMode",
     "glReadPixels",
@@ -737,6 +785,7 @@ static const char *proc_names[] = {
     "glTexParameteri",
     "glUniform1i",
     "glUniformMatrix4fv",
+    "glUnmapBuffer",
     "glUseProgram",
     "glVertexAttribPointer",
     "glViewport",
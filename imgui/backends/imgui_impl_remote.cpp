@@ -0,0 +1,1308 @@
+// dear imgui: Remote Platform + Renderer Backend, streams ImDrawData to a viewer over a TCP or Unix socket
+// (Headless servers: the UI runs on the server, a thin viewer renders the received draw lists with any renderer backend and sends input back)
+
+// Implemented features:
+//  [X] Renderer: Delta frames. Draw lists unchanged since the previous frame are sent as a reference, changed vertex/index buffers are XOR'ed against the previous frame and zero run encoded.
+//  [X] Renderer: A slow viewer never stalls the server. While the previous frame is still being sent new frames are dropped.
+//  [X] Platform: Mouse position/buttons/wheel, ImGuiKey_ keys, modifiers, text input, display size and mouse cursor shape from the viewer.
+//  [X] Platform: Runs alone on a headless server (becomes the platform + renderer backend), or alongside local backends to mirror a window.
+// Missing features:
+//  [ ] Renderer: User textures. Every ImTextureID is drawn with the font atlas on the viewer. User callbacks are not sent.
+//  [ ] Platform: Clipboard, gamepad, multi-viewport. Raw keys outside of the ImGuiKey_ enum are not forwarded.
+//  [ ] Platform: One viewer at a time, one server per process.
+//  [ ] No authentication or encryption. Listen on loopback or a Unix socket and tunnel (e.g. 'ssh -L') across networks.
+
+// You can copy and use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
+// If you are new to Dear ImGui, read documentation from the docs/ folder + read the top of imgui.cpp.
+// Read online: https://github.com/ocornut/imgui/tree/master/docs
+
+// Protocol:
+// - Messages in both directions are: type (u8), payload size (u32), payload. Integers are little endian, counts are LEB128 varints.
+// - Server to viewer:
+//   'H' hello: "IMRM", version, sizeof(ImDrawVert), sizeof(ImDrawIdx). The viewer disconnects on mismatch.
+//   'A' font atlas: width, height, RGBA32 pixels zero run encoded.
+//   'F' frame: mouse cursor, DisplayPos/DisplaySize/FramebufferScale, then per draw list either
+//       0 + index of an identical draw list in the previous frame (same hash of vertices, indices and commands), or
+//       1 + vertex/index/command counts, VtxOrigin (with IMGUI_USE_COMPACT_DRAWVERT only), commands, then vertex and index bytes XOR'ed with the previous frame draw list
+//       at the same index, encoded as (zero run length, literal length, literal bytes) until the buffer is covered.
+//       The previous frame is the last frame sent: a dropped frame is never a delta base, so no keyframes are needed.
+// - Viewer to server:
+//   'I' input: mouse position/buttons/wheel, ImGuiKey_ bits, modifiers, display size, framebuffer scale, characters.
+//       Sent when the state changes. Buttons/keys pressed and released between two server frames are held for one frame.
+
+// CHANGELOG
+//  2022-XX-XX: Initial version.
+
+#include "imgui.h"
+#include "imgui_impl_remote.h"
+#include "imgui_internal.h"     // ImHashData64
+#include <float.h>
+#include <string.h>
+#include <chrono>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#ifdef _MSC_VER
+#pragma comment(lib, "ws2_32")
+#endif
+typedef SOCKET ImGui_ImplRemote_Socket;
+#define IMGUI_IMPL_REMOTE_INVALID_SOCKET    INVALID_SOCKET
+#else
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/select.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <netdb.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+typedef int ImGui_ImplRemote_Socket;
+#define IMGUI_IMPL_REMOTE_INVALID_SOCKET    (-1)
+#endif
+
+#define IMGUI_IMPL_REMOTE_VERSION           1
+#define IMGUI_IMPL_REMOTE_MIN_ZERO_RUN      4                   // Shorter zero runs stay in the literal, a run costs 2 varints
+#define IMGUI_IMPL_REMOTE_MAX_MESSAGE       (256 * 1024 * 1024) // Larger payload sizes are treated as a corrupt stream
+#define IMGUI_IMPL_REMOTE_MAX_ELEMENTS      (16 * 1024 * 1024)  // Larger vertex/index/command counts too
+
+//-----------------------------------------------------------------------------
+// Encoding
+//-----------------------------------------------------------------------------
+
+static void ImGui_ImplRemote_PutU8(ImVector<unsigned char>& buf, unsigned int value)
+{
+    buf.push_back((unsigned char)value);
+}
+
+static void ImGui_ImplRemote_PutU32(ImVector<unsigned char>& buf, ImU32 value)
+{
+    unsigned char bytes[4] = { (unsigned char)value, (unsigned char)(value >> 8), (unsigned char)(value >> 16), (unsigned char)(value >> 24) };
+    buf.reserve(buf.Size + 4);
+    for (int i = 0; i < 4; i++)
+        buf.push_back(bytes[i]);
+}
+
+static void ImGui_ImplRemote_PutFloat(ImVector<unsigned char>& buf, float value)
+{
+    ImU32 bits;
+    memcpy(&bits, &value, 4);
+    ImGui_ImplRemote_PutU32(buf, bits);
+}
+
+static void ImGui_ImplRemote_PutVarint(ImVector<unsigned char>& buf, ImU64 value)
+{
+    while (value >= 0x80)
+    {
+        buf.push_back((unsigned char)(value | 0x80));
+        value >>= 7;
+    }
+    buf.push_back((unsigned char)value);
+}
+
+// Returns the offset to pass to EndMessage() once the payload is written
+static int ImGui_ImplRemote_BeginMessage(ImVector<unsigned char>& buf, char type)
+{
+    ImGui_ImplRemote_PutU8(buf, (unsigned char)type);
+    ImGui_ImplRemote_PutU32(buf, 0);
+    return buf.Size;
+}
+
+static void ImGui_ImplRemote_EndMessage(ImVector<unsigned char>& buf, int payload_offset)
+{
+    ImU32 size = (ImU32)(buf.Size - payload_offset);
+    for (int i = 0; i < 4; i++)
+        buf[payload_offset - 4 + i] = (unsigned char)(size >> (i * 8));
+}
+
+// 'data' XOR 'base' as (zero run length, literal length, literal bytes) until 'size' is covered. Bytes past 'base_size' XOR with zero.
+static void ImGui_ImplRemote_PutXorRuns(ImVector<unsigned char>& buf, const unsigned char* data, int size, const unsigned char* base, int base_size)
+{
+    if (base_size > size)
+        base_size = size;
+    buf.reserve(buf.Size + size + 16);
+
+    int i = 0;
+    while (i < size)
+    {
+        int zeros_end = i;
+        while (zeros_end < size && data[zeros_end] == (zeros_end < base_size ? base[zeros_end] : 0))
+            zeros_end++;
+
+        // Literal runs up to the next zero run long enough to be worth a new (run, literal) pair
+        int literal_end = zeros_end;
+        int zero_run = 0;
+        while (literal_end < size)
+        {
+            if (data[literal_end] == (literal_end < base_size ? base[literal_end] : 0))
+            {
+                if (++zero_run == IMGUI_IMPL_REMOTE_MIN_ZERO_RUN)
+                {
+                    literal_end -= IMGUI_IMPL_REMOTE_MIN_ZERO_RUN - 1;
+                    break;
+                }
+            }
+            else
+            {
+                zero_run = 0;
+            }
+            literal_end++;
+        }
+        if (literal_end == size)
+            literal_end -= zero_run;
+
+        ImGui_ImplRemote_PutVarint(buf, (ImU64)(zeros_end - i));
+        ImGui_ImplRemote_PutVarint(buf, (ImU64)(literal_end - zeros_end));
+        for (i = zeros_end; i < literal_end; i++)
+            buf.push_back((unsigned char)(data[i] ^ (i < base_size ? base[i] : 0)));
+    }
+}
+
+// Bounds checked reader, any overrun clears Ok and returns zeros
+struct ImGui_ImplRemote_Reader
+{
+    const unsigned char*    Data;
+    const unsigned char*    End;
+    bool                    Ok;
+
+    ImGui_ImplRemote_Reader(const unsigned char* data, int size) { Data = data; End = data + size; Ok = true; }
+
+    unsigned int GetU8()
+    {
+        if (Data >= End) { Ok = false; return 0; }
+        return *Data++;
+    }
+    ImU32 GetU32()
+    {
+        if (End - Data < 4) { Ok = false; return 0; }
+        ImU32 value = (ImU32)Data[0] | ((ImU32)Data[1] << 8) | ((ImU32)Data[2] << 16) | ((ImU32)Data[3] << 24);
+        Data += 4;
+        return value;
+    }
+    float GetFloat()
+    {
+        ImU32 bits = GetU32();
+        float value;
+        memcpy(&value, &bits, 4);
+        return value;
+    }
+    ImU64 GetVarint()
+    {
+        ImU64 value = 0;
+        for (int shift = 0; shift < 64; shift += 7)
+        {
+            unsigned int byte = GetU8();
+            value |= (ImU64)(byte & 0x7F) << shift;
+            if (!(byte & 0x80))
+                return value;
+        }
+        Ok = false;
+        return 0;
+    }
+    int GetCount(int max_count)
+    {
+        ImU64 value = GetVarint();
+        if (value > (ImU64)max_count) { Ok = false; return 0; }
+        return (int)value;
+    }
+    // Inverse of PutXorRuns()
+    bool GetXorRuns(unsigned char* out, int size, const unsigned char* base, int base_size)
+    {
+        int i = 0;
+        while (i < size && Ok)
+        {
+            int zeros = GetCount(size - i);
+            int literal = GetCount(size - i - zeros);
+            if (!Ok || literal > End - Data)
+                return Ok = false;
+            memset(out + i, 0, (size_t)zeros);
+            i += zeros;
+            memcpy(out + i, Data, (size_t)literal);
+            Data += literal;
+            i += literal;
+        }
+        if (base_size > size)
+            base_size = size;
+        for (int j = 0; j < base_size; j++)
+            out[j] ^= base[j];
+        return Ok;
+    }
+};
+
+//-----------------------------------------------------------------------------
+// Sockets
+//-----------------------------------------------------------------------------
+
+static bool ImGui_ImplRemote_SocketsInit()
+{
+#ifdef _WIN32
+    WSADATA wsa_data;
+    return WSAStartup(MAKEWORD(2, 2), &wsa_data) == 0;
+#else
+    return true;
+#endif
+}
+
+static void ImGui_ImplRemote_SocketsShutdown()
+{
+#ifdef _WIN32
+    WSACleanup();
+#endif
+}
+
+static void ImGui_ImplRemote_CloseSocket(ImGui_ImplRemote_Socket s)
+{
+#ifdef _WIN32
+    closesocket(s);
+#else
+    close(s);
+#endif
+}
+
+static void ImGui_ImplRemote_SetNonBlocking(ImGui_ImplRemote_Socket s)
+{
+#ifdef _WIN32
+    u_long non_blocking = 1;
+    ioctlsocket(s, FIONBIO, &non_blocking);
+#else
+    fcntl(s, F_SETFL, fcntl(s, F_GETFL, 0) | O_NONBLOCK);
+#endif
+}
+
+// Connected stream socket setup: non blocking, no Nagle delay on small input/frame messages, no SIGPIPE
+static void ImGui_ImplRemote_SetupStream(ImGui_ImplRemote_Socket s, bool tcp)
+{
+    ImGui_ImplRemote_SetNonBlocking(s);
+    if (tcp)
+    {
+        int no_delay = 1;
+        setsockopt(s, IPPROTO_TCP, TCP_NODELAY, (const char*)&no_delay, sizeof(no_delay));
+    }
+#ifdef SO_NOSIGPIPE
+    int no_sigpipe = 1;
+    setsockopt(s, SOL_SOCKET, SO_NOSIGPIPE, (const char*)&no_sigpipe, sizeof(no_sigpipe));
+#endif
+}
+
+static bool ImGui_ImplRemote_WouldBlock()
+{
+#ifdef _WIN32
+    return WSAGetLastError() == WSAEWOULDBLOCK;
+#else
+    return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+#endif
+}
+
+// Parse "tcp:[host:]port" or "unix:path", then listen or connect. 'out_unix_path' receives the path of a listening Unix socket.
+static ImGui_ImplRemote_Socket ImGui_ImplRemote_OpenSocket(const char* address, bool listening, bool* out_tcp, char* out_unix_path, size_t unix_path_size)
+{
+    if (out_unix_path && unix_path_size)
+        out_unix_path[0] = 0;
+
+    if (strncmp(address, "unix:", 5) == 0)
+    {
+        *out_tcp = false;
+#ifdef _WIN32
+        return IMGUI_IMPL_REMOTE_INVALID_SOCKET;
+#else
+        struct sockaddr_un addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.sun_family = AF_UNIX;
+        if (strlen(address + 5) >= sizeof(addr.sun_path))
+            return IMGUI_IMPL_REMOTE_INVALID_SOCKET;
+        strcpy(addr.sun_path, address + 5);
+
+        ImGui_ImplRemote_Socket s = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (s == IMGUI_IMPL_REMOTE_INVALID_SOCKET)
+            return s;
+        if (listening)
+        {
+            unlink(addr.sun_path);
+            if (bind(s, (struct sockaddr*)&addr, sizeof(addr)) != 0 || listen(s, 1) != 0)
+            {
+                ImGui_ImplRemote_CloseSocket(s);
+                return IMGUI_IMPL_REMOTE_INVALID_SOCKET;
+            }
+            if (out_unix_path && unix_path_size > strlen(addr.sun_path))
+                strcpy(out_unix_path, addr.sun_path);
+        }
+        else if (connect(s, (struct sockaddr*)&addr, sizeof(addr)) != 0)
+        {
+            ImGui_ImplRemote_CloseSocket(s);
+            return IMGUI_IMPL_REMOTE_INVALID_SOCKET;
+        }
+        return s;
+#endif
+    }
+
+    if (strncmp(address, "tcp:", 4) != 0)
+        return IMGUI_IMPL_REMOTE_INVALID_SOCKET;
+    *out_tcp = true;
+
+    // "tcp:port" is loopback, "tcp:host:port" splits on the last ':' to allow IPv6 hosts
+    char host[256];
+    const char* port = strrchr(address + 4, ':');
+    if (port)
+    {
+        size_t host_len = (size_t)(port - (address + 4));
+        if (host_len >= sizeof(host))
+            return IMGUI_IMPL_REMOTE_INVALID_SOCKET;
+        memcpy(host, address + 4, host_len);
+        host[host_len] = 0;
+        port++;
+    }
+    else
+    {
+        strcpy(host, listening ? "127.0.0.1" : "localhost");
+        port = address + 4;
+    }
+
+    struct addrinfo hints;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_flags = listening ? AI_PASSIVE : 0;
+    struct addrinfo* results = NULL;
+    if (getaddrinfo(host, port, &hints, &results) != 0)
+        return IMGUI_IMPL_REMOTE_INVALID_SOCKET;
+
+    ImGui_ImplRemote_Socket s = IMGUI_IMPL_REMOTE_INVALID_SOCKET;
+    for (struct addrinfo* ai = results; ai != NULL && s == IMGUI_IMPL_REMOTE_INVALID_SOCKET; ai = ai->ai_next)
+    {
+        s = socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
+        if (s == IMGUI_IMPL_REMOTE_INVALID_SOCKET)
+            continue;
+        bool ok;
+        if (listening)
+        {
+            int reuse = 1;
+            setsockopt(s, SOL_SOCKET, SO_REUSEADDR, (const char*)&reuse, sizeof(reuse));
+            ok = bind(s, ai->ai_addr, (int)ai->ai_addrlen) == 0 && listen(s, 1) == 0;
+        }
+        else
+        {
+            ok = connect(s, ai->ai_addr, (int)ai->ai_addrlen) == 0;
+        }
+        if (!ok)
+        {
+            ImGui_ImplRemote_CloseSocket(s);
+            s = IMGUI_IMPL_REMOTE_INVALID_SOCKET;
+        }
+    }
+    freeaddrinfo(results);
+    return s;
+}
+
+// Returns true if 's' has data to read (or a connection to accept) within the timeout
+static bool ImGui_ImplRemote_WaitReadable(ImGui_ImplRemote_Socket s, double timeout_seconds)
+{
+    fd_set read_set;
+    FD_ZERO(&read_set);
+    FD_SET(s, &read_set);
+    struct timeval tv;
+    tv.tv_sec = (long)timeout_seconds;
+    tv.tv_usec = (long)((timeout_seconds - (double)tv.tv_sec) * 1000000.0);
+    return select((int)s + 1, &read_set, NULL, NULL, &tv) > 0;
+}
+
+// Write as much of 'buf' from '*offset' as the socket takes. Returns false on a broken connection.
+static bool ImGui_ImplRemote_Flush(ImGui_ImplRemote_Socket s, ImVector<unsigned char>& buf, int* offset, ImU64* sent_bytes)
+{
+    while (*offset < buf.Size)
+    {
+#if defined(MSG_NOSIGNAL)
+        int sent = (int)send(s, (const char*)buf.Data + *offset, buf.Size - *offset, MSG_NOSIGNAL);
+#else
+        int sent = (int)send(s, (const char*)buf.Data + *offset, buf.Size - *offset, 0);
+#endif
+        if (sent <= 0)
+            return sent < 0 && ImGui_ImplRemote_WouldBlock();
+        *offset += sent;
+        if (sent_bytes)
+            *sent_bytes += (ImU64)sent;
+    }
+    buf.resize(0);
+    *offset = 0;
+    return true;
+}
+
+// Append everything available to 'buf'. Returns false on a closed or broken connection.
+static bool ImGui_ImplRemote_Receive(ImGui_ImplRemote_Socket s, ImVector<unsigned char>& buf)
+{
+    for (;;)
+    {
+        if (buf.Capacity - buf.Size < 64 * 1024)
+            buf.reserve(buf.Size + 256 * 1024);
+        int received = (int)recv(s, (char*)buf.Data + buf.Size, buf.Capacity - buf.Size, 0);
+        if (received == 0)
+            return false;
+        if (received < 0)
+            return ImGui_ImplRemote_WouldBlock();
+        buf.Size += received;
+    }
+}
+
+// Next complete message in 'buf' at '*offset'. Returns false when more data is needed, sets '*out_error' on a corrupt stream.
+static bool ImGui_ImplRemote_NextMessage(const ImVector<unsigned char>& buf, int* offset, char* out_type, const unsigned char** out_payload, int* out_size, bool* out_error)
+{
+    if (buf.Size - *offset < 5)
+        return false;
+    const unsigned char* p = buf.Data + *offset;
+    ImU32 size = (ImU32)p[1] | ((ImU32)p[2] << 8) | ((ImU32)p[3] << 16) | ((ImU32)p[4] << 24);
+    if (size > IMGUI_IMPL_REMOTE_MAX_MESSAGE)
+    {
+        *out_error = true;
+        return false;
+    }
+    if ((ImU32)(buf.Size - *offset - 5) < size)
+        return false;
+    *out_type = (char)p[0];
+    *out_payload = p + 5;
+    *out_size = (int)size;
+    *offset += 5 + (int)size;
+    return true;
+}
+
+static void ImGui_ImplRemote_Consume(ImVector<unsigned char>& buf, int offset)
+{
+    if (offset <= 0)
+        return;
+    if (offset < buf.Size)
+        memmove(buf.Data, buf.Data + offset, (size_t)(buf.Size - offset));
+    buf.Size -= offset;
+}
+
+//-----------------------------------------------------------------------------
+// Input state, shared by both sides
+//-----------------------------------------------------------------------------
+
+struct ImGui_ImplRemote_Input
+{
+    ImVec2      MousePos;           // -FLT_MAX when the mouse is outside the viewer window
+    ImU32       MouseButtons;       // Bit per io.MouseDown[]
+    ImVec2      MouseWheel;         // Horizontal, vertical
+    ImU32       Keys;               // Bit per ImGuiKey_
+    ImU32       Mods;               // ImGuiKeyModFlags_
+    ImVec2      DisplaySize;
+    ImVec2      FramebufferScale;
+
+    ImGui_ImplRemote_Input() { Clear(); }
+    void Clear()
+    {
+        MousePos = ImVec2(-FLT_MAX, -FLT_MAX);
+        MouseButtons = Keys = Mods = 0;
+        MouseWheel = DisplaySize = ImVec2(0.0f, 0.0f);
+        FramebufferScale = ImVec2(1.0f, 1.0f);
+    }
+};
+
+//-----------------------------------------------------------------------------
+// Server
+//-----------------------------------------------------------------------------
+
+// Last sent frame draw list, the delta base of the next frame
+struct ImGui_ImplRemote_ListState
+{
+    ImU64                   Hash;
+    ImVector<unsigned char> VtxBytes;
+    ImVector<unsigned char> IdxBytes;
+};
+
+struct ImGui_ImplRemote_Data
+{
+    ImGui_ImplRemote_Socket ListenSocket;
+    ImGui_ImplRemote_Socket ViewerSocket;
+    bool                    IsTcp;
+    char                    UnixPath[256];
+    bool                    IsPlatformBackend;  // Headless: we own io.DisplaySize, io.DeltaTime, io.KeyMap
+    std::chrono::steady_clock::time_point Time;
+
+    ImVector<unsigned char> SendBuffer;
+    int                     SendOffset;
+    ImVector<unsigned char> RecvBuffer;
+
+    // Delta base, and next frame base being built
+    ImVector<ImGui_ImplRemote_ListState*> Lists;
+    ImVector<ImGui_ImplRemote_ListState*> NextLists;
+    bool                    AtlasSent;
+    int                     AtlasWidth, AtlasHeight;
+    const void*             AtlasPixels;
+
+    // Latest viewer input, plus buttons/keys seen down since the last NewFrame()
+    ImGui_ImplRemote_Input  Input;
+    ImU32                   MouseButtonsSeen;
+    ImU32                   KeysSeen;
+    ImU32                   ModsSeen;
+    ImVec2                  MouseWheelAccum;
+    ImU32                   KeysApplied;
+    ImU32                   ModsApplied;
+    bool                    HasInput;
+
+    ImGui_ImplRemote_Stats  Stats;
+
+    ImGui_ImplRemote_Data()
+    {
+        ListenSocket = ViewerSocket = IMGUI_IMPL_REMOTE_INVALID_SOCKET;
+        IsTcp = false;
+        UnixPath[0] = 0;
+        IsPlatformBackend = false;
+        SendOffset = 0;
+        AtlasSent = false;
+        AtlasWidth = AtlasHeight = 0;
+        AtlasPixels = NULL;
+        MouseButtonsSeen = KeysSeen = ModsSeen = KeysApplied = ModsApplied = 0;
+        MouseWheelAccum = ImVec2(0.0f, 0.0f);
+        HasInput = false;
+        memset(&Stats, 0, sizeof(Stats));
+    }
+};
+
+// The remote backend can run alongside another platform + renderer backend, so it can't use the io.BackendXXXUserData slots.
+static ImGui_ImplRemote_Data* g_RemoteData = NULL;
+
+static void ImGui_ImplRemote_ClearListStates(ImVector<ImGui_ImplRemote_ListState*>& lists)
+{
+    for (int i = 0; i < lists.Size; i++)
+        IM_DELETE(lists[i]);
+    lists.clear();
+}
+
+static void ImGui_ImplRemote_CloseViewer(ImGui_ImplRemote_Data* bd)
+{
+    if (bd->ViewerSocket != IMGUI_IMPL_REMOTE_INVALID_SOCKET)
+        ImGui_ImplRemote_CloseSocket(bd->ViewerSocket);
+    bd->ViewerSocket = IMGUI_IMPL_REMOTE_INVALID_SOCKET;
+    bd->SendBuffer.clear();
+    bd->SendOffset = 0;
+    bd->RecvBuffer.clear();
+    ImGui_ImplRemote_ClearListStates(bd->Lists);
+    ImGui_ImplRemote_ClearListStates(bd->NextLists);
+    bd->AtlasSent = false;
+
+    // Release everything the viewer held, NewFrame() applies it as key/button releases
+    bd->Input.Clear();
+    bd->MouseButtonsSeen = bd->KeysSeen = bd->ModsSeen = 0;
+    bd->MouseWheelAccum = ImVec2(0.0f, 0.0f);
+}
+
+bool ImGui_ImplRemote_Init(const char* address)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    IM_ASSERT(g_RemoteData == NULL && "Already initialized a remote backend!");
+
+    if (!ImGui_ImplRemote_SocketsInit())
+        return false;
+    ImGui_ImplRemote_Data* bd = IM_NEW(ImGui_ImplRemote_Data)();
+    bd->ListenSocket = ImGui_ImplRemote_OpenSocket(address, true, &bd->IsTcp, bd->UnixPath, sizeof(bd->UnixPath));
+    if (bd->ListenSocket == IMGUI_IMPL_REMOTE_INVALID_SOCKET)
+    {
+        IM_DELETE(bd);
+        ImGui_ImplRemote_SocketsShutdown();
+        return false;
+    }
+    ImGui_ImplRemote_SetNonBlocking(bd->ListenSocket);
+    g_RemoteData = bd;
+
+    // Headless: nothing else drives io, the viewer window is our display and ImGuiKey_ values index io.KeysDown[] directly
+    if (io.BackendPlatformName == NULL && io.BackendPlatformUserData == NULL)
+    {
+        bd->IsPlatformBackend = true;
+        bd->Time = std::chrono::steady_clock::now();
+        io.BackendPlatformName = "imgui_impl_remote";
+        if (io.BackendRendererName == NULL)
+            io.BackendRendererName = "imgui_impl_remote";
+        io.BackendFlags |= ImGuiBackendFlags_HasMouseCursors;
+        for (int key = 0; key < ImGuiKey_COUNT; key++)
+            io.KeyMap[key] = key;
+        if (io.DisplaySize.x <= 0.0f || io.DisplaySize.y <= 0.0f)
+            io.DisplaySize = ImVec2(1280.0f, 720.0f);
+    }
+    return true;
+}
+
+void ImGui_ImplRemote_Shutdown()
+{
+    ImGui_ImplRemote_Data* bd = g_RemoteData;
+    IM_ASSERT(bd != NULL && "No remote backend to shutdown, or already shutdown?");
+    ImGuiIO& io = ImGui::GetIO();
+
+    ImGui_ImplRemote_CloseViewer(bd);
+    ImGui_ImplRemote_CloseSocket(bd->ListenSocket);
+#ifndef _WIN32
+    if (bd->UnixPath[0])
+        unlink(bd->UnixPath);
+#endif
+    ImGui_ImplRemote_SocketsShutdown();
+
+    if (bd->IsPlatformBackend)
+    {
+        io.BackendPlatformName = NULL;
+        if (io.BackendRendererName && strcmp(io.BackendRendererName, "imgui_impl_remote") == 0)
+            io.BackendRendererName = NULL;
+    }
+    g_RemoteData = NULL;
+    IM_DELETE(bd);
+}
+
+static void ImGui_ImplRemote_ParseInput(ImGui_ImplRemote_Data* bd, const unsigned char* payload, int size)
+{
+    ImGui_ImplRemote_Reader r(payload, size);
+    ImGui_ImplRemote_Input input;
+    input.MousePos.x = r.GetFloat();
+    input.MousePos.y = r.GetFloat();
+    input.MouseButtons = r.GetU32();
+    input.MouseWheel.x = r.GetFloat();
+    input.MouseWheel.y = r.GetFloat();
+    input.Keys = r.GetU32();
+    input.Mods = r.GetU32();
+    input.DisplaySize.x = r.GetFloat();
+    input.DisplaySize.y = r.GetFloat();
+    input.FramebufferScale.x = r.GetFloat();
+    input.FramebufferScale.y = r.GetFloat();
+    int chars_count = r.GetCount(size);
+    if (!r.Ok)
+        return;
+
+    ImGuiIO& io = ImGui::GetIO();
+    for (int i = 0; i < chars_count && r.Ok; i++)
+    {
+        unsigned int c = (unsigned int)r.GetVarint();
+        if (r.Ok)
+            io.AddInputCharacter(c);
+    }
+
+    bd->Input = input;
+    bd->MouseButtonsSeen |= input.MouseButtons;
+    bd->KeysSeen |= input.Keys;
+    bd->ModsSeen |= input.Mods;
+    bd->MouseWheelAccum.x += input.MouseWheel.x;
+    bd->MouseWheelAccum.y += input.MouseWheel.y;
+    bd->HasInput = true;
+}
+
+static void ImGui_ImplRemote_UpdateViewer(ImGui_ImplRemote_Data* bd)
+{
+    if (bd->ViewerSocket == IMGUI_IMPL_REMOTE_INVALID_SOCKET)
+    {
+        ImGui_ImplRemote_Socket s = accept(bd->ListenSocket, NULL, NULL);
+        if (s == IMGUI_IMPL_REMOTE_INVALID_SOCKET)
+            return;
+        ImGui_ImplRemote_SetupStream(s, bd->IsTcp);
+        ImGui_ImplRemote_CloseViewer(bd);
+        bd->ViewerSocket = s;
+        bd->HasInput = false;
+
+        int payload_offset = ImGui_ImplRemote_BeginMessage(bd->SendBuffer, 'H');
+        const char magic[4] = { 'I', 'M', 'R', 'M' };
+        for (int i = 0; i < 4; i++)
+            ImGui_ImplRemote_PutU8(bd->SendBuffer, (unsigned char)magic[i]);
+        ImGui_ImplRemote_PutU32(bd->SendBuffer, IMGUI_IMPL_REMOTE_VERSION);
+        ImGui_ImplRemote_PutU32(bd->SendBuffer, (ImU32)sizeof(ImDrawVert));
+        ImGui_ImplRemote_PutU32(bd->SendBuffer, (ImU32)sizeof(ImDrawIdx));
+        ImGui_ImplRemote_EndMessage(bd->SendBuffer, payload_offset);
+    }
+
+    bool ok = ImGui_ImplRemote_Receive(bd->ViewerSocket, bd->RecvBuffer);
+    int offset = 0;
+    char type;
+    const unsigned char* payload;
+    int size;
+    bool error = false;
+    while (ImGui_ImplRemote_NextMessage(bd->RecvBuffer, &offset, &type, &payload, &size, &error))
+        if (type == 'I')
+            ImGui_ImplRemote_ParseInput(bd, payload, size);
+    ImGui_ImplRemote_Consume(bd->RecvBuffer, offset);
+
+    if (!ok || error || !ImGui_ImplRemote_Flush(bd->ViewerSocket, bd->SendBuffer, &bd->SendOffset, &bd->Stats.SentBytes))
+        ImGui_ImplRemote_CloseViewer(bd);
+}
+
+void ImGui_ImplRemote_NewFrame()
+{
+    ImGui_ImplRemote_Data* bd = g_RemoteData;
+    IM_ASSERT(bd != NULL && "Did you call ImGui_ImplRemote_Init()?");
+    ImGuiIO& io = ImGui::GetIO();
+
+    ImGui_ImplRemote_UpdateViewer(bd);
+    bool connected = bd->ViewerSocket != IMGUI_IMPL_REMOTE_INVALID_SOCKET;
+
+    if (bd->IsPlatformBackend)
+    {
+        if (connected && bd->HasInput && bd->Input.DisplaySize.x > 0.0f && bd->Input.DisplaySize.y > 0.0f)
+        {
+            io.DisplaySize = bd->Input.DisplaySize;
+            io.DisplayFramebufferScale = bd->Input.FramebufferScale;
+        }
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        float delta_time = std::chrono::duration<float>(now - bd->Time).count();
+        io.DeltaTime = delta_time > 0.0f ? delta_time : 1.0f / 60.0f;
+        bd->Time = now;
+
+        // Nothing else builds the atlas when headless
+        if (!io.Fonts->IsBuilt())
+        {
+            unsigned char* pixels;
+            int width, height;
+            io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+        }
+    }
+
+    if (!bd->HasInput)
+        return;
+
+    // Mouse: the viewer owns the mouse while over its window. Mirroring, the local platform backend has already filled io.
+    ImU32 buttons = bd->Input.MouseButtons | bd->MouseButtonsSeen;
+    if (bd->IsPlatformBackend || bd->Input.MousePos.x != -FLT_MAX)
+        io.MousePos = bd->Input.MousePos;
+    for (int i = 0; i < IM_ARRAYSIZE(io.MouseDown) && i < 32; i++)
+    {
+        bool down = (buttons & (1u << i)) != 0;
+        if (bd->IsPlatformBackend)
+            io.MouseDown[i] = down;
+        else
+            io.MouseDown[i] |= down;
+    }
+    io.MouseWheelH += bd->MouseWheelAccum.x;
+    io.MouseWheel += bd->MouseWheelAccum.y;
+
+    // Keys and modifiers are written on change only, so mirrored local keyboard state isn't overwritten every frame
+    ImU32 keys = bd->Input.Keys | bd->KeysSeen;
+    for (int key = 0; key < ImGuiKey_COUNT && key < 32; key++)
+    {
+        ImU32 bit = 1u << key;
+        int index = io.KeyMap[key];
+        if (((keys ^ bd->KeysApplied) & bit) && index >= 0 && index < IM_ARRAYSIZE(io.KeysDown))
+            io.KeysDown[index] = (keys & bit) != 0;
+    }
+    bd->KeysApplied = keys;
+
+    ImU32 mods = bd->Input.Mods | bd->ModsSeen;
+    ImU32 mods_changed = mods ^ bd->ModsApplied;
+    if (mods_changed & ImGuiKeyModFlags_Ctrl)  io.KeyCtrl = (mods & ImGuiKeyModFlags_Ctrl) != 0;
+    if (mods_changed & ImGuiKeyModFlags_Shift) io.KeyShift = (mods & ImGuiKeyModFlags_Shift) != 0;
+    if (mods_changed & ImGuiKeyModFlags_Alt)   io.KeyAlt = (mods & ImGuiKeyModFlags_Alt) != 0;
+    if (mods_changed & ImGuiKeyModFlags_Super) io.KeySuper = (mods & ImGuiKeyModFlags_Super) != 0;
+    bd->ModsApplied = mods;
+
+    bd->MouseButtonsSeen = bd->Input.MouseButtons;
+    bd->KeysSeen = bd->Input.Keys;
+    bd->ModsSeen = bd->Input.Mods;
+    bd->MouseWheelAccum = ImVec2(0.0f, 0.0f);
+    if (!connected)
+        bd->HasInput = false;
+}
+
+static void ImGui_ImplRemote_QueueAtlas(ImGui_ImplRemote_Data* bd)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    unsigned char* pixels = NULL;
+    int width = 0, height = 0;
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+    if (bd->AtlasSent && pixels == bd->AtlasPixels && width == bd->AtlasWidth && height == bd->AtlasHeight)
+        return;
+
+    int payload_offset = ImGui_ImplRemote_BeginMessage(bd->SendBuffer, 'A');
+    ImGui_ImplRemote_PutU32(bd->SendBuffer, (ImU32)width);
+    ImGui_ImplRemote_PutU32(bd->SendBuffer, (ImU32)height);
+    ImGui_ImplRemote_PutXorRuns(bd->SendBuffer, pixels, width * height * 4, NULL, 0);
+    ImGui_ImplRemote_EndMessage(bd->SendBuffer, payload_offset);
+
+    bd->AtlasSent = true;
+    bd->AtlasPixels = pixels;
+    bd->AtlasWidth = width;
+    bd->AtlasHeight = height;
+}
+
+void ImGui_ImplRemote_RenderDrawData(ImDrawData* draw_data)
+{
+    ImGui_ImplRemote_Data* bd = g_RemoteData;
+    IM_ASSERT(bd != NULL && "Did you call ImGui_ImplRemote_Init()?");
+    if (bd->ViewerSocket == IMGUI_IMPL_REMOTE_INVALID_SOCKET)
+        return;
+
+    // Still sending the previous frame: drop this one. Deltas are against the last frame sent, so nothing is lost.
+    ImGui_ImplRemote_QueueAtlas(bd);
+    if (!ImGui_ImplRemote_Flush(bd->ViewerSocket, bd->SendBuffer, &bd->SendOffset, &bd->Stats.SentBytes))
+    {
+        ImGui_ImplRemote_CloseViewer(bd);
+        return;
+    }
+    if (bd->SendBuffer.Size > 0)
+    {
+        bd->Stats.FramesDropped++;
+        return;
+    }
+
+    ImVector<unsigned char>& buf = bd->SendBuffer;
+    int payload_offset = ImGui_ImplRemote_BeginMessage(buf, 'F');
+    ImGui_ImplRemote_PutU8(buf, (unsigned int)(ImGui::GetMouseCursor() + 1));
+    ImGui_ImplRemote_PutFloat(buf, draw_data->DisplayPos.x);
+    ImGui_ImplRemote_PutFloat(buf, draw_data->DisplayPos.y);
+    ImGui_ImplRemote_PutFloat(buf, draw_data->DisplaySize.x);
+    ImGui_ImplRemote_PutFloat(buf, draw_data->DisplaySize.y);
+    ImGui_ImplRemote_PutFloat(buf, draw_data->FramebufferScale.x);
+    ImGui_ImplRemote_PutFloat(buf, draw_data->FramebufferScale.y);
+    ImGui_ImplRemote_PutVarint(buf, (ImU64)draw_data->CmdListsCount);
+
+    ImVector<ImGui_ImplRemote_ListState*>& prev_lists = bd->Lists;
+    ImVector<ImGui_ImplRemote_ListState*>& next_lists = bd->NextLists;
+    while (next_lists.Size < draw_data->CmdListsCount)
+    {
+        ImGui_ImplRemote_ListState* state = IM_NEW(ImGui_ImplRemote_ListState)();
+        state->Hash = 0;
+        next_lists.push_back(state);
+    }
+
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    {
+        const ImDrawList* cmd_list = draw_data->CmdLists[n];
+        const int vtx_bytes = cmd_list->VtxBuffer.size_in_bytes();
+        const int idx_bytes = cmd_list->IdxBuffer.size_in_bytes();
+
+        // Hash what the viewer renders: vertices, indices and draw commands without callbacks
+        ImU64 hash = ImHashData64(cmd_list->VtxBuffer.Data, (size_t)vtx_bytes, 0);
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+        hash = ImHashData64(&cmd_list->VtxOrigin, sizeof(cmd_list->VtxOrigin), hash);
+#endif
+        hash = ImHashData64(cmd_list->IdxBuffer.Data, (size_t)idx_bytes, hash);
+        int cmd_count = 0;
+        for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
+        {
+            const ImDrawCmd* pcmd = &cmd_list->CmdBuffer[cmd_i];
+            if (pcmd->UserCallback != NULL)
+                continue;
+            ImU32 offsets[3] = { pcmd->VtxOffset, pcmd->IdxOffset, pcmd->ElemCount };
+            hash = ImHashData64(&pcmd->ClipRect, sizeof(pcmd->ClipRect), hash);
+            hash = ImHashData64(offsets, sizeof(offsets), hash);
+            cmd_count++;
+        }
+        bd->Stats.RawBytes += (ImU64)(vtx_bytes + idx_bytes + cmd_list->CmdBuffer.size_in_bytes());
+
+        // Same draw list index first (common case), then any draw list of the previous frame (windows reordered by focus)
+        int match = -1;
+        for (int i = 0; i < prev_lists.Size && match < 0; i++)
+        {
+            const ImGui_ImplRemote_ListState* prev = prev_lists[(n + i) % prev_lists.Size];
+            if (prev->Hash == hash && prev->VtxBytes.Size == vtx_bytes && prev->IdxBytes.Size == idx_bytes)
+                match = (n + i) % prev_lists.Size;
+        }
+
+        ImGui_ImplRemote_ListState* next = next_lists[n];
+        next->Hash = hash;
+        next->VtxBytes.resize(vtx_bytes);
+        next->IdxBytes.resize(idx_bytes);
+        memcpy(next->VtxBytes.Data, cmd_list->VtxBuffer.Data, (size_t)vtx_bytes);
+        memcpy(next->IdxBytes.Data, cmd_list->IdxBuffer.Data, (size_t)idx_bytes);
+
+        if (match >= 0)
+        {
+            ImGui_ImplRemote_PutVarint(buf, 0);
+            ImGui_ImplRemote_PutVarint(buf, (ImU64)match);
+            bd->Stats.ListsSkipped++;
+            continue;
+        }
+
+        ImGui_ImplRemote_PutVarint(buf, 1);
+        ImGui_ImplRemote_PutVarint(buf, (ImU64)cmd_list->VtxBuffer.Size);
+        ImGui_ImplRemote_PutVarint(buf, (ImU64)cmd_list->IdxBuffer.Size);
+        ImGui_ImplRemote_PutVarint(buf, (ImU64)cmd_count);
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+        ImGui_ImplRemote_PutFloat(buf, cmd_list->VtxOrigin.x);
+        ImGui_ImplRemote_PutFloat(buf, cmd_list->VtxOrigin.y);
+#endif
+        for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
+        {
+            const ImDrawCmd* pcmd = &cmd_list->CmdBuffer[cmd_i];
+            if (pcmd->UserCallback != NULL)
+                continue;
+            ImGui_ImplRemote_PutFloat(buf, pcmd->ClipRect.x);
+            ImGui_ImplRemote_PutFloat(buf, pcmd->ClipRect.y);
+            ImGui_ImplRemote_PutFloat(buf, pcmd->ClipRect.z);
+            ImGui_ImplRemote_PutFloat(buf, pcmd->ClipRect.w);
+            ImGui_ImplRemote_PutVarint(buf, pcmd->VtxOffset);
+            ImGui_ImplRemote_PutVarint(buf, pcmd->IdxOffset);
+            ImGui_ImplRemote_PutVarint(buf, pcmd->ElemCount);
+        }
+        const ImGui_ImplRemote_ListState* base = n < prev_lists.Size ? prev_lists[n] : NULL;
+        ImGui_ImplRemote_PutXorRuns(buf, next->VtxBytes.Data, vtx_bytes, base ? base->VtxBytes.Data : NULL, base ? base->VtxBytes.Size : 0);
+        ImGui_ImplRemote_PutXorRuns(buf, next->IdxBytes.Data, idx_bytes, base ? base->IdxBytes.Data : NULL, base ? base->IdxBytes.Size : 0);
+        bd->Stats.ListsSent++;
+    }
+    ImGui_ImplRemote_EndMessage(buf, payload_offset);
+
+    // This frame becomes the delta base, spare states are kept for reuse
+    prev_lists.swap(next_lists);
+    while (prev_lists.Size > draw_data->CmdListsCount)
+    {
+        next_lists.push_back(prev_lists.back());
+        prev_lists.pop_back();
+    }
+    bd->Stats.FramesSent++;
+
+    if (!ImGui_ImplRemote_Flush(bd->ViewerSocket, bd->SendBuffer, &bd->SendOffset, &bd->Stats.SentBytes))
+        ImGui_ImplRemote_CloseViewer(bd);
+}
+
+bool ImGui_ImplRemote_WaitEvents(double timeout_seconds)
+{
+    ImGui_ImplRemote_Data* bd = g_RemoteData;
+    IM_ASSERT(bd != NULL && "Did you call ImGui_ImplRemote_Init()?");
+    bool connected = bd->ViewerSocket != IMGUI_IMPL_REMOTE_INVALID_SOCKET;
+    return ImGui_ImplRemote_WaitReadable(connected ? bd->ViewerSocket : bd->ListenSocket, timeout_seconds);
+}
+
+bool ImGui_ImplRemote_IsViewerConnected()
+{
+    ImGui_ImplRemote_Data* bd = g_RemoteData;
+    return bd != NULL && bd->ViewerSocket != IMGUI_IMPL_REMOTE_INVALID_SOCKET;
+}
+
+void ImGui_ImplRemote_GetStats(ImGui_ImplRemote_Stats* out_stats)
+{
+    ImGui_ImplRemote_Data* bd = g_RemoteData;
+    IM_ASSERT(bd != NULL && "Did you call ImGui_ImplRemote_Init()?");
+    *out_stats = bd->Stats;
+}
+
+//-----------------------------------------------------------------------------
+// Viewer
+//-----------------------------------------------------------------------------
+
+struct ImGui_ImplRemote_Client
+{
+    ImGui_ImplRemote_Socket Socket;
+    bool                    HelloReceived;
+
+    ImVector<unsigned char> RecvBuffer;
+    ImVector<unsigned char> SendBuffer;
+    int                     SendOffset;
+
+    // Last decoded frame (delta base), and next frame being decoded
+    ImVector<ImDrawList*>   Lists;
+    ImVector<ImDrawList*>   NextLists;
+    int                     ListsCount;
+    ImDrawData              DrawData;
+    ImTextureID             TextureId;
+    ImGuiMouseCursor        MouseCursor;
+
+    ImVector<unsigned int>  AtlasPixels;
+    int                     AtlasWidth, AtlasHeight;
+    bool                    AtlasChanged;
+
+    ImGui_ImplRemote_Input  SentInput;
+    bool                    InputSent;
+
+    ImGui_ImplRemote_Client()
+    {
+        Socket = IMGUI_IMPL_REMOTE_INVALID_SOCKET;
+        HelloReceived = false;
+        SendOffset = 0;
+        ListsCount = 0;
+        TextureId = NULL;
+        MouseCursor = ImGuiMouseCursor_Arrow;
+        AtlasWidth = AtlasHeight = 0;
+        AtlasChanged = false;
+        InputSent = false;
+    }
+};
+
+ImGui_ImplRemote_Client* ImGui_ImplRemote_Connect(const char* address)
+{
+    if (!ImGui_ImplRemote_SocketsInit())
+        return NULL;
+    bool tcp = false;
+    ImGui_ImplRemote_Socket s = ImGui_ImplRemote_OpenSocket(address, false, &tcp, NULL, 0);
+    if (s == IMGUI_IMPL_REMOTE_INVALID_SOCKET)
+    {
+        ImGui_ImplRemote_SocketsShutdown();
+        return NULL;
+    }
+    ImGui_ImplRemote_SetupStream(s, tcp);
+
+    ImGui_ImplRemote_Client* client = IM_NEW(ImGui_ImplRemote_Client)();
+    client->Socket = s;
+    return client;
+}
+
+static void ImGui_ImplRemote_CloseClient(ImGui_ImplRemote_Client* client)
+{
+    if (client->Socket != IMGUI_IMPL_REMOTE_INVALID_SOCKET)
+        ImGui_ImplRemote_CloseSocket(client->Socket);
+    client->Socket = IMGUI_IMPL_REMOTE_INVALID_SOCKET;
+}
+
+void ImGui_ImplRemote_Disconnect(ImGui_ImplRemote_Client* client)
+{
+    if (client == NULL)
+        return;
+    ImGui_ImplRemote_CloseClient(client);
+    for (int i = 0; i < client->Lists.Size; i++)
+        IM_DELETE(client->Lists[i]);
+    for (int i = 0; i < client->NextLists.Size; i++)
+        IM_DELETE(client->NextLists[i]);
+    IM_DELETE(client);
+    ImGui_ImplRemote_SocketsShutdown();
+}
+
+bool ImGui_ImplRemote_IsConnected(ImGui_ImplRemote_Client* client)
+{
+    return client != NULL && client->Socket != IMGUI_IMPL_REMOTE_INVALID_SOCKET;
+}
+
+static bool ImGui_ImplRemote_DecodeHello(ImGui_ImplRemote_Client* client, const unsigned char* payload, int size)
+{
+    ImGui_ImplRemote_Reader r(payload, size);
+    bool magic_ok = r.GetU8() == 'I' && r.GetU8() == 'M' && r.GetU8() == 'R' && r.GetU8() == 'M';
+    bool version_ok = r.GetU32() == IMGUI_IMPL_REMOTE_VERSION;
+    bool layout_ok = r.GetU32() == sizeof(ImDrawVert) && r.GetU32() == sizeof(ImDrawIdx);
+    client->HelloReceived = r.Ok && magic_ok && version_ok && layout_ok;
+    return client->HelloReceived;
+}
+
+static bool ImGui_ImplRemote_DecodeAtlas(ImGui_ImplRemote_Client* client, const unsigned char* payload, int size)
+{
+    ImGui_ImplRemote_Reader r(payload, size);
+    ImU32 width = r.GetU32();
+    ImU32 height = r.GetU32();
+    if (!r.Ok || width > 32768 || height > 32768)
+        return false;
+    client->AtlasPixels.resize((int)(width * height));
+    if (!r.GetXorRuns((unsigned char*)client->AtlasPixels.Data, (int)(width * height * 4), NULL, 0))
+        return false;
+    client->AtlasWidth = (int)width;
+    client->AtlasHeight = (int)height;
+    client->AtlasChanged = true;
+    return true;
+}
+
+static bool ImGui_ImplRemote_DecodeFrame(ImGui_ImplRemote_Client* client, const unsigned char* payload, int size)
+{
+    ImGui_ImplRemote_Reader r(payload, size);
+    ImGuiMouseCursor mouse_cursor = (ImGuiMouseCursor)r.GetU8() - 1;
+    ImVec2 display_pos, display_size, framebuffer_scale;
+    display_pos.x = r.GetFloat();
+    display_pos.y = r.GetFloat();
+    display_size.x = r.GetFloat();
+    display_size.y = r.GetFloat();
+    framebuffer_scale.x = r.GetFloat();
+    framebuffer_scale.y = r.GetFloat();
+    int lists_count = r.GetCount(size);
+    if (!r.Ok)
+        return false;
+
+    while (client->NextLists.Size < lists_count)
+        client->NextLists.push_back(IM_NEW(ImDrawList)(ImGui::GetDrawListSharedData()));
+
+    for (int n = 0; n < lists_count; n++)
+    {
+        ImDrawList* dst = client->NextLists[n];
+        if (r.GetVarint() == 0)
+        {
+            int match = r.GetCount(client->ListsCount - 1);
+            if (!r.Ok || client->ListsCount == 0)
+                return false;
+            const ImDrawList* src = client->Lists[match];
+            dst->CmdBuffer = src->CmdBuffer;
+            dst->VtxBuffer = src->VtxBuffer;
+            dst->IdxBuffer = src->IdxBuffer;
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+            dst->VtxOrigin = src->VtxOrigin;
+#endif
+            continue;
+        }
+
+        int vtx_count = r.GetCount(IMGUI_IMPL_REMOTE_MAX_ELEMENTS);
+        int idx_count = r.GetCount(IMGUI_IMPL_REMOTE_MAX_ELEMENTS);
+        int cmd_count = r.GetCount(size);
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+        dst->VtxOrigin.x = r.GetFloat();
+        dst->VtxOrigin.y = r.GetFloat();
+#endif
+        if (!r.Ok)
+            return false;
+        dst->CmdBuffer.resize(cmd_count);
+        for (int cmd_i = 0; cmd_i < cmd_count; cmd_i++)
+        {
+            ImDrawCmd* pcmd = &dst->CmdBuffer[cmd_i];
+            *pcmd = ImDrawCmd();
+            pcmd->ClipRect.x = r.GetFloat();
+            pcmd->ClipRect.y = r.GetFloat();
+            pcmd->ClipRect.z = r.GetFloat();
+            pcmd->ClipRect.w = r.GetFloat();
+            pcmd->VtxOffset = (unsigned int)r.GetCount(vtx_count);
+            pcmd->IdxOffset = (unsigned int)r.GetCount(idx_count);
+            pcmd->ElemCount = (unsigned int)r.GetCount(idx_count - (int)pcmd->IdxOffset);
+        }
+
+        const ImDrawList* base = n < client->ListsCount ? client->Lists[n] : NULL;
+        dst->VtxBuffer.resize(vtx_count);
+        dst->IdxBuffer.resize(idx_count);
+        if (!r.GetXorRuns((unsigned char*)dst->VtxBuffer.Data, dst->VtxBuffer.size_in_bytes(), base ? (const unsigned char*)base->VtxBuffer.Data : NULL, base ? base->VtxBuffer.size_in_bytes() : 0))
+            return false;
+        if (!r.GetXorRuns((unsigned char*)dst->IdxBuffer.Data, dst->IdxBuffer.size_in_bytes(), base ? (const unsigned char*)base->IdxBuffer.Data : NULL, base ? base->IdxBuffer.size_in_bytes() : 0))
+            return false;
+
+        // Indices out of range would read past the vertex buffer in the renderer
+        for (int cmd_i = 0; cmd_i < cmd_count; cmd_i++)
+        {
+            const ImDrawCmd* pcmd = &dst->CmdBuffer[cmd_i];
+            for (unsigned int i = pcmd->IdxOffset; i < pcmd->IdxOffset + pcmd->ElemCount; i++)
+                if (pcmd->VtxOffset + dst->IdxBuffer[(int)i] >= (unsigned int)vtx_count)
+                    return false;
+        }
+    }
+
+    client->Lists.swap(client->NextLists);
+    client->ListsCount = lists_count;
+    client->MouseCursor = mouse_cursor;
+
+    ImDrawData* draw_data = &client->DrawData;
+    draw_data->Clear();
+    draw_data->Valid = true;
+    draw_data->CmdLists = client->Lists.Data;
+    draw_data->CmdListsCount = lists_count;
+    draw_data->DisplayPos = display_pos;
+    draw_data->DisplaySize = display_size;
+    draw_data->FramebufferScale = framebuffer_scale;
+    draw_data->OwnerViewport = ImGui::GetMainViewport();
+    for (int n = 0; n < lists_count; n++)
+    {
+        draw_data->TotalVtxCount += client->Lists[n]->VtxBuffer.Size;
+        draw_data->TotalIdxCount += client->Lists[n]->IdxBuffer.Size;
+    }
+    return true;
+}
+
+ImDrawData* ImGui_ImplRemote_ReceiveFrame(ImGui_ImplRemote_Client* client, double timeout_seconds)
+{
+    if (!ImGui_ImplRemote_IsConnected(client))
+        return NULL;
+
+    if (!ImGui_ImplRemote_Flush(client->Socket, client->SendBuffer, &client->SendOffset, NULL))
+    {
+        ImGui_ImplRemote_CloseClient(client);
+        return NULL;
+    }
+    if (timeout_seconds > 0.0)
+        ImGui_ImplRemote_WaitReadable(client->Socket, timeout_seconds);
+    bool ok = ImGui_ImplRemote_Receive(client->Socket, client->RecvBuffer);
+
+    // Every frame is decoded to keep the delta base in step, only the latest one is returned
+    bool new_frame = false;
+    int offset = 0;
+    char type;
+    const unsigned char* payload;
+    int size;
+    bool error = false;
+    while (ok && ImGui_ImplRemote_NextMessage(client->RecvBuffer, &offset, &type, &payload, &size, &error))
+    {
+        if (type == 'H')
+            ok = ImGui_ImplRemote_DecodeHello(client, payload, size);
+        else if (!client->HelloReceived)
+            ok = false;
+        else if (type == 'A')
+            ok = ImGui_ImplRemote_DecodeAtlas(client, payload, size);
+        else if (type == 'F')
+            ok = new_frame = ImGui_ImplRemote_DecodeFrame(client, payload, size);
+    }
+    ImGui_ImplRemote_Consume(client->RecvBuffer, offset);
+
+    if (!ok || error)
+    {
+        ImGui_ImplRemote_CloseClient(client);
+        return NULL;
+    }
+    if (!new_frame)
+        return NULL;
+
+    for (int n = 0; n < client->ListsCount; n++)
+        for (int cmd_i = 0; cmd_i < client->Lists[n]->CmdBuffer.Size; cmd_i++)
+            client->Lists[n]->CmdBuffer[cmd_i].TextureId = client->TextureId;
+    return &client->DrawData;
+}
+
+bool ImGui_ImplRemote_GetFontAtlas(ImGui_ImplRemote_Client* client, const unsigned int** out_pixels, int* out_width, int* out_height, bool* out_changed)
+{
+    if (out_changed)
+        *out_changed = client->AtlasChanged;
+    client->AtlasChanged = false;
+    if (client->AtlasWidth == 0 || client->AtlasHeight == 0)
+        return false;
+    *out_pixels = client->AtlasPixels.Data;
+    *out_width = client->AtlasWidth;
+    *out_height = client->AtlasHeight;
+    return true;
+}
+
+void ImGui_ImplRemote_SetTextureID(ImGui_ImplRemote_Client* client, ImTextureID texture_id)
+{
+    client->TextureId = texture_id;
+}
+
+ImGuiMouseCursor ImGui_ImplRemote_GetMouseCursor(ImGui_ImplRemote_Client* client)
+{
+    return client->MouseCursor;
+}
+
+void ImGui_ImplRemote_SendInput(ImGui_ImplRemote_Client* client, ImGuiIO& io)
+{
+    if (!ImGui_ImplRemote_IsConnected(client))
+        return;
+
+    ImGui_ImplRemote_Input input;
+    input.MousePos = io.MousePos;
+    for (int i = 0; i < IM_ARRAYSIZE(io.MouseDown) && i < 32; i++)
+        if (io.MouseDown[i])
+            input.MouseButtons |= 1u << i;
+    input.MouseWheel = ImVec2(io.MouseWheelH, io.MouseWheel);
+    for (int key = 0; key < ImGuiKey_COUNT && key < 32; key++)
+    {
+        int index = io.KeyMap[key];
+        if (index >= 0 && index < IM_ARRAYSIZE(io.KeysDown) && io.KeysDown[index])
+            input.Keys |= 1u << key;
+    }
+    input.Mods = (io.KeyCtrl ? ImGuiKeyModFlags_Ctrl : 0) | (io.KeyShift ? ImGuiKeyModFlags_Shift : 0) |
+                 (io.KeyAlt ? ImGuiKeyModFlags_Alt : 0) | (io.KeySuper ? ImGuiKeyModFlags_Super : 0);
+    input.DisplaySize = io.DisplaySize;
+    input.FramebufferScale = io.DisplayFramebufferScale;
+
+    const ImGui_ImplRemote_Input& sent = client->SentInput;
+    bool changed = !client->InputSent || input.MouseWheel.x != 0.0f || input.MouseWheel.y != 0.0f || io.InputQueueCharacters.Size > 0 ||
+                   input.MousePos.x != sent.MousePos.x || input.MousePos.y != sent.MousePos.y || input.MouseButtons != sent.MouseButtons ||
+                   input.Keys != sent.Keys || input.Mods != sent.Mods ||
+                   input.DisplaySize.x != sent.DisplaySize.x || input.DisplaySize.y != sent.DisplaySize.y ||
+                   input.FramebufferScale.x != sent.FramebufferScale.x || input.FramebufferScale.y != sent.FramebufferScale.y;
+    if (!changed)
+        return;
+
+    ImVector<unsigned char>& buf = client->SendBuffer;
+    int payload_offset = ImGui_ImplRemote_BeginMessage(buf, 'I');
+    ImGui_ImplRemote_PutFloat(buf, input.MousePos.x);
+    ImGui_ImplRemote_PutFloat(buf, input.MousePos.y);
+    ImGui_ImplRemote_PutU32(buf, input.MouseButtons);
+    ImGui_ImplRemote_PutFloat(buf, input.MouseWheel.x);
+    ImGui_ImplRemote_PutFloat(buf, input.MouseWheel.y);
+    ImGui_ImplRemote_PutU32(buf, input.Keys);
+    ImGui_ImplRemote_PutU32(buf, input.Mods);
+    ImGui_ImplRemote_PutFloat(buf, input.DisplaySize.x);
+    ImGui_ImplRemote_PutFloat(buf, input.DisplaySize.y);
+    ImGui_ImplRemote_PutFloat(buf, input.FramebufferScale.x);
+    ImGui_ImplRemote_PutFloat(buf, input.FramebufferScale.y);
+    ImGui_ImplRemote_PutVarint(buf, (ImU64)io.InputQueueCharacters.Size);
+    for (int i = 0; i < io.InputQueueCharacters.Size; i++)
+        ImGui_ImplRemote_PutVarint(buf, (ImU64)io.InputQueueCharacters[i]);
+    ImGui_ImplRemote_EndMessage(buf, payload_offset);
+
+    client->SentInput = input;
+    client->InputSent = true;
+    io.MouseWheel = io.MouseWheelH = 0.0f;
+    io.InputQueueCharacters.resize(0);
+
+    if (!ImGui_ImplRemote_Flush(client->Socket, client->SendBuffer, &client->SendOffset, NULL))
+        ImGui_ImplRemote_CloseClient(client);
+}
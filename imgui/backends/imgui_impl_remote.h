@@ -0,0 +1,74 @@
+// dear imgui: Remote Platform + Renderer Backend, streams ImDrawData to a viewer over a TCP or Unix socket
+// (Headless servers: the UI runs on the server, a thin viewer renders the received draw lists with any renderer backend and sends input back)
+
+// Implemented features:
+//  [X] Renderer: Delta frames. Draw lists unchanged since the previous frame are sent as a reference, changed vertex/index buffers are XOR'ed against the previous frame and zero run encoded.
+//  [X] Renderer: A slow viewer never stalls the server. While the previous frame is still being sent new frames are dropped.
+//  [X] Platform: Mouse position/buttons/wheel, ImGuiKey_ keys, modifiers, text input, display size and mouse cursor shape from the viewer.
+//  [X] Platform: Runs alone on a headless server (becomes the platform + renderer backend), or alongside local backends to mirror a window.
+// Missing features:
+//  [ ] Renderer: User textures. Every ImTextureID is drawn with the font atlas on the viewer. User callbacks are not sent.
+//  [ ] Platform: Clipboard, gamepad, multi-viewport. Raw keys outside of the ImGuiKey_ enum are not forwarded.
+//  [ ] Platform: One viewer at a time, one server per process.
+//  [ ] No authentication or encryption. Listen on loopback or a Unix socket and tunnel (e.g. 'ssh -L') across networks.
+
+// You can copy and use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
+// If you are new to Dear ImGui, read documentation from the docs/ folder + read the top of imgui.cpp.
+// Read online: https://github.com/ocornut/imgui/tree/master/docs
+
+// Addresses:
+//  "tcp:7007"              Server: listen on 127.0.0.1:7007. Viewer: connect to localhost:7007.
+//  "tcp:0.0.0.0:7007"      Server: listen on all interfaces.
+//  "tcp:host:7007"         Viewer: connect to host:7007.
+//  "unix:/tmp/imgui.sock"  Unix domain socket (not available on Windows).
+
+#pragma once
+#include "imgui.h"      // IMGUI_IMPL_API
+
+//-----------------------------------------------------------------------------
+// Server
+//-----------------------------------------------------------------------------
+
+struct ImGui_ImplRemote_Stats
+{
+    int         FramesSent;
+    int         FramesDropped;      // Frames not sent because the viewer hadn't received the previous one yet
+    int         ListsSent;          // Draw lists sent with their vertex/index data
+    int         ListsSkipped;       // Draw lists sent as a reference to an unchanged draw list of the previous frame
+    ImU64       RawBytes;           // Vertex/index/command bytes of sent frames, before any compression
+    ImU64       SentBytes;          // Bytes written to the socket
+};
+
+// When no platform backend is initialized yet, the remote backend becomes the platform + renderer backend:
+// NewFrame() sets io.DisplaySize from the viewer window and io.DeltaTime.
+IMGUI_IMPL_API bool     ImGui_ImplRemote_Init(const char* address);
+IMGUI_IMPL_API void     ImGui_ImplRemote_Shutdown();
+IMGUI_IMPL_API void     ImGui_ImplRemote_NewFrame();                                // Accept a viewer, apply its input. Call after the local platform NewFrame, if any.
+IMGUI_IMPL_API void     ImGui_ImplRemote_RenderDrawData(ImDrawData* draw_data);     // Queue the frame to the viewer, if any
+IMGUI_IMPL_API bool     ImGui_ImplRemote_WaitEvents(double timeout_seconds);        // Block until a viewer connects, input arrives or timeout. Returns true on activity.
+IMGUI_IMPL_API bool     ImGui_ImplRemote_IsViewerConnected();
+IMGUI_IMPL_API void     ImGui_ImplRemote_GetStats(ImGui_ImplRemote_Stats* out_stats);
+
+//-----------------------------------------------------------------------------
+// Viewer
+//-----------------------------------------------------------------------------
+// The viewer runs its own Dear ImGui context with a platform + renderer backend, without calling ImGui::NewFrame():
+// the platform backend fills the viewer io with input, received frames are passed to the renderer backend.
+
+struct ImGui_ImplRemote_Client;
+
+IMGUI_IMPL_API ImGui_ImplRemote_Client* ImGui_ImplRemote_Connect(const char* address);  // NULL on failure
+IMGUI_IMPL_API void     ImGui_ImplRemote_Disconnect(ImGui_ImplRemote_Client* client);
+IMGUI_IMPL_API bool     ImGui_ImplRemote_IsConnected(ImGui_ImplRemote_Client* client);
+
+// Decode everything received, waiting up to timeout_seconds for data. Returns the latest frame, or NULL if no new frame arrived.
+// The ImDrawData stays valid until the next call. Uses the current context ImDrawListSharedData.
+IMGUI_IMPL_API ImDrawData* ImGui_ImplRemote_ReceiveFrame(ImGui_ImplRemote_Client* client, double timeout_seconds = 0.0);
+
+// Font atlas of the server, 32-bit RGBA as returned by ImFontAtlas::GetTexDataAsRGBA32(). 'out_changed' is set once per new atlas.
+IMGUI_IMPL_API bool     ImGui_ImplRemote_GetFontAtlas(ImGui_ImplRemote_Client* client, const unsigned int** out_pixels, int* out_width, int* out_height, bool* out_changed);
+IMGUI_IMPL_API void     ImGui_ImplRemote_SetTextureID(ImGui_ImplRemote_Client* client, ImTextureID texture_id);    // Written into every received ImDrawCmd
+IMGUI_IMPL_API ImGuiMouseCursor ImGui_ImplRemote_GetMouseCursor(ImGui_ImplRemote_Client* client);
+
+// Send the viewer input state from 'io', filled by the viewer platform backend. Clears io.MouseWheel/MouseWheelH and queued characters.
+IMGUI_IMPL_API void     ImGui_ImplRemote_SendInput(ImGui_ImplRemote_Client* client, ImGuiIO& io);
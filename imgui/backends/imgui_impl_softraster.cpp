@@ -0,0 +1,798 @@
+// dear imgui: Renderer Backend for CPU software rasterization into a 32-bit RGBA framebuffer
+// (No GPU or graphics API needed: headless servers, remote viewing, regression screenshots, report generation)
+
+// Implemented features:
+//  [X] Renderer: User texture binding. Use 'ImGui_ImplSoftRaster_Texture*' as ImTextureID. Read the FAQ about ImTextureID!
+//  [X] Renderer: Support for large meshes (64k+ vertices) with 16-bit indices.
+//  [X] Renderer: Multi-threaded. Primitives are binned into screen tiles, tiles are rasterized in parallel by a worker pool.
+//  [X] Renderer: Partial redraw of ImDrawData::DamageRects with ImGui_ImplSoftRaster_RenderDrawDataDamaged().
+// Missing features:
+//  [ ] Renderer: Multi-viewport support (multiple windows).
+//  [ ] Renderer: Textures are point sampled, no bilinear filtering.
+//  [ ] Renderer: User callbacks are called in order while primitives are binned, before any pixel is written. They can't draw into the framebuffer.
+
+// You can copy and use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
+// If you are new to Dear ImGui, read documentation from the docs/ folder + read the top of imgui.cpp.
+// Read online: https://github.com/ocornut/imgui/tree/master/docs
+
+// How it works:
+// - RenderDrawData() transforms every ImDrawCmd into framebuffer space primitives. Index patterns (a,b,c,a,c,d) forming an axis aligned
+//   rectangle with a single color and axis aligned UV are kept as one rectangle primitive (frame backgrounds, buttons, every glyph of text),
+//   everything else is a triangle.
+// - Primitives are bucketed into IMGUI_IMPL_SOFTRASTER_TILE_SIZE screen tiles with a counting sort, preserving submission order in each tile.
+// - Each tile is owned by a single thread which walks its primitives in order, so output doesn't depend on the number of threads.
+// - Triangles are rasterized with edge functions evaluated 4 pixels at a time (SSE2 when available), with a consistent tie-breaking rule
+//   on shared edges. Rectangles are filled row by row without edge tests.
+// - Blending matches the other backends: rgb = src.rgb * src.a + dst.rgb * (1 - src.a), a = src.a + dst.a * (1 - src.a).
+
+// CHANGELOG
+//  2026-10-18: Added ImGui_ImplSoftRaster_RenderDrawDataDamaged() for partial redraw with io.ConfigDamageTracking.
+//  2026-10-18: Support IMGUI_USE_COMPACT_DRAWVERT vertices.
+//  2026-10-18: Initial version.
+
+#include "imgui.h"
+#include "imgui_impl_softraster.h"
+#include <string.h>
+#include <math.h>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define IMGUI_IMPL_SOFTRASTER_SSE2
+#include <emmintrin.h>
+#endif
+
+// Tile edge in pixels. Smaller tiles balance better across threads, larger tiles bin each primitive fewer times.
+#ifndef IMGUI_IMPL_SOFTRASTER_TILE_SIZE
+#define IMGUI_IMPL_SOFTRASTER_TILE_SIZE 64
+#endif
+
+// Primitive in framebuffer space
+struct ImGui_ImplSoftRaster_Prim
+{
+    ImVec2      Pos[3];             // Rect: Pos[0]/Pos[1] are opposite corners
+    ImVec2      Uv[3];              // Rect: Uv[0]/Uv[1] at Pos[0]/Pos[1]
+    ImU32       Col[3];             // Rect: Col[0] only
+    int         X0, Y0, X1, Y1;     // Pixel bounds intersected with the scissor rectangle, max exclusive
+    const ImGui_ImplSoftRaster_Texture* Texture;
+    bool        IsRect;
+    bool        UvConst;            // Same UV on every vertex: sample the texture once
+    bool        ColConst;           // Same color on every vertex: no color interpolation
+};
+
+// Software rasterizer data
+struct ImGui_ImplSoftRaster_Data
+{
+    ImGui_ImplSoftRaster_Texture        FontTexture;
+    unsigned int*                       FontPixels;
+
+    // Current frame
+    ImVector<ImGui_ImplSoftRaster_Prim> Prims;
+    ImVector<int>                       TileOffsets;    // TilesX * TilesY + 1 offsets into TilePrims
+    ImVector<int>                       TilePrims;      // Primitive indices, grouped by tile, in submission order
+    int                                 TilesX, TilesY;
+    unsigned int*                       Pixels;
+    int                                 Width, Height, Pitch;
+
+    // Worker pool. The calling thread rasterizes tiles too, ThreadsCount - 1 workers are spawned.
+    ImVector<std::thread*>              Workers;
+    std::mutex                          Mutex;
+    std::condition_variable             WakeCond;
+    std::condition_variable             DoneCond;
+    unsigned int                        JobGeneration;
+    int                                 JobBusyWorkers;
+    bool                                Quit;
+    std::atomic<int>                    NextTile;
+
+    ImGui_ImplSoftRaster_Data()
+    {
+        memset(&FontTexture, 0, sizeof(FontTexture));
+        FontPixels = NULL;
+        TilesX = TilesY = 0;
+        Pixels = NULL;
+        Width = Height = Pitch = 0;
+        JobGeneration = 0;
+        JobBusyWorkers = 0;
+        Quit = false;
+        NextTile = 0;
+    }
+};
+
+template<typename T> static inline T ImGui_ImplSoftRaster_Min(T a, T b) { return a < b ? a : b; }
+template<typename T> static inline T ImGui_ImplSoftRaster_Max(T a, T b) { return a >= b ? a : b; }
+template<typename T> static inline void ImGui_ImplSoftRaster_Swap(T& a, T& b) { T tmp = a; a = b; b = tmp; }
+
+// Backend data stored in io.BackendRendererUserData to allow support for multiple Dear ImGui contexts
+// It is STRONGLY preferred that you use docking branch with multi-viewports (== single Dear ImGui context + multiple windows) instead of multiple Dear ImGui contexts.
+static ImGui_ImplSoftRaster_Data* ImGui_ImplSoftRaster_GetBackendData()
+{
+    return ImGui::GetCurrentContext() ? (ImGui_ImplSoftRaster_Data*)ImGui::GetIO().BackendRendererUserData : NULL;
+}
+
+//-----------------------------------------------------------------------------
+// Pixel operations
+//-----------------------------------------------------------------------------
+
+// Exact round(a * b / 255) on two 8-bit lanes packed as 0x00AA00BB
+static inline ImU32 ImGui_ImplSoftRaster_Div255x2(ImU32 x)
+{
+    x += 0x00800080;
+    return ((x + ((x >> 8) & 0x00FF00FF)) >> 8) & 0x00FF00FF;
+}
+
+// Per channel col * tex / 255
+static inline ImU32 ImGui_ImplSoftRaster_Modulate(ImU32 col, ImU32 tex)
+{
+    if (tex == 0xFFFFFFFF)
+        return col;
+    ImU32 rb = ((col & 0xFF) * (tex & 0xFF)) | ((((col >> 16) & 0xFF) * ((tex >> 16) & 0xFF)) << 16);
+    ImU32 ga = (((col >> 8) & 0xFF) * ((tex >> 8) & 0xFF)) | (((col >> 24) * (tex >> 24)) << 16);
+    return ImGui_ImplSoftRaster_Div255x2(rb) | (ImGui_ImplSoftRaster_Div255x2(ga) << 8);
+}
+
+static inline void ImGui_ImplSoftRaster_Blend(unsigned int* dst, ImU32 src)
+{
+    ImU32 sa = src >> 24;
+    if (sa == 0)
+        return;
+    if (sa == 255)
+    {
+        *dst = src;
+        return;
+    }
+    ImU32 ia = 255 - sa;
+    ImU32 d = *dst;
+    ImU32 rb = (src & 0x00FF00FF) * sa + (d & 0x00FF00FF) * ia;
+    ImU32 ga = (((src >> 8) & 0xFF) | 0x00FF0000) * sa + ((d >> 8) & 0x00FF00FF) * ia;  // Source alpha lane weighted by 255, not by itself
+    *dst = ImGui_ImplSoftRaster_Div255x2(rb) | (ImGui_ImplSoftRaster_Div255x2(ga) << 8);
+}
+
+static inline ImU32 ImGui_ImplSoftRaster_Sample(const ImGui_ImplSoftRaster_Texture* tex, float u, float v)
+{
+    if (tex == NULL)
+        return 0xFFFFFFFF;
+    int x = (int)(u * tex->Width);
+    int y = (int)(v * tex->Height);
+    x = (x < 0) ? 0 : (x >= tex->Width) ? tex->Width - 1 : x;
+    y = (y < 0) ? 0 : (y >= tex->Height) ? tex->Height - 1 : y;
+    return tex->Pixels[y * tex->Width + x];
+}
+
+//-----------------------------------------------------------------------------
+// Rasterization
+//-----------------------------------------------------------------------------
+
+static void ImGui_ImplSoftRaster_RasterRect(ImGui_ImplSoftRaster_Data* bd, const ImGui_ImplSoftRaster_Prim* prim, int x0, int y0, int x1, int y1)
+{
+    const ImGui_ImplSoftRaster_Texture* tex = prim->Texture;
+    ImU32 col = prim->Col[0];
+    unsigned int* row = bd->Pixels + y0 * bd->Pitch;
+
+    // Solid fill: one texel for the whole rectangle
+    if (prim->UvConst)
+    {
+        ImU32 src = ImGui_ImplSoftRaster_Modulate(col, ImGui_ImplSoftRaster_Sample(tex, prim->Uv[0].x, prim->Uv[0].y));
+        if ((src >> 24) == 0)
+            return;
+        for (int y = y0; y < y1; y++, row += bd->Pitch)
+        {
+            if ((src >> 24) == 255)
+                for (int x = x0; x < x1; x++)
+                    row[x] = src;
+            else
+                for (int x = x0; x < x1; x++)
+                    ImGui_ImplSoftRaster_Blend(&row[x], src);
+        }
+        return;
+    }
+
+    // Textured (glyphs, images): UV is linear along each axis, the texel row is fixed per pixel row
+    const float du = (prim->Uv[1].x - prim->Uv[0].x) / (prim->Pos[1].x - prim->Pos[0].x);
+    const float dv = (prim->Uv[1].y - prim->Uv[0].y) / (prim->Pos[1].y - prim->Pos[0].y);
+    const float u0 = prim->Uv[0].x + ((float)x0 + 0.5f - prim->Pos[0].x) * du;
+    for (int y = y0; y < y1; y++, row += bd->Pitch)
+    {
+        const float v = prim->Uv[0].y + ((float)y + 0.5f - prim->Pos[0].y) * dv;
+        if (tex == NULL)
+        {
+            for (int x = x0; x < x1; x++)
+                ImGui_ImplSoftRaster_Blend(&row[x], col);
+            continue;
+        }
+        int ty = (int)(v * tex->Height);
+        ty = (ty < 0) ? 0 : (ty >= tex->Height) ? tex->Height - 1 : ty;
+        const unsigned int* tex_row = tex->Pixels + ty * tex->Width;
+        for (int x = x0; x < x1; x++)
+        {
+            int tx = (int)((u0 + (float)(x - x0) * du) * tex->Width);
+            tx = (tx < 0) ? 0 : (tx >= tex->Width) ? tex->Width - 1 : tx;
+            ImU32 texel = tex_row[tx];
+            if (texel >> 24)
+                ImGui_ImplSoftRaster_Blend(&row[x], ImGui_ImplSoftRaster_Modulate(col, texel));
+        }
+    }
+}
+
+// Edge function E(p) = A * p.x + B * p.y + C, positive inside a triangle with positive area.
+// Pixels exactly on an edge belong to the triangle where (A > 0 || (A == 0 && B > 0)), so a pixel on an edge shared by two triangles is drawn once.
+struct ImGui_ImplSoftRaster_Edge
+{
+    float A, B, C;
+    bool  Inclusive;
+
+    void Setup(const ImVec2& a, const ImVec2& b)
+    {
+        A = a.y - b.y;
+        B = b.x - a.x;
+        C = -(A * a.x + B * a.y);
+        Inclusive = (A > 0.0f) || (A == 0.0f && B > 0.0f);
+    }
+};
+
+static void ImGui_ImplSoftRaster_ShadeTrianglePixel(unsigned int* dst, const ImGui_ImplSoftRaster_Prim* prim, ImU32 src_const, const float* c0, const float* dc1, const float* dc2, float b1, float b2)
+{
+    if (prim->ColConst && prim->UvConst)
+    {
+        ImGui_ImplSoftRaster_Blend(dst, src_const);
+        return;
+    }
+
+    ImU32 col = prim->Col[0];
+    if (!prim->ColConst)
+    {
+        int r = (int)(c0[0] + b1 * dc1[0] + b2 * dc2[0] + 0.5f);
+        int g = (int)(c0[1] + b1 * dc1[1] + b2 * dc2[1] + 0.5f);
+        int b = (int)(c0[2] + b1 * dc1[2] + b2 * dc2[2] + 0.5f);
+        int a = (int)(c0[3] + b1 * dc1[3] + b2 * dc2[3] + 0.5f);
+        r = (r < 0) ? 0 : (r > 255) ? 255 : r;
+        g = (g < 0) ? 0 : (g > 255) ? 255 : g;
+        b = (b < 0) ? 0 : (b > 255) ? 255 : b;
+        a = (a < 0) ? 0 : (a > 255) ? 255 : a;
+        col = IM_COL32(r, g, b, a);
+    }
+
+    ImU32 texel;
+    if (prim->UvConst)
+        texel = src_const;
+    else
+        texel = ImGui_ImplSoftRaster_Sample(prim->Texture,
+            prim->Uv[0].x + b1 * (prim->Uv[1].x - prim->Uv[0].x) + b2 * (prim->Uv[2].x - prim->Uv[0].x),
+            prim->Uv[0].y + b1 * (prim->Uv[1].y - prim->Uv[0].y) + b2 * (prim->Uv[2].y - prim->Uv[0].y));
+    ImGui_ImplSoftRaster_Blend(dst, ImGui_ImplSoftRaster_Modulate(col, texel));
+}
+
+static void ImGui_ImplSoftRaster_RasterTriangle(ImGui_ImplSoftRaster_Data* bd, const ImGui_ImplSoftRaster_Prim* prim_in, int x0, int y0, int x1, int y1)
+{
+    // Orient counter-clockwise (positive area), swapping vertices 1 and 2 keeps barycentric weights tied to the right attributes
+    ImGui_ImplSoftRaster_Prim prim = *prim_in;
+    float area = (prim.Pos[1].x - prim.Pos[0].x) * (prim.Pos[2].y - prim.Pos[0].y) - (prim.Pos[1].y - prim.Pos[0].y) * (prim.Pos[2].x - prim.Pos[0].x);
+    if (area == 0.0f)
+        return;
+    if (area < 0.0f)
+    {
+        ImGui_ImplSoftRaster_Swap(prim.Pos[1], prim.Pos[2]);
+        ImGui_ImplSoftRaster_Swap(prim.Uv[1], prim.Uv[2]);
+        ImGui_ImplSoftRaster_Swap(prim.Col[1], prim.Col[2]);
+        area = -area;
+    }
+    const float inv_area = 1.0f / area;
+
+    ImGui_ImplSoftRaster_Edge e0, e1, e2;
+    e0.Setup(prim.Pos[1], prim.Pos[2]);    // Weight of vertex 0
+    e1.Setup(prim.Pos[2], prim.Pos[0]);    // Weight of vertex 1
+    e2.Setup(prim.Pos[0], prim.Pos[1]);    // Weight of vertex 2
+
+    // Constant source color, or constant texel when only the color varies (anti-aliased fringes)
+    ImU32 src_const = 0;
+    if (prim.UvConst)
+    {
+        src_const = ImGui_ImplSoftRaster_Sample(prim.Texture, prim.Uv[0].x, prim.Uv[0].y);
+        if (prim.ColConst)
+            src_const = ImGui_ImplSoftRaster_Modulate(prim.Col[0], src_const);
+    }
+    float c0[4], dc1[4], dc2[4];
+    for (int n = 0; n < 4; n++)
+    {
+        c0[n] = (float)((prim.Col[0] >> (n * 8)) & 0xFF);
+        dc1[n] = (float)((prim.Col[1] >> (n * 8)) & 0xFF) - c0[n];
+        dc2[n] = (float)((prim.Col[2] >> (n * 8)) & 0xFF) - c0[n];
+    }
+
+    unsigned int* row = bd->Pixels + y0 * bd->Pitch;
+#ifdef IMGUI_IMPL_SOFTRASTER_SSE2
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 lane_offsets = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+    const __m128 a0 = _mm_set1_ps(e0.A), a1 = _mm_set1_ps(e1.A), a2 = _mm_set1_ps(e2.A);
+    const __m128 incl0 = _mm_castsi128_ps(_mm_set1_epi32(e0.Inclusive ? -1 : 0));
+    const __m128 incl1 = _mm_castsi128_ps(_mm_set1_epi32(e1.Inclusive ? -1 : 0));
+    const __m128 incl2 = _mm_castsi128_ps(_mm_set1_epi32(e2.Inclusive ? -1 : 0));
+    for (int y = y0; y < y1; y++, row += bd->Pitch)
+    {
+        // Evaluated directly from the row base on every block rather than stepped, so rounding doesn't drift across the row
+        const float py = (float)y + 0.5f;
+        const __m128 row0 = _mm_set1_ps(e0.B * py + e0.C);
+        const __m128 row1 = _mm_set1_ps(e1.B * py + e1.C);
+        const __m128 row2 = _mm_set1_ps(e2.B * py + e2.C);
+        for (int x = x0; x < x1; x += 4)
+        {
+            const __m128 px = _mm_add_ps(_mm_set1_ps((float)x), lane_offsets);
+            const __m128 w0 = _mm_add_ps(_mm_mul_ps(a0, px), row0);
+            const __m128 w1 = _mm_add_ps(_mm_mul_ps(a1, px), row1);
+            const __m128 w2 = _mm_add_ps(_mm_mul_ps(a2, px), row2);
+            __m128 m = _mm_or_ps(_mm_cmpgt_ps(w0, zero), _mm_and_ps(_mm_cmpeq_ps(w0, zero), incl0));
+            m = _mm_and_ps(m, _mm_or_ps(_mm_cmpgt_ps(w1, zero), _mm_and_ps(_mm_cmpeq_ps(w1, zero), incl1)));
+            m = _mm_and_ps(m, _mm_or_ps(_mm_cmpgt_ps(w2, zero), _mm_and_ps(_mm_cmpeq_ps(w2, zero), incl2)));
+            int mask = _mm_movemask_ps(m);
+            if (x1 - x < 4)
+                mask &= (1 << (x1 - x)) - 1;
+            if (mask == 0)
+                continue;
+            float w1_lanes[4], w2_lanes[4];
+            _mm_storeu_ps(w1_lanes, w1);
+            _mm_storeu_ps(w2_lanes, w2);
+            for (int lane = 0; lane < 4; lane++)
+                if (mask & (1 << lane))
+                    ImGui_ImplSoftRaster_ShadeTrianglePixel(&row[x + lane], &prim, src_const, c0, dc1, dc2, w1_lanes[lane] * inv_area, w2_lanes[lane] * inv_area);
+        }
+    }
+#else
+    for (int y = y0; y < y1; y++, row += bd->Pitch)
+    {
+        const float py = (float)y + 0.5f;
+        const float row0 = e0.B * py + e0.C;
+        const float row1 = e1.B * py + e1.C;
+        const float row2 = e2.B * py + e2.C;
+        for (int x = x0; x < x1; x++)
+        {
+            const float px = (float)x + 0.5f;
+            const float w0 = e0.A * px + row0;
+            const float w1 = e1.A * px + row1;
+            const float w2 = e2.A * px + row2;
+            if ((w0 > 0.0f || (w0 == 0.0f && e0.Inclusive)) && (w1 > 0.0f || (w1 == 0.0f && e1.Inclusive)) && (w2 > 0.0f || (w2 == 0.0f && e2.Inclusive)))
+                ImGui_ImplSoftRaster_ShadeTrianglePixel(&row[x], &prim, src_const, c0, dc1, dc2, w1 * inv_area, w2 * inv_area);
+        }
+    }
+#endif
+}
+
+static void ImGui_ImplSoftRaster_RasterTile(ImGui_ImplSoftRaster_Data* bd, int tile)
+{
+    const int tile_x0 = (tile % bd->TilesX) * IMGUI_IMPL_SOFTRASTER_TILE_SIZE;
+    const int tile_y0 = (tile / bd->TilesX) * IMGUI_IMPL_SOFTRASTER_TILE_SIZE;
+    const int tile_x1 = ImGui_ImplSoftRaster_Min(tile_x0 + IMGUI_IMPL_SOFTRASTER_TILE_SIZE, bd->Width);
+    const int tile_y1 = ImGui_ImplSoftRaster_Min(tile_y0 + IMGUI_IMPL_SOFTRASTER_TILE_SIZE, bd->Height);
+    for (int n = bd->TileOffsets[tile]; n < bd->TileOffsets[tile + 1]; n++)
+    {
+        const ImGui_ImplSoftRaster_Prim* prim = &bd->Prims[bd->TilePrims[n]];
+        const int x0 = ImGui_ImplSoftRaster_Max(prim->X0, tile_x0);
+        const int y0 = ImGui_ImplSoftRaster_Max(prim->Y0, tile_y0);
+        const int x1 = ImGui_ImplSoftRaster_Min(prim->X1, tile_x1);
+        const int y1 = ImGui_ImplSoftRaster_Min(prim->Y1, tile_y1);
+        if (x0 >= x1 || y0 >= y1)
+            continue;
+        if (prim->IsRect)
+            ImGui_ImplSoftRaster_RasterRect(bd, prim, x0, y0, x1, y1);
+        else
+            ImGui_ImplSoftRaster_RasterTriangle(bd, prim, x0, y0, x1, y1);
+    }
+}
+
+static void ImGui_ImplSoftRaster_RasterTiles(ImGui_ImplSoftRaster_Data* bd)
+{
+    const int tiles_count = bd->TilesX * bd->TilesY;
+    for (int tile = bd->NextTile.fetch_add(1); tile < tiles_count; tile = bd->NextTile.fetch_add(1))
+        ImGui_ImplSoftRaster_RasterTile(bd, tile);
+}
+
+//-----------------------------------------------------------------------------
+// Worker pool
+//-----------------------------------------------------------------------------
+
+static void ImGui_ImplSoftRaster_WorkerMain(ImGui_ImplSoftRaster_Data* bd)
+{
+    unsigned int generation = 0;
+    for (;;)
+    {
+        {
+            std::unique_lock<std::mutex> lock(bd->Mutex);
+            while (!bd->Quit && bd->JobGeneration == generation)
+                bd->WakeCond.wait(lock);
+            if (bd->Quit)
+                return;
+            generation = bd->JobGeneration;
+        }
+
+        ImGui_ImplSoftRaster_RasterTiles(bd);
+
+        std::lock_guard<std::mutex> lock(bd->Mutex);
+        if (--bd->JobBusyWorkers == 0)
+            bd->DoneCond.notify_one();
+    }
+}
+
+static void ImGui_ImplSoftRaster_StopWorkers(ImGui_ImplSoftRaster_Data* bd)
+{
+    {
+        std::lock_guard<std::mutex> lock(bd->Mutex);
+        bd->Quit = true;
+    }
+    bd->WakeCond.notify_all();
+    for (int n = 0; n < bd->Workers.Size; n++)
+    {
+        bd->Workers[n]->join();
+        IM_DELETE(bd->Workers[n]);
+    }
+    bd->Workers.clear();
+    bd->Quit = false;
+}
+
+void ImGui_ImplSoftRaster_SetThreadsCount(int threads_count)
+{
+    ImGui_ImplSoftRaster_Data* bd = ImGui_ImplSoftRaster_GetBackendData();
+    IM_ASSERT(bd != NULL && "Did you call ImGui_ImplSoftRaster_Init()?");
+    if (threads_count <= 0)
+        threads_count = (int)std::thread::hardware_concurrency();
+    if (threads_count <= 0)
+        threads_count = 1;
+    if (threads_count == bd->Workers.Size + 1)
+        return;
+
+    ImGui_ImplSoftRaster_StopWorkers(bd);
+    bd->JobGeneration = 0;
+    for (int n = 0; n < threads_count - 1; n++)
+        bd->Workers.push_back(IM_NEW(std::thread)(ImGui_ImplSoftRaster_WorkerMain, bd));
+}
+
+int ImGui_ImplSoftRaster_GetThreadsCount()
+{
+    ImGui_ImplSoftRaster_Data* bd = ImGui_ImplSoftRaster_GetBackendData();
+    return bd ? bd->Workers.Size + 1 : 0;
+}
+
+//-----------------------------------------------------------------------------
+// Functions
+//-----------------------------------------------------------------------------
+
+bool ImGui_ImplSoftRaster_Init(int threads_count)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    IM_ASSERT(io.BackendRendererUserData == NULL && "Already initialized a renderer backend!");
+
+    // Setup backend capabilities flags
+    ImGui_ImplSoftRaster_Data* bd = IM_NEW(ImGui_ImplSoftRaster_Data)();
+    io.BackendRendererUserData = (void*)bd;
+    io.BackendRendererName = "imgui_impl_softraster";
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
+
+    ImGui_ImplSoftRaster_SetThreadsCount(threads_count);
+    return true;
+}
+
+void ImGui_ImplSoftRaster_Shutdown()
+{
+    ImGui_ImplSoftRaster_Data* bd = ImGui_ImplSoftRaster_GetBackendData();
+    IM_ASSERT(bd != NULL && "No renderer backend to shutdown, or already shutdown?");
+    ImGuiIO& io = ImGui::GetIO();
+
+    ImGui_ImplSoftRaster_StopWorkers(bd);
+    ImGui_ImplSoftRaster_DestroyFontsTexture();
+    io.BackendRendererName = NULL;
+    io.BackendRendererUserData = NULL;
+    IM_DELETE(bd);
+}
+
+void ImGui_ImplSoftRaster_NewFrame()
+{
+    ImGui_ImplSoftRaster_Data* bd = ImGui_ImplSoftRaster_GetBackendData();
+    IM_ASSERT(bd != NULL && "Did you call ImGui_ImplSoftRaster_Init()?");
+
+    if (!bd->FontPixels)
+        ImGui_ImplSoftRaster_CreateFontsTexture();
+}
+
+bool ImGui_ImplSoftRaster_CreateFontsTexture()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    ImGui_ImplSoftRaster_Data* bd = ImGui_ImplSoftRaster_GetBackendData();
+
+    // Keep our own copy, the atlas is free to release its pixels after the texture is created
+    unsigned char* pixels;
+    int width, height;
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+    ImGui_ImplSoftRaster_DestroyFontsTexture();
+    bd->FontPixels = (unsigned int*)IM_ALLOC((size_t)width * height * 4);
+    memcpy(bd->FontPixels, pixels, (size_t)width * height * 4);
+    bd->FontTexture.Pixels = bd->FontPixels;
+    bd->FontTexture.Width = width;
+    bd->FontTexture.Height = height;
+
+    // Store our identifier
+    io.Fonts->SetTexID((ImTextureID)&bd->FontTexture);
+    return true;
+}
+
+void ImGui_ImplSoftRaster_DestroyFontsTexture()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    ImGui_ImplSoftRaster_Data* bd = ImGui_ImplSoftRaster_GetBackendData();
+    if (bd->FontPixels)
+    {
+        io.Fonts->SetTexID(0);
+        IM_FREE(bd->FontPixels);
+        bd->FontPixels = NULL;
+        memset(&bd->FontTexture, 0, sizeof(bd->FontTexture));
+    }
+}
+
+// a,b,c,a,c,d index pattern where a-b and c-d are horizontal, b-c and d-a vertical, UV following the same axes and a single color
+static bool ImGui_ImplSoftRaster_IsRect(const ImDrawList* cmd_list, const ImDrawIdx* idx, const ImDrawVert* vtx)
+{
+    if (idx[3] != idx[0] || idx[4] != idx[2])
+        return false;
+    const ImDrawVert& a = vtx[idx[0]];
+    const ImDrawVert& b = vtx[idx[1]];
+    const ImDrawVert& c = vtx[idx[2]];
+    const ImDrawVert& d = vtx[idx[5]];
+    if (a.col != b.col || a.col != c.col || a.col != d.col)
+        return false;
+    const ImVec2 a_pos = cmd_list->GetVtxPos(a), b_pos = cmd_list->GetVtxPos(b), c_pos = cmd_list->GetVtxPos(c), d_pos = cmd_list->GetVtxPos(d);
+    if (a_pos.y != b_pos.y || b_pos.x != c_pos.x || c_pos.y != d_pos.y || d_pos.x != a_pos.x)
+        return false;
+    const ImVec2 a_uv = cmd_list->GetVtxUV(a), b_uv = cmd_list->GetVtxUV(b), c_uv = cmd_list->GetVtxUV(c), d_uv = cmd_list->GetVtxUV(d);
+    if (a_uv.y != b_uv.y || b_uv.x != c_uv.x || c_uv.y != d_uv.y || d_uv.x != a_uv.x)
+        return false;
+    return a_pos.x != c_pos.x && a_pos.y != c_pos.y;
+}
+
+// Vertex position in framebuffer space
+static inline ImVec2 ImGui_ImplSoftRaster_ProjectVtx(const ImDrawList* cmd_list, const ImDrawVert& v, const ImVec2& clip_off, const ImVec2& clip_scale)
+{
+    const ImVec2 pos = cmd_list->GetVtxPos(v);
+    return ImVec2((pos.x - clip_off.x) * clip_scale.x, (pos.y - clip_off.y) * clip_scale.y);
+}
+
+// Render everything inside the scissor rectangle (pixels, max exclusive)
+static void ImGui_ImplSoftRaster_RenderScissor(ImGui_ImplSoftRaster_Data* bd, ImDrawData* draw_data, int scissor_x0, int scissor_y0, int scissor_x1, int scissor_y1, bool call_callbacks)
+{
+    const int width = bd->Width;
+    const int height = bd->Height;
+    bd->Prims.resize(0);
+
+    // Will project scissor/clipping rectangles and vertices into framebuffer space
+    ImVec2 clip_off = draw_data->DisplayPos;         // (0,0) unless using multi-viewports
+    ImVec2 clip_scale = draw_data->FramebufferScale; // (1,1) unless using retina display which are often (2,2)
+
+    // Convert commands to primitives
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    {
+        const ImDrawList* cmd_list = draw_data->CmdLists[n];
+        for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
+        {
+            const ImDrawCmd* pcmd = &cmd_list->CmdBuffer[cmd_i];
+            if (pcmd->UserCallback != NULL)
+            {
+                // User callback, registered via ImDrawList::AddCallback()
+                // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
+                if (pcmd->UserCallback != ImDrawCallback_ResetRenderState && call_callbacks)
+                    pcmd->UserCallback(cmd_list, pcmd);
+                continue;
+            }
+
+            // Project scissor/clipping rectangles into framebuffer space
+            int clip_x0 = (int)((pcmd->ClipRect.x - clip_off.x) * clip_scale.x);
+            int clip_y0 = (int)((pcmd->ClipRect.y - clip_off.y) * clip_scale.y);
+            int clip_x1 = (int)((pcmd->ClipRect.z - clip_off.x) * clip_scale.x);
+            int clip_y1 = (int)((pcmd->ClipRect.w - clip_off.y) * clip_scale.y);
+            clip_x0 = ImGui_ImplSoftRaster_Max(clip_x0, scissor_x0);
+            clip_y0 = ImGui_ImplSoftRaster_Max(clip_y0, scissor_y0);
+            clip_x1 = ImGui_ImplSoftRaster_Min(clip_x1, scissor_x1);
+            clip_y1 = ImGui_ImplSoftRaster_Min(clip_y1, scissor_y1);
+            if (clip_x1 <= clip_x0 || clip_y1 <= clip_y0)
+                continue;
+
+            const ImGui_ImplSoftRaster_Texture* texture = (const ImGui_ImplSoftRaster_Texture*)pcmd->GetTexID();
+            const ImDrawVert* vtx = cmd_list->VtxBuffer.Data + pcmd->VtxOffset;
+            const ImDrawIdx* idx = cmd_list->IdxBuffer.Data + pcmd->IdxOffset;
+            const ImDrawIdx* idx_end = idx + pcmd->ElemCount;
+            while (idx + 3 <= idx_end)
+            {
+                ImGui_ImplSoftRaster_Prim prim;
+                prim.Texture = texture;
+                float min_x, min_y, max_x, max_y;
+                if (idx + 6 <= idx_end && ImGui_ImplSoftRaster_IsRect(cmd_list, idx, vtx))
+                {
+                    const ImDrawVert& a = vtx[idx[0]];
+                    const ImDrawVert& c = vtx[idx[2]];
+                    prim.IsRect = true;
+                    prim.Pos[0] = ImGui_ImplSoftRaster_ProjectVtx(cmd_list, a, clip_off, clip_scale);
+                    prim.Pos[1] = ImGui_ImplSoftRaster_ProjectVtx(cmd_list, c, clip_off, clip_scale);
+                    prim.Uv[0] = cmd_list->GetVtxUV(a);
+                    prim.Uv[1] = cmd_list->GetVtxUV(c);
+                    prim.Col[0] = a.col;
+                    prim.UvConst = (prim.Uv[0].x == prim.Uv[1].x && prim.Uv[0].y == prim.Uv[1].y);
+                    prim.ColConst = true;
+
+                    // Pixel centers inside [min, max)
+                    min_x = ImGui_ImplSoftRaster_Min(prim.Pos[0].x, prim.Pos[1].x); max_x = ImGui_ImplSoftRaster_Max(prim.Pos[0].x, prim.Pos[1].x);
+                    min_y = ImGui_ImplSoftRaster_Min(prim.Pos[0].y, prim.Pos[1].y); max_y = ImGui_ImplSoftRaster_Max(prim.Pos[0].y, prim.Pos[1].y);
+                    prim.X0 = (int)ceilf(min_x - 0.5f);
+                    prim.Y0 = (int)ceilf(min_y - 0.5f);
+                    prim.X1 = (int)ceilf(max_x - 0.5f);
+                    prim.Y1 = (int)ceilf(max_y - 0.5f);
+                    idx += 6;
+                }
+                else
+                {
+                    const ImDrawVert& a = vtx[idx[0]];
+                    const ImDrawVert& b = vtx[idx[1]];
+                    const ImDrawVert& c = vtx[idx[2]];
+                    prim.IsRect = false;
+                    prim.Pos[0] = ImGui_ImplSoftRaster_ProjectVtx(cmd_list, a, clip_off, clip_scale);
+                    prim.Pos[1] = ImGui_ImplSoftRaster_ProjectVtx(cmd_list, b, clip_off, clip_scale);
+                    prim.Pos[2] = ImGui_ImplSoftRaster_ProjectVtx(cmd_list, c, clip_off, clip_scale);
+                    prim.Uv[0] = cmd_list->GetVtxUV(a);
+                    prim.Uv[1] = cmd_list->GetVtxUV(b);
+                    prim.Uv[2] = cmd_list->GetVtxUV(c);
+                    prim.Col[0] = a.col;
+                    prim.Col[1] = b.col;
+                    prim.Col[2] = c.col;
+                    prim.UvConst = (prim.Uv[0].x == prim.Uv[1].x && prim.Uv[0].y == prim.Uv[1].y && prim.Uv[0].x == prim.Uv[2].x && prim.Uv[0].y == prim.Uv[2].y);
+                    prim.ColConst = (a.col == b.col && a.col == c.col);
+
+                    min_x = ImGui_ImplSoftRaster_Min(ImGui_ImplSoftRaster_Min(prim.Pos[0].x, prim.Pos[1].x), prim.Pos[2].x);
+                    min_y = ImGui_ImplSoftRaster_Min(ImGui_ImplSoftRaster_Min(prim.Pos[0].y, prim.Pos[1].y), prim.Pos[2].y);
+                    max_x = ImGui_ImplSoftRaster_Max(ImGui_ImplSoftRaster_Max(prim.Pos[0].x, prim.Pos[1].x), prim.Pos[2].x);
+                    max_y = ImGui_ImplSoftRaster_Max(ImGui_ImplSoftRaster_Max(prim.Pos[0].y, prim.Pos[1].y), prim.Pos[2].y);
+                    prim.X0 = (int)floorf(min_x);
+                    prim.Y0 = (int)floorf(min_y);
+                    prim.X1 = (int)ceilf(max_x);
+                    prim.Y1 = (int)ceilf(max_y);
+                    idx += 3;
+                }
+
+                // Invisible and fully clipped primitives never reach the tiles
+                if (prim.ColConst && (prim.Col[0] & IM_COL32_A_MASK) == 0)
+                    continue;
+                prim.X0 = ImGui_ImplSoftRaster_Max(prim.X0, clip_x0);
+                prim.Y0 = ImGui_ImplSoftRaster_Max(prim.Y0, clip_y0);
+                prim.X1 = ImGui_ImplSoftRaster_Min(prim.X1, clip_x1);
+                prim.Y1 = ImGui_ImplSoftRaster_Min(prim.Y1, clip_y1);
+                if (prim.X0 >= prim.X1 || prim.Y0 >= prim.Y1)
+                    continue;
+                bd->Prims.push_back(prim);
+            }
+        }
+    }
+
+    // Bin primitives into tiles with a counting sort, submission order is preserved within each tile
+    bd->TilesX = (width + IMGUI_IMPL_SOFTRASTER_TILE_SIZE - 1) / IMGUI_IMPL_SOFTRASTER_TILE_SIZE;
+    bd->TilesY = (height + IMGUI_IMPL_SOFTRASTER_TILE_SIZE - 1) / IMGUI_IMPL_SOFTRASTER_TILE_SIZE;
+    const int tiles_count = bd->TilesX * bd->TilesY;
+    bd->TileOffsets.resize(tiles_count + 1);
+    memset(bd->TileOffsets.Data, 0, (size_t)bd->TileOffsets.size_in_bytes());
+    int* tile_counts = bd->TileOffsets.Data + 1;
+    for (int prim_n = 0; prim_n < bd->Prims.Size; prim_n++)
+    {
+        const ImGui_ImplSoftRaster_Prim& prim = bd->Prims[prim_n];
+        for (int ty = prim.Y0 / IMGUI_IMPL_SOFTRASTER_TILE_SIZE; ty <= (prim.Y1 - 1) / IMGUI_IMPL_SOFTRASTER_TILE_SIZE; ty++)
+            for (int tx = prim.X0 / IMGUI_IMPL_SOFTRASTER_TILE_SIZE; tx <= (prim.X1 - 1) / IMGUI_IMPL_SOFTRASTER_TILE_SIZE; tx++)
+                tile_counts[ty * bd->TilesX + tx]++;
+    }
+    for (int tile = 0; tile < tiles_count; tile++)
+        bd->TileOffsets[tile + 1] += bd->TileOffsets[tile];
+    bd->TilePrims.resize(bd->TileOffsets[tiles_count]);
+
+    // Fill using the offsets as cursors, then shift them back
+    int* tile_cursors = bd->TileOffsets.Data;
+    for (int prim_n = 0; prim_n < bd->Prims.Size; prim_n++)
+    {
+        const ImGui_ImplSoftRaster_Prim& prim = bd->Prims[prim_n];
+        for (int ty = prim.Y0 / IMGUI_IMPL_SOFTRASTER_TILE_SIZE; ty <= (prim.Y1 - 1) / IMGUI_IMPL_SOFTRASTER_TILE_SIZE; ty++)
+            for (int tx = prim.X0 / IMGUI_IMPL_SOFTRASTER_TILE_SIZE; tx <= (prim.X1 - 1) / IMGUI_IMPL_SOFTRASTER_TILE_SIZE; tx++)
+                bd->TilePrims[tile_cursors[ty * bd->TilesX + tx]++] = prim_n;
+    }
+    memmove(bd->TileOffsets.Data + 1, bd->TileOffsets.Data, (size_t)tiles_count * sizeof(int));
+    bd->TileOffsets[0] = 0;
+
+    // Rasterize tiles on the worker pool, the calling thread takes tiles too
+    bd->NextTile = 0;
+    if (bd->Workers.Size > 0)
+    {
+        {
+            std::lock_guard<std::mutex> lock(bd->Mutex);
+            bd->JobBusyWorkers = bd->Workers.Size;
+            bd->JobGeneration++;
+        }
+        bd->WakeCond.notify_all();
+        ImGui_ImplSoftRaster_RasterTiles(bd);
+        std::unique_lock<std::mutex> lock(bd->Mutex);
+        while (bd->JobBusyWorkers > 0)
+            bd->DoneCond.wait(lock);
+    }
+    else
+    {
+        ImGui_ImplSoftRaster_RasterTiles(bd);
+    }
+}
+
+void ImGui_ImplSoftRaster_RenderDrawData(ImDrawData* draw_data, unsigned int* pixels, int width, int height, int pitch)
+{
+    ImGui_ImplSoftRaster_Data* bd = ImGui_ImplSoftRaster_GetBackendData();
+    IM_ASSERT(bd != NULL && "Did you call ImGui_ImplSoftRaster_Init()?");
+    IM_ASSERT(pixels != NULL && pitch >= width);
+    if (width <= 0 || height <= 0 || draw_data->TotalVtxCount == 0)
+        return;
+
+    bd->Pixels = pixels;
+    bd->Width = width;
+    bd->Height = height;
+    bd->Pitch = pitch;
+    ImGui_ImplSoftRaster_RenderScissor(bd, draw_data, 0, 0, width, height, true);
+}
+
+static void ImGui_ImplSoftRaster_Fill(unsigned int* pixels, int pitch, int x0, int y0, int x1, int y1, ImU32 col)
+{
+    for (int y = y0; y < y1; y++)
+    {
+        unsigned int* dst = pixels + (size_t)y * pitch;
+        for (int x = x0; x < x1; x++)
+            dst[x] = col;
+    }
+}
+
+// User callbacks, registered via ImDrawList::AddCallback(), run before any primitive is rasterized as in RenderScissor()
+static void ImGui_ImplSoftRaster_CallCallbacks(ImDrawData* draw_data)
+{
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    {
+        const ImDrawList* cmd_list = draw_data->CmdLists[n];
+        for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
+        {
+            const ImDrawCmd* pcmd = &cmd_list->CmdBuffer[cmd_i];
+            if (pcmd->UserCallback != NULL && pcmd->UserCallback != ImDrawCallback_ResetRenderState)
+                pcmd->UserCallback(cmd_list, pcmd);
+        }
+    }
+}
+
+bool ImGui_ImplSoftRaster_RenderDrawDataDamaged(ImDrawData* draw_data, unsigned int* pixels, int width, int height, int pitch, ImU32 clear_col)
+{
+    ImGui_ImplSoftRaster_Data* bd = ImGui_ImplSoftRaster_GetBackendData();
+    IM_ASSERT(bd != NULL && "Did you call ImGui_ImplSoftRaster_Init()?");
+    IM_ASSERT(pixels != NULL && pitch >= width);
+    if (width <= 0 || height <= 0)
+        return false;
+    if (!draw_data->HasDamageRects)
+    {
+        ImGui_ImplSoftRaster_Fill(pixels, pitch, 0, 0, width, height, clear_col);
+        ImGui_ImplSoftRaster_RenderDrawData(draw_data, pixels, width, height, pitch);
+        return true;
+    }
+
+    // Callbacks run once per frame, whichever damage rectangles are drawn (or none)
+    ImGui_ImplSoftRaster_CallCallbacks(draw_data);
+
+    // Damage rectangles don't overlap, but may touch once rounded outward to framebuffer pixels: each one is cleared and
+    // redrawn entirely in its own pass, so pixels rendered twice come out the same.
+    bd->Pixels = pixels;
+    bd->Width = width;
+    bd->Height = height;
+    bd->Pitch = pitch;
+    ImVec2 clip_off = draw_data->DisplayPos;
+    ImVec2 clip_scale = draw_data->FramebufferScale;
+    for (int n = 0; n < draw_data->DamageRectsCount; n++)
+    {
+        const ImVec4& r = draw_data->DamageRects[n];
+        const int x0 = ImGui_ImplSoftRaster_Max((int)floorf((r.x - clip_off.x) * clip_scale.x), 0);
+        const int y0 = ImGui_ImplSoftRaster_Max((int)floorf((r.y - clip_off.y) * clip_scale.y), 0);
+        const int x1 = ImGui_ImplSoftRaster_Min((int)ceilf((r.z - clip_off.x) * clip_scale.x), width);
+        const int y1 = ImGui_ImplSoftRaster_Min((int)ceilf((r.w - clip_off.y) * clip_scale.y), height);
+        if (x1 <= x0 || y1 <= y0)
+            continue;
+        ImGui_ImplSoftRaster_Fill(pixels, pitch, x0, y0, x1, y1, clear_col);
+        ImGui_ImplSoftRaster_RenderScissor(bd, draw_data, x0, y0, x1, y1, false);
+    }
+    return draw_data->DamageRectsCount > 0;
+}
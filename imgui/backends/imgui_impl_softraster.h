@@ -0,0 +1,50 @@
+// dear imgui: Renderer Backend for CPU software rasterization into a 32-bit RGBA framebuffer
+// (No GPU or graphics API needed: headless servers, remote viewing, regression screenshots, report generation)
+
+// Implemented features:
+//  [X] Renderer: User texture binding. Use 'ImGui_ImplSoftRaster_Texture*' as ImTextureID. Read the FAQ about ImTextureID!
+//  [X] Renderer: Support for large meshes (64k+ vertices) with 16-bit indices.
+//  [X] Renderer: Multi-threaded. Primitives are binned into screen tiles, tiles are rasterized in parallel by a worker pool.
+//  [X] Renderer: Partial redraw of ImDrawData::DamageRects with ImGui_ImplSoftRaster_RenderDrawDataDamaged().
+// Missing features:
+//  [ ] Renderer: Multi-viewport support (multiple windows).
+//  [ ] Renderer: Textures are point sampled, no bilinear filtering.
+//  [ ] Renderer: User callbacks are called in order while primitives are binned, before any pixel is written. They can't draw into the framebuffer.
+
+// You can copy and use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
+// If you are new to Dear ImGui, read documentation from the docs/ folder + read the top of imgui.cpp.
+// Read online: https://github.com/ocornut/imgui/tree/master/docs
+
+#pragma once
+#include "imgui.h"      // IMGUI_IMPL_API
+
+// Texture to pass as ImTextureID.
+// Pixels are 32-bit RGBA in IM_COL32() byte order, as returned by ImFontAtlas::GetTexDataAsRGBA32(). Must stay valid until rendering returns.
+struct ImGui_ImplSoftRaster_Texture
+{
+    const unsigned int* Pixels;
+    int                 Width;
+    int                 Height;
+};
+
+// threads_count: number of threads rasterizing tiles, including the calling thread. 0 = one per hardware thread.
+IMGUI_IMPL_API bool     ImGui_ImplSoftRaster_Init(int threads_count = 0);
+IMGUI_IMPL_API void     ImGui_ImplSoftRaster_Shutdown();
+IMGUI_IMPL_API void     ImGui_ImplSoftRaster_NewFrame();
+
+// Blends draw_data over 'pixels' (32-bit RGBA in IM_COL32() byte order, 'pitch' in pixels), it is not cleared first.
+// width/height are the framebuffer size in pixels, normally draw_data->DisplaySize * draw_data->FramebufferScale.
+IMGUI_IMPL_API void     ImGui_ImplSoftRaster_RenderDrawData(ImDrawData* draw_data, unsigned int* pixels, int width, int height, int pitch);
+
+// Partial redraw with damage tracking (io.ConfigDamageTracking = true): 'pixels' must still hold the frame rendered by the previous call,
+// only draw_data->DamageRects are filled with 'clear_col' then redrawn. Without damage rects everything is cleared and redrawn.
+// Returns false when no pixel changed.
+IMGUI_IMPL_API bool     ImGui_ImplSoftRaster_RenderDrawDataDamaged(ImDrawData* draw_data, unsigned int* pixels, int width, int height, int pitch, ImU32 clear_col);
+
+// Called by Init/NewFrame/Shutdown
+IMGUI_IMPL_API bool     ImGui_ImplSoftRaster_CreateFontsTexture();
+IMGUI_IMPL_API void     ImGui_ImplSoftRaster_DestroyFontsTexture();
+
+// Change the worker pool size after initialization
+IMGUI_IMPL_API void     ImGui_ImplSoftRaster_SetThreadsCount(int threads_count);
+IMGUI_IMPL_API int      ImGui_ImplSoftRaster_GetThreadsCount();
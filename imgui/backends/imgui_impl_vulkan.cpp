@@ -24,6 +24,8 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-18: Vulkan: Support IMGUI_USE_COMPACT_DRAWVERT 12 bytes vertices: R16G16_SNORM positions and R16G16_UNORM UV, ImDrawList::VtxOrigin folded into the push constants per command list.
+//  2026-10-18: Vulkan: Per-frame vertex/index buffers are persistently mapped and grow geometrically. Flush skipped on HOST_COHERENT memory. Added IMGUI_IMPL_VULKAN_SINGLE_RENDER_BUFFER.
 //  2021-XX-XX: Platform: Added support for multiple windows via the ImGuiPlatformIO interface.
 //  2021-10-15: Vulkan: Call vkCmdSetScissor() at the end of render a full-viewport to reduce likehood of issues with people using VK_DYNAMIC_STATE_SCISSOR in their app without calling vkCmdSetScissor() explicitly every frame.
 //  2021-06-29: Reorganized backend to pull data from a single structure to facilitate usage with multiple-contexts (all g_XXXX access changed to bd->XXXX).
@@ -69,6 +71,11 @@ struct ImGui_ImplVulkanH_FrameRenderBuffers
     VkDeviceSize        IndexBufferSize;
     VkBuffer            VertexBuffer;
     VkBuffer            IndexBuffer;
+    VkDeviceSize        IndexBufferOffset;      // Offset of indices inside VertexBuffer with IMGUI_IMPL_VULKAN_SINGLE_RENDER_BUFFER, 0 otherwise
+    void*               VertexBufferMapped;     // Mapped once at creation, unmapped on destruction
+    void*               IndexBufferMapped;
+    bool                VertexBufferCoherent;   // HOST_COHERENT memory doesn't need vkFlushMappedMemoryRanges()
+    bool                IndexBufferCoherent;
 };
 
 // Each viewport will hold 1 ImGui_ImplVulkanH_WindowRenderBuffers
@@ -368,7 +375,9 @@ static void check_vk_result(VkResult err)
         v->CheckVkResultFn(err);
 }
 
-static void CreateOrResizeBuffer(VkBuffer& buffer, VkDeviceMemory& buffer_memory, VkDeviceSize& p_buffer_size, size_t new_size, VkBufferUsageFlagBits usage)
+// Buffers are persistently mapped. The old buffer can be destroyed right away on growth: the application waited on the fence
+// of the frame which last used this frame slot before rendering into it again.
+static void CreateOrResizeBuffer(VkBuffer& buffer, VkDeviceMemory& buffer_memory, VkDeviceSize& p_buffer_size, void*& p_buffer_mapped, bool& p_buffer_coherent, size_t new_size, VkBufferUsageFlags usage)
 {
     ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
     ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
@@ -376,7 +385,17 @@ static void CreateOrResizeBuffer(VkBuffer& buffer, VkDeviceMemory& buffer_memory
     if (buffer != VK_NULL_HANDLE)
         vkDestroyBuffer(v->Device, buffer, v->Allocator);
     if (buffer_memory != VK_NULL_HANDLE)
+    {
+        vkUnmapMemory(v->Device, buffer_memory);
         vkFreeMemory(v->Device, buffer_memory, v->Allocator);
+    }
+    buffer = VK_NULL_HANDLE;
+    buffer_memory = VK_NULL_HANDLE;
+    p_buffer_mapped = NULL;
+
+    // Grow geometrically so a slowly growing UI doesn't reallocate every few frames
+    if (new_size < p_buffer_size + p_buffer_size / 2)
+        new_size = (size_t)(p_buffer_size + p_buffer_size / 2);
 
     VkDeviceSize vertex_buffer_size_aligned = ((new_size - 1) / bd->BufferMemoryAlignment + 1) * bd->BufferMemoryAlignment;
     VkBufferCreateInfo buffer_info = {};
@@ -387,19 +406,25 @@ static void CreateOrResizeBuffer(VkBuffer& buffer, VkDeviceMemory& buffer_memory
     err = vkCreateBuffer(v->Device, &buffer_info, v->Allocator, &buffer);
     check_vk_result(err);
 
+    // Prefer HOST_COHERENT memory, which lets us skip vkFlushMappedMemoryRanges() every frame
     VkMemoryRequirements req;
     vkGetBufferMemoryRequirements(v->Device, buffer, &req);
     bd->BufferMemoryAlignment = (bd->BufferMemoryAlignment > req.alignment) ? bd->BufferMemoryAlignment : req.alignment;
     VkMemoryAllocateInfo alloc_info = {};
     alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
     alloc_info.allocationSize = req.size;
-    alloc_info.memoryTypeIndex = ImGui_ImplVulkan_MemoryType(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, req.memoryTypeBits);
+    alloc_info.memoryTypeIndex = ImGui_ImplVulkan_MemoryType(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, req.memoryTypeBits);
+    p_buffer_coherent = (alloc_info.memoryTypeIndex != 0xFFFFFFFF);
+    if (!p_buffer_coherent)
+        alloc_info.memoryTypeIndex = ImGui_ImplVulkan_MemoryType(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, req.memoryTypeBits);
     err = vkAllocateMemory(v->Device, &alloc_info, v->Allocator, &buffer_memory);
     check_vk_result(err);
 
     err = vkBindBufferMemory(v->Device, buffer, buffer_memory, 0);
     check_vk_result(err);
-    p_buffer_size = req.size;
+    err = vkMapMemory(v->Device, buffer_memory, 0, req.size, 0, &p_buffer_mapped);
+    check_vk_result(err);
+    p_buffer_size = buffer_info.size; // Usable range is the buffer's, the allocation (req.size) may be larger
 }
 
 static void ImGui_ImplVulkan_SetupRenderState(ImDrawData* draw_data, VkPipeline pipeline, VkCommandBuffer command_buffer, ImGui_ImplVulkanH_FrameRenderBuffers* rb, int fb_width, int fb_height)
@@ -419,7 +444,11 @@ static void ImGui_ImplVulkan_SetupRenderState(ImDrawData* draw_data, VkPipeline
         VkBuffer vertex_buffers[1] = { rb->VertexBuffer };
         VkDeviceSize vertex_offset[1] = { 0 };
         vkCmdBindVertexBuffers(command_buffer, 0, 1, vertex_buffers, vertex_offset);
+#ifdef IMGUI_IMPL_VULKAN_SINGLE_RENDER_BUFFER
+        vkCmdBindIndexBuffer(command_buffer, rb->VertexBuffer, rb->IndexBufferOffset, sizeof(ImDrawIdx) == 2 ? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32);
+#else
         vkCmdBindIndexBuffer(command_buffer, rb->IndexBuffer, 0, sizeof(ImDrawIdx) == 2 ? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32);
+#endif
     }
 
     // Setup viewport:
@@ -448,6 +477,26 @@ static void ImGui_ImplVulkan_SetupRenderState(ImDrawData* draw_data, VkPipeline
     }
 }
 
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+// Compact vertex positions are fixed point relative to the command list VtxOrigin, read as VK_FORMAT_R16G16_SNORM (value / 32767).
+// Fold both into the scale and translation push constants, once per command list.
+static void ImGui_ImplVulkan_SetupVtxOrigin(ImDrawData* draw_data, VkCommandBuffer command_buffer, const ImDrawList* cmd_list)
+{
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    const float pos_scale = 32767.0f / (float)(1 << IMGUI_COMPACT_DRAWVERT_SUBPIXEL_BITS);
+    float scale[2];
+    scale[0] = 2.0f / draw_data->DisplaySize.x;
+    scale[1] = 2.0f / draw_data->DisplaySize.y;
+    float translate[2];
+    translate[0] = -1.0f + (cmd_list->VtxOrigin.x - draw_data->DisplayPos.x) * scale[0];
+    translate[1] = -1.0f + (cmd_list->VtxOrigin.y - draw_data->DisplayPos.y) * scale[1];
+    scale[0] *= pos_scale;
+    scale[1] *= pos_scale;
+    vkCmdPushConstants(command_buffer, bd->PipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, sizeof(float) * 0, sizeof(float) * 2, scale);
+    vkCmdPushConstants(command_buffer, bd->PipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, sizeof(float) * 2, sizeof(float) * 2, translate);
+}
+#endif
+
 // Render function
 void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer command_buffer, VkPipeline pipeline)
 {
@@ -482,18 +531,29 @@ void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer comm
         // Create or resize the vertex/index buffers
         size_t vertex_size = draw_data->TotalVtxCount * sizeof(ImDrawVert);
         size_t index_size = draw_data->TotalIdxCount * sizeof(ImDrawIdx);
+#ifdef IMGUI_IMPL_VULKAN_SINGLE_RENDER_BUFFER
+        // Indices are sub-allocated after the vertices, at an offset aligned for both the index type and nonCoherentAtomSize flushes
+        VkDeviceSize index_offset = ((vertex_size - 1) / bd->BufferMemoryAlignment + 1) * bd->BufferMemoryAlignment;
+        while (rb->VertexBuffer == VK_NULL_HANDLE || rb->VertexBufferSize < index_offset + index_size)
+        {
+            // Alignment may be raised by the new buffer's requirements, moving the indices past its end: grow again in that case
+            CreateOrResizeBuffer(rb->VertexBuffer, rb->VertexBufferMemory, rb->VertexBufferSize, rb->VertexBufferMapped, rb->VertexBufferCoherent, (size_t)(index_offset + index_size), VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT);
+            index_offset = ((vertex_size - 1) / bd->BufferMemoryAlignment + 1) * bd->BufferMemoryAlignment;
+        }
+        IM_ASSERT(index_offset + index_size <= rb->VertexBufferSize);
+        rb->IndexBufferOffset = index_offset;
+        rb->IndexBufferMapped = (char*)rb->VertexBufferMapped + index_offset;
+        rb->IndexBufferCoherent = rb->VertexBufferCoherent;
+#else
         if (rb->VertexBuffer == VK_NULL_HANDLE || rb->VertexBufferSize < vertex_size)
-            CreateOrResizeBuffer(rb->VertexBuffer, rb->VertexBufferMemory, rb->VertexBufferSize, vertex_size, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT);
+            CreateOrResizeBuffer(rb->VertexBuffer, rb->VertexBufferMemory, rb->VertexBufferSize, rb->VertexBufferMapped, rb->VertexBufferCoherent, vertex_size, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT);
         if (rb->IndexBuffer == VK_NULL_HANDLE || rb->IndexBufferSize < index_size)
-            CreateOrResizeBuffer(rb->IndexBuffer, rb->IndexBufferMemory, rb->IndexBufferSize, index_size, VK_BUFFER_USAGE_INDEX_BUFFER_BIT);
+            CreateOrResizeBuffer(rb->IndexBuffer, rb->IndexBufferMemory, rb->IndexBufferSize, rb->IndexBufferMapped, rb->IndexBufferCoherent, index_size, VK_BUFFER_USAGE_INDEX_BUFFER_BIT);
+#endif
 
-        // Upload vertex/index data into a single contiguous GPU buffer
-        ImDrawVert* vtx_dst = NULL;
-        ImDrawIdx* idx_dst = NULL;
-        VkResult err = vkMapMemory(v->Device, rb->VertexBufferMemory, 0, rb->VertexBufferSize, 0, (void**)(&vtx_dst));
-        check_vk_result(err);
-        err = vkMapMemory(v->Device, rb->IndexBufferMemory, 0, rb->IndexBufferSize, 0, (void**)(&idx_dst));
-        check_vk_result(err);
+        // Upload vertex/index data into the persistently mapped buffers
+        ImDrawVert* vtx_dst = (ImDrawVert*)rb->VertexBufferMapped;
+        ImDrawIdx* idx_dst = (ImDrawIdx*)rb->IndexBufferMapped;
         for (int n = 0; n < draw_data->CmdListsCount; n++)
         {
             const ImDrawList* cmd_list = draw_data->CmdLists[n];
@@ -502,17 +562,29 @@ void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer comm
             vtx_dst += cmd_list->VtxBuffer.Size;
             idx_dst += cmd_list->IdxBuffer.Size;
         }
+
+        // Only non-coherent memory needs an explicit flush
         VkMappedMemoryRange range[2] = {};
-        range[0].sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
-        range[0].memory = rb->VertexBufferMemory;
-        range[0].size = VK_WHOLE_SIZE;
-        range[1].sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
-        range[1].memory = rb->IndexBufferMemory;
-        range[1].size = VK_WHOLE_SIZE;
-        err = vkFlushMappedMemoryRanges(v->Device, 2, range);
-        check_vk_result(err);
-        vkUnmapMemory(v->Device, rb->VertexBufferMemory);
-        vkUnmapMemory(v->Device, rb->IndexBufferMemory);
+        uint32_t range_count = 0;
+        if (!rb->VertexBufferCoherent)
+        {
+            range[range_count].sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+            range[range_count].memory = rb->VertexBufferMemory;
+            range[range_count].size = VK_WHOLE_SIZE;
+            range_count++;
+        }
+        if (!rb->IndexBufferCoherent && rb->IndexBufferMemory != VK_NULL_HANDLE)
+        {
+            range[range_count].sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+            range[range_count].memory = rb->IndexBufferMemory;
+            range[range_count].size = VK_WHOLE_SIZE;
+            range_count++;
+        }
+        if (range_count > 0)
+        {
+            VkResult err = vkFlushMappedMemoryRanges(v->Device, range_count, range);
+            check_vk_result(err);
+        }
     }
 
     // Setup desired Vulkan state
@@ -529,6 +601,9 @@ void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer comm
     for (int n = 0; n < draw_data->CmdListsCount; n++)
     {
         const ImDrawList* cmd_list = draw_data->CmdLists[n];
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+        ImGui_ImplVulkan_SetupVtxOrigin(draw_data, command_buffer, cmd_list);
+#endif
         for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
         {
             const ImDrawCmd* pcmd = &cmd_list->CmdBuffer[cmd_i];
@@ -537,7 +612,12 @@ void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer comm
                 // User callback, registered via ImDrawList::AddCallback()
                 // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
                 if (pcmd->UserCallback == ImDrawCallback_ResetRenderState)
+                {
                     ImGui_ImplVulkan_SetupRenderState(draw_data, pipeline, command_buffer, rb, fb_width, fb_height);
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+                    ImGui_ImplVulkan_SetupVtxOrigin(draw_data, command_buffer, cmd_list);
+#endif
+                }
                 else
                     pcmd->UserCallback(cmd_list, pcmd);
             }
@@ -846,11 +926,19 @@ static void ImGui_ImplVulkan_CreatePipeline(VkDevice device, const VkAllocationC
     VkVertexInputAttributeDescription attribute_desc[3] = {};
     attribute_desc[0].location = 0;
     attribute_desc[0].binding = binding_desc[0].binding;
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    attribute_desc[0].format = VK_FORMAT_R16G16_SNORM;
+#else
     attribute_desc[0].format = VK_FORMAT_R32G32_SFLOAT;
+#endif
     attribute_desc[0].offset = IM_OFFSETOF(ImDrawVert, pos);
     attribute_desc[1].location = 1;
     attribute_desc[1].binding = binding_desc[0].binding;
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    attribute_desc[1].format = VK_FORMAT_R16G16_UNORM;
+#else
     attribute_desc[1].format = VK_FORMAT_R32G32_SFLOAT;
+#endif
     attribute_desc[1].offset = IM_OFFSETOF(ImDrawVert, uv);
     attribute_desc[2].location = 2;
     attribute_desc[2].binding = binding_desc[0].binding;
@@ -1510,11 +1598,14 @@ void ImGui_ImplVulkanH_DestroyFrameSemaphores(VkDevice device, ImGui_ImplVulkanH
 void ImGui_ImplVulkanH_DestroyFrameRenderBuffers(VkDevice device, ImGui_ImplVulkanH_FrameRenderBuffers* buffers, const VkAllocationCallbacks* allocator)
 {
     if (buffers->VertexBuffer) { vkDestroyBuffer(device, buffers->VertexBuffer, allocator); buffers->VertexBuffer = VK_NULL_HANDLE; }
-    if (buffers->VertexBufferMemory) { vkFreeMemory(device, buffers->VertexBufferMemory, allocator); buffers->VertexBufferMemory = VK_NULL_HANDLE; }
+    if (buffers->VertexBufferMemory) { vkUnmapMemory(device, buffers->VertexBufferMemory); vkFreeMemory(device, buffers->VertexBufferMemory, allocator); buffers->VertexBufferMemory = VK_NULL_HANDLE; }
     if (buffers->IndexBuffer) { vkDestroyBuffer(device, buffers->IndexBuffer, allocator); buffers->IndexBuffer = VK_NULL_HANDLE; }
-    if (buffers->IndexBufferMemory) { vkFreeMemory(device, buffers->IndexBufferMemory, allocator); buffers->IndexBufferMemory = VK_NULL_HANDLE; }
+    if (buffers->IndexBufferMemory) { vkUnmapMemory(device, buffers->IndexBufferMemory); vkFreeMemory(device, buffers->IndexBufferMemory, allocator); buffers->IndexBufferMemory = VK_NULL_HANDLE; }
     buffers->VertexBufferSize = 0;
     buffers->IndexBufferSize = 0;
+    buffers->IndexBufferOffset = 0;
+    buffers->VertexBufferMapped = NULL;
+    buffers->IndexBufferMapped = NULL;
 }
 
 void ImGui_ImplVulkanH_DestroyWindowRenderBuffers(VkDevice device, ImGui_ImplVulkanH_WindowRenderBuffers* buffers, const VkAllocationCallbacks* allocator)
@@ -37,6 +37,10 @@
 // If you have no idea what this is, leave it alone!
 //#define IMGUI_IMPL_VULKAN_NO_PROTOTYPES
 
+// [Configuration] '#define IMGUI_IMPL_VULKAN_SINGLE_RENDER_BUFFER' (in imconfig.h or as a compilation flag) to sub-allocate vertices and
+// indices of each frame from a single VkBuffer/VkDeviceMemory, halving allocations and mapped ranges. Requires the same define in every
+// compilation unit including this header.
+
 // Vulkan includes
 #if defined(IMGUI_IMPL_VULKAN_NO_PROTOTYPES) && !defined(VK_NO_PROTOTYPES)
 #define VK_NO_PROTOTYPES
@@ -95,6 +95,12 @@
 // Read about ImGuiBackendFlags_RendererHasVtxOffset for details.
 //#define ImDrawIdx unsigned int
 
+//---- Use a compact 12 bytes ImDrawVert instead of the default 20 bytes: int16 fixed point positions relative to ImDrawList::VtxOrigin, uint16 normalized UV, packed color.
+// Positions have IMGUI_COMPACT_DRAWVERT_SUBPIXEL_BITS bits of sub-pixel precision (default 3: 1/8 pixel, range +/-4096 pixels around the origin: viewports must fit in it, lines are clipped to it, other geometry is clamped).
+// UV are clamped to 0..1 (no texture repeat). Supported by the OpenGL3, Vulkan and softraster renderer backends.
+//#define IMGUI_USE_COMPACT_DRAWVERT
+//#define IMGUI_COMPACT_DRAWVERT_SUBPIXEL_BITS 3
+
 //---- Override ImDrawCallback signature (will need to modify renderer backends accordingly)
 //struct ImDrawList;
 //struct ImDrawCmd;
@@ -975,6 +975,8 @@ static void             RenderWindowTitleBarContents(ImGuiWindow* window, const
 static void             RenderDimmedBackgroundBehindWindow(ImGuiWindow* window, ImU32 col);
 static void             RenderDimmedBackgrounds();
 static ImGuiWindow*     FindBlockingModal(ImGuiWindow* window);
+static bool             WindowDrawCacheBeginContents(ImGuiWindow* window);
+static void             WindowDrawCacheEndContents(ImGuiWindow* window);
 
 // Viewports
 const ImGuiID           IMGUI_VIEWPORT_DEFAULT_ID = 0x11111111; // Using an arbitrary constant instead of e.g. ImHashStr("ViewportDefault", 0); so it's easier to spot in the debugger. The exact value doesn't matter.
@@ -1166,6 +1168,7 @@ ImGuiIO::ImGuiIO()
     ConfigWindowsResizeFromEdges = true;
     ConfigWindowsMoveFromTitleBarOnly = false;
     ConfigMemoryCompactTimer = 60.0f;
+    ConfigDamageTracking = false;
 
     // Platform Functions
     BackendPlatformName = BackendRendererName = NULL;
@@ -1348,6 +1351,43 @@ ImVec2 ImLineClosestPoint(const ImVec2& a, const ImVec2& b, const ImVec2& p)
     return a + ab_dir * dot / ab_len_sqr;
 }
 
+// Liang-Barsky. Computed in double as one endpoint may be very far away, and clamped so results test as inside the rectangle.
+bool ImLineClipToRect(ImVec2& a, ImVec2& b, const ImVec2& r_min, const ImVec2& r_max)
+{
+    const double dx = (double)b.x - a.x, dy = (double)b.y - a.y;
+    const double p[4] = { -dx, dx, -dy, dy };
+    const double q[4] = { (double)a.x - r_min.x, (double)r_max.x - a.x, (double)a.y - r_min.y, (double)r_max.y - a.y };
+    double t0 = 0.0, t1 = 1.0;
+    for (int i = 0; i < 4; i++)
+    {
+        if (p[i] == 0.0)
+        {
+            if (q[i] < 0.0)
+                return false;
+            continue;
+        }
+        const double t = q[i] / p[i];
+        if (p[i] < 0.0)
+        {
+            if (t > t1)
+                return false;
+            t0 = ImMax(t0, t);
+        }
+        else
+        {
+            if (t < t0)
+                return false;
+            t1 = ImMin(t1, t);
+        }
+    }
+    const ImVec2 a0 = a;
+    if (t0 > 0.0)
+        a = ImClamp(ImVec2((float)(a0.x + dx * t0), (float)(a0.y + dy * t0)), r_min, r_max);
+    if (t1 < 1.0)
+        b = ImClamp(ImVec2((float)(a0.x + dx * t1), (float)(a0.y + dy * t1)), r_min, r_max);
+    return true;
+}
+
 bool ImTriangleContainsPoint(const ImVec2& a, const ImVec2& b, const ImVec2& c, const ImVec2& p)
 {
     bool b1 = ((p.x - b.x) * (a.y - b.y) - (p.y - b.y) * (a.x - b.x)) < 0.0f;
@@ -1465,19 +1505,123 @@ const char* ImStristr(const char* haystack, const char* haystack_end, const char
     if (!needle_end)
         needle_end = needle + strlen(needle);
 
-    const char un0 = (char)toupper(*needle);
-    while ((!haystack_end && *haystack) || (haystack_end && haystack < haystack_end))
+    // Empty needle never matches (as in ImStristrFolded)
+    const size_t needle_len = (size_t)(needle_end - needle);
+    if (needle_len == 0)
+        return NULL;
+
+    // Fold needle once so the search loop only has to fold the haystack side
+    char needle_folded_local[256];
+    char* needle_folded = (needle_len <= IM_ARRAYSIZE(needle_folded_local)) ? needle_folded_local : (char*)IM_ALLOC(needle_len);
+    for (size_t n = 0; n < needle_len; n++)
+        needle_folded[n] = ImCharFoldA(needle[n]);
+    const char* ret = ImStristrFolded(haystack, haystack_end, needle_folded, needle_folded + needle_len);
+    if (needle_folded != needle_folded_local)
+        IM_FREE(needle_folded);
+    return ret;
+}
+
+#ifdef IMGUI_ENABLE_SSE
+static inline int ImCountTrailingZeros(unsigned int v)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long index;
+    _BitScanForward(&index, v);
+    return (int)index;
+#else
+    return __builtin_ctz(v);
+#endif
+}
+
+// Fold 'A'-'Z' to 'a'-'z' for 16 bytes: bias the range to the bottom of signed char so a single compare detects it.
+static inline __m128i ImFoldA_SSE2(__m128i v)
+{
+    const __m128i upper = _mm_cmplt_epi8(_mm_add_epi8(v, _mm_set1_epi8((char)(0x80 - 'A'))), _mm_set1_epi8((char)(0x80 + 26)));
+    return _mm_or_si128(v, _mm_and_si128(upper, _mm_set1_epi8(0x20)));
+}
+
+#ifdef __AVX2__
+static inline __m256i ImFoldA_AVX2(__m256i v)
+{
+    const __m256i upper = _mm256_cmpgt_epi8(_mm256_set1_epi8((char)(0x80 + 26)), _mm256_add_epi8(v, _mm256_set1_epi8((char)(0x80 - 'A'))));
+    return _mm256_or_si256(v, _mm256_and_si256(upper, _mm256_set1_epi8(0x20)));
+}
+#endif
+#endif // IMGUI_ENABLE_SSE
+
+// Case-insensitive (ASCII) search with a pre-folded needle.
+// The SIMD path compares the first and last needle bytes against 16/32 candidate positions at a time,
+// and only verifies the middle of the needle for the (rare) positions where both match.
+const char* ImStristrFolded(const char* haystack, const char* haystack_end, const char* needle, const char* needle_end)
+{
+    if (!haystack_end)
+        haystack_end = haystack + strlen(haystack);
+    const size_t needle_len = (size_t)(needle_end - needle);
+    const size_t haystack_len = (size_t)(haystack_end - haystack);
+    if (needle_len == 0 || needle_len > haystack_len) // Empty needle never matches (as in the original byte loop)
+        return NULL;
+
+    const char n_first = needle[0];
+    const char n_last = needle[needle_len - 1];
+    const size_t last_pos = haystack_len - needle_len; // Last valid start position
+    size_t pos = 0;
+
+#ifdef IMGUI_ENABLE_SSE
+#ifdef __AVX2__
     {
-        if (toupper(*haystack) == un0)
+        const __m256i v_first = _mm256_set1_epi8(n_first);
+        const __m256i v_last = _mm256_set1_epi8(n_last);
+        for (; pos + 32 <= last_pos + 1; pos += 32)
         {
-            const char* b = needle + 1;
-            for (const char* a = haystack + 1; b < needle_end; a++, b++)
-                if (toupper(*a) != toupper(*b))
-                    break;
-            if (b == needle_end)
-                return haystack;
+            const __m256i block_first = ImFoldA_AVX2(_mm256_loadu_si256((const __m256i*)(haystack + pos)));
+            const __m256i block_last = ImFoldA_AVX2(_mm256_loadu_si256((const __m256i*)(haystack + pos + needle_len - 1)));
+            unsigned int mask = (unsigned int)_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(block_first, v_first), _mm256_cmpeq_epi8(block_last, v_last)));
+            while (mask != 0)
+            {
+                const char* candidate = haystack + pos + ImCountTrailingZeros(mask);
+                size_t n = 1;
+                while (n + 1 < needle_len && ImCharFoldA(candidate[n]) == needle[n])
+                    n++;
+                if (n + 1 >= needle_len)
+                    return candidate;
+                mask &= mask - 1;
+            }
         }
-        haystack++;
+    }
+#endif
+    {
+        const __m128i v_first = _mm_set1_epi8(n_first);
+        const __m128i v_last = _mm_set1_epi8(n_last);
+        for (; pos + 16 <= last_pos + 1; pos += 16)
+        {
+            const __m128i block_first = ImFoldA_SSE2(_mm_loadu_si128((const __m128i*)(haystack + pos)));
+            const __m128i block_last = ImFoldA_SSE2(_mm_loadu_si128((const __m128i*)(haystack + pos + needle_len - 1)));
+            unsigned int mask = (unsigned int)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(block_first, v_first), _mm_cmpeq_epi8(block_last, v_last)));
+            while (mask != 0)
+            {
+                const char* candidate = haystack + pos + ImCountTrailingZeros(mask);
+                size_t n = 1;
+                while (n + 1 < needle_len && ImCharFoldA(candidate[n]) == needle[n])
+                    n++;
+                if (n + 1 >= needle_len)
+                    return candidate;
+                mask &= mask - 1;
+            }
+        }
+    }
+#endif
+
+    // Scalar tail (or whole search without SSE)
+    for (; pos <= last_pos; pos++)
+    {
+        const char* candidate = haystack + pos;
+        if (ImCharFoldA(candidate[0]) != n_first || ImCharFoldA(candidate[needle_len - 1]) != n_last)
+            continue;
+        size_t n = 1;
+        while (n + 1 < needle_len && ImCharFoldA(candidate[n]) == needle[n])
+            n++;
+        if (n + 1 >= needle_len)
+            return candidate;
     }
     return NULL;
 }
@@ -1593,6 +1737,29 @@ ImGuiID ImHashData(const void* data_p, size_t data_size, ImU32 seed)
     return ~crc;
 }
 
+// 64-bit known size hash, a word at a time multiply-xorshift, for change detection of large buffers (e.g. draw data against the previous frame)
+// Not stable across versions or platforms (byte order), never persist or use it for IDs.
+ImU64 ImHashData64(const void* data_p, size_t data_size, ImU64 seed)
+{
+    const unsigned char* p = (const unsigned char*)data_p;
+    ImU64 h = seed ^ ((ImU64)data_size * 0x9E3779B97F4A7C15ULL);
+    for (; data_size >= 8; data_size -= 8, p += 8)
+    {
+        ImU64 v;
+        memcpy(&v, p, 8);
+        h = (h ^ v) * 0xFF51AFD7ED558CCDULL;
+        h ^= h >> 32;
+    }
+    if (data_size > 0)
+    {
+        ImU64 v = 0;
+        memcpy(&v, p, data_size);
+        h = (h ^ v) * 0xFF51AFD7ED558CCDULL;
+        h ^= h >> 32;
+    }
+    return h;
+}
+
 // Zero-terminated string hash, with support for ### to reset back to seed value
 // We support a syntax of "label###id" where only "###id" is included in the hash, and only "label" gets displayed.
 // Because this syntax is rarely used we are optimizing for the common case.
@@ -2127,7 +2294,7 @@ ImGuiTextFilter::ImGuiTextFilter(const char* default_filter)
     }
     else
     {
-        InputBuf[0] = 0;
+        InputBuf[0] = InputBufFolded[0] = 0;
         CountGrep = 0;
     }
 }
@@ -2162,6 +2329,11 @@ void ImGuiTextFilter::ImGuiTextRange::split(char separator, ImVector<ImGuiTextRa
 
 void ImGuiTextFilter::Build()
 {
+    // Pre-fold the whole input once, so PassFilter() doesn't have to fold needles for every tested string
+    for (int n = 0; n < IM_ARRAYSIZE(InputBuf); n++)
+        if ((InputBufFolded[n] = ImCharFoldA(InputBuf[n])) == 0)
+            break;
+
     Filters.resize(0);
     ImGuiTextRange input_range(InputBuf, InputBuf + strlen(InputBuf));
     input_range.split(',', &Filters);
@@ -2194,16 +2366,18 @@ bool ImGuiTextFilter::PassFilter(const char* text, const char* text_end) const
         const ImGuiTextRange& f = Filters[i];
         if (f.empty())
             continue;
+        const char* folded_b = InputBufFolded + (f.b - InputBuf);
+        const char* folded_e = InputBufFolded + (f.e - InputBuf);
         if (f.b[0] == '-')
         {
             // Subtract
-            if (ImStristr(text, text_end, f.b + 1, f.e) != NULL)
+            if (ImStristrFolded(text, text_end, folded_b + 1, folded_e) != NULL)
                 return false;
         }
         else
         {
             // Grep
-            if (ImStristr(text, text_end, f.b, f.e) != NULL)
+            if (ImStristrFolded(text, text_end, folded_b, folded_e) != NULL)
                 return true;
         }
     }
@@ -2215,6 +2389,19 @@ bool ImGuiTextFilter::PassFilter(const char* text, const char* text_end) const
     return false;
 }
 
+int ImGuiTextFilter::PassFilterMany(const char* const* texts, int texts_count, bool* out_pass, const char* const* texts_end) const
+{
+    int pass_count = 0;
+    for (int n = 0; n < texts_count; n++)
+    {
+        const bool pass = PassFilter(texts[n], texts_end ? texts_end[n] : NULL);
+        if (out_pass)
+            out_pass[n] = pass;
+        pass_count += pass ? 1 : 0;
+    }
+    return pass_count;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImGuiTextBuffer
 //-----------------------------------------------------------------------------
@@ -2400,10 +2587,107 @@ static void ImGuiListClipper_SeekCursorForItem(ImGuiListClipper* clipper, int it
     // StartPosY starts from ItemsFrozen hence the subtraction
     // Perform the add and multiply with double to allow seeking through larger ranges
     ImGuiListClipperData* data = (ImGuiListClipperData*)clipper->TempData;
+    if (ImGuiListClipperHeights* heights = data->Heights)
+    {
+        const double offset = heights->GetOffset(item_n) - heights->GetOffset(data->ItemsFrozen);
+        const float line_height = (item_n > 0 && item_n <= heights->Size()) ? heights->Heights[item_n - 1] : heights->DefaultHeight;
+        ImGuiListClipper_SeekCursorAndSetupPrevLine((float)((double)clipper->StartPosY + data->LossynessOffset + offset), ImMax(line_height, 1.0f));
+        return;
+    }
     float pos_y = (float)((double)clipper->StartPosY + data->LossynessOffset + (double)(item_n - data->ItemsFrozen) * clipper->ItemsHeight);
     ImGuiListClipper_SeekCursorAndSetupPrevLine(pos_y, clipper->ItemsHeight);
 }
 
+static void ImGuiListClipperHeights_BuildTree(ImGuiListClipperHeights* heights)
+{
+    // O(n) Fenwick tree construction: each node propagates its partial sum to its parent
+    const int count = heights->Heights.Size;
+    heights->Tree.resize(count + 1);
+    heights->Tree[0] = 0.0;
+    for (int i = 1; i <= count; i++)
+        heights->Tree[i] = heights->Heights[i - 1];
+    for (int i = 1; i <= count; i++)
+    {
+        const int parent = i + (i & -i);
+        if (parent <= count)
+            heights->Tree[parent] += heights->Tree[i];
+    }
+}
+
+void ImGuiListClipperHeights::Resize(int items_count)
+{
+    const int old_count = Heights.Size;
+    if (items_count == old_count && Tree.Size == items_count + 1)
+        return;
+    Heights.resize(items_count);
+    Measured.resize(items_count);
+    for (int n = old_count; n < items_count; n++)
+    {
+        Heights[n] = ImMax(DefaultHeight, 0.0f);
+        Measured[n] = false;
+    }
+    ImGuiListClipperHeights_BuildTree(this);
+}
+
+void ImGuiListClipperHeights::Clear()
+{
+    for (int n = 0; n < Heights.Size; n++)
+    {
+        Heights[n] = ImMax(DefaultHeight, 0.0f);
+        Measured[n] = false;
+    }
+    ImGuiListClipperHeights_BuildTree(this);
+}
+
+void ImGuiListClipperHeights::SetHeight(int item_n, float height)
+{
+    IM_ASSERT(item_n >= 0 && item_n < Heights.Size);
+    if (DefaultHeight <= 0.0f && height > 0.0f)
+    {
+        // First measurement becomes the estimate for all items not measured yet
+        DefaultHeight = height;
+        for (int n = 0; n < Heights.Size; n++)
+            if (!Measured[n])
+                Heights[n] = height;
+        ImGuiListClipperHeights_BuildTree(this);
+    }
+    Measured[item_n] = true;
+    const double delta = (double)height - (double)Heights[item_n];
+    if (delta == 0.0)
+        return;
+    Heights[item_n] = height;
+    for (int i = item_n + 1; i <= Heights.Size; i += (i & -i))
+        Tree[i] += delta;
+}
+
+double ImGuiListClipperHeights::GetOffset(int item_n) const
+{
+    IM_ASSERT(item_n >= 0 && item_n <= Heights.Size);
+    double offset = 0.0;
+    for (int i = item_n; i > 0; i -= (i & -i))
+        offset += Tree[i];
+    return offset;
+}
+
+int ImGuiListClipperHeights::GetIndexAtOffset(double offset) const
+{
+    // Binary lifting over the tree: find the number of items whose cumulated height is <= offset
+    const int count = Heights.Size;
+    if (count == 0)
+        return 0;
+    int step = 1;
+    while (step * 2 <= count)
+        step *= 2;
+    int pos = 0;
+    for (; step > 0; step >>= 1)
+        if (pos + step <= count && Tree[pos + step] <= offset)
+        {
+            pos += step;
+            offset -= Tree[pos];
+        }
+    return ImMin(pos, count - 1);
+}
+
 ImGuiListClipper::ImGuiListClipper()
 {
     memset(this, 0, sizeof(*this));
@@ -2442,6 +2726,16 @@ void ImGuiListClipper::Begin(int items_count, float items_height)
     TempData = data;
 }
 
+void ImGuiListClipper::BeginVariableHeight(int items_count, ImGuiListClipperHeights* heights)
+{
+    IM_ASSERT(heights != NULL);
+    IM_ASSERT(items_count >= 0 && items_count < INT_MAX && "Variable height mode requires a known number of items!");
+    Begin(items_count, -1.0f);
+    heights->Resize(items_count);
+    ImGuiListClipperData* data = (ImGuiListClipperData*)TempData;
+    data->Heights = heights;
+}
+
 void ImGuiListClipper::End()
 {
     // In theory here we should assert that we are already at the right position, but it seems saner to just seek at the end and not assert/crash the user.
@@ -2473,6 +2767,98 @@ void ImGuiListClipper::ForceDisplayRangeByIndices(int item_min, int item_max)
         data->Ranges.push_back(ImGuiListClipperRange::FromIndices(item_min, item_max));
 }
 
+// Variable height mode: items are handed out one at a time so the height of each submitted item can be measured and cached.
+// Heights of items that haven't been seen yet are estimated, so the visible range is extended on the fly if estimates were too large.
+static bool ImGuiListClipper_StepVariableHeight(ImGuiListClipper* clipper)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    ImGuiListClipperData* data = (ImGuiListClipperData*)clipper->TempData;
+    ImGuiListClipperHeights* heights = data->Heights;
+
+    // Measure item submitted since previous step
+    if (data->MeasureItem >= 0)
+    {
+        const float item_height = window->DC.CursorPos.y - data->MeasureStartY;
+        if (item_height > 0.0f || (item_height == 0.0f && heights->DefaultHeight > 0.0f))
+            heights->SetHeight(data->MeasureItem, item_height);
+    }
+
+    int next_item;
+    if (!data->MeasureRangesBuilt)
+    {
+        // First step after frozen rows: calculate the ranges of visible elements from cached heights
+        data->MeasureRangesBuilt = true;
+        clipper->StartPosY = window->DC.CursorPos.y;
+        if (g.LogEnabled)
+        {
+            // If logging is active, do not perform any clipping
+            data->Ranges.push_back(ImGuiListClipperRange::FromIndices(data->ItemsFrozen, clipper->ItemsCount));
+        }
+        else
+        {
+            // Same ranges as fixed height mode: navigation scoring, focused item, visible range
+            const bool is_nav_request = (g.NavMoveScoringItems && g.NavWindow && g.NavWindow->RootWindowForNav == window->RootWindowForNav);
+            if (is_nav_request)
+                data->Ranges.push_back(ImGuiListClipperRange::FromPositions(g.NavScoringNoClipRect.Min.y, g.NavScoringNoClipRect.Max.y, 0, 0));
+            if (is_nav_request && (g.NavMoveFlags & ImGuiNavMoveFlags_Tabbing) && g.NavTabbingDir == -1)
+                data->Ranges.push_back(ImGuiListClipperRange::FromIndices(clipper->ItemsCount - 1, clipper->ItemsCount));
+            ImRect nav_rect_abs = ImGui::WindowRectRelToAbs(window, window->NavRectRel[0]);
+            if (g.NavId != 0 && window->NavLastIds[0] == g.NavId)
+                data->Ranges.push_back(ImGuiListClipperRange::FromPositions(nav_rect_abs.Min.y, nav_rect_abs.Max.y, 0, 0));
+            const int off_min = (is_nav_request && g.NavMoveClipDir == ImGuiDir_Up) ? -1 : 0;
+            const int off_max = (is_nav_request && g.NavMoveClipDir == ImGuiDir_Down) ? 1 : 0;
+            data->Ranges.push_back(ImGuiListClipperRange::FromPositions(window->ClipRect.Min.y, window->ClipRect.Max.y, off_min, off_max));
+        }
+
+        // Convert position ranges to item index ranges, O(log n) each
+        const double base_offset = heights->GetOffset(data->ItemsFrozen) - (double)clipper->StartPosY - data->LossynessOffset;
+        for (int i = 0; i < data->Ranges.Size; i++)
+            if (data->Ranges[i].PosToIndexConvert)
+            {
+                const int m1 = heights->GetIndexAtOffset(base_offset + data->Ranges[i].Min);
+                const int m2 = (heights->DefaultHeight > 0.0f) ? heights->GetIndexAtOffset(base_offset + data->Ranges[i].Max) : m1; // Nothing measured yet: start with one item and extend
+                data->Ranges[i].Min = ImClamp(m1 + data->Ranges[i].PosToIndexOffsetMin, data->ItemsFrozen, clipper->ItemsCount - 1);
+                data->Ranges[i].Max = ImClamp(m2 + 1 + data->Ranges[i].PosToIndexOffsetMax, data->Ranges[i].Min + 1, clipper->ItemsCount);
+                data->Ranges[i].PosToIndexConvert = false;
+            }
+        ImGuiListClipper_SortAndFuseRanges(data->Ranges);
+        data->StepNo = 0;
+        next_item = data->Ranges.Size > 0 ? ImMax(data->Ranges[0].Min, data->ItemsFrozen) : clipper->ItemsCount;
+    }
+    else
+    {
+        // Extend current range while we are still inside the visible area
+        next_item = data->MeasureItem + 1;
+        ImGuiListClipperRange& range = data->Ranges[data->StepNo];
+        const float cursor_y = window->DC.CursorPos.y;
+        if (next_item >= range.Max && next_item < clipper->ItemsCount && cursor_y >= window->ClipRect.Min.y && cursor_y < window->ClipRect.Max.y)
+            range.Max = next_item + 1;
+        while (data->StepNo < data->Ranges.Size && data->Ranges[data->StepNo].Max <= next_item)
+            data->StepNo++;
+        if (data->StepNo < data->Ranges.Size)
+            next_item = ImMax(next_item, data->Ranges[data->StepNo].Min);
+        else
+            next_item = clipper->ItemsCount;
+    }
+
+    // Past the last range: advance the cursor to the end of the list and end the loop.
+    if (next_item >= clipper->ItemsCount)
+    {
+        ImGuiListClipper_SeekCursorForItem(clipper, clipper->ItemsCount);
+        clipper->ItemsCount = -1;
+        return false;
+    }
+
+    if (next_item != data->MeasureItem + 1 || data->MeasureItem < 0)
+        ImGuiListClipper_SeekCursorForItem(clipper, next_item);
+    clipper->DisplayStart = next_item;
+    clipper->DisplayEnd = next_item + 1;
+    data->MeasureItem = next_item;
+    data->MeasureStartY = window->DC.CursorPos.y;
+    return true;
+}
+
 bool ImGuiListClipper::Step()
 {
     ImGuiContext& g = *GImGui;
@@ -2499,6 +2885,13 @@ bool ImGuiListClipper::Step()
         return true;
     }
 
+    if (data->Heights != NULL)
+    {
+        if (!ImGuiListClipper_StepVariableHeight(this))
+            return (void)End(), false;
+        return true;
+    }
+
     // Step 0: Let you process the first element (regardless of it being visible or not, so we can measure the element height)
     bool calc_clipping = false;
     if (data->StepNo == 0)
@@ -3220,6 +3613,10 @@ void ImGui::GcCompactTransientWindowBuffers(ImGuiWindow* window)
     window->MemoryDrawListVtxCapacity = window->DrawList->VtxBuffer.Capacity;
     window->IDStack.clear();
     window->DrawList->_ClearFreeMemory();
+    window->DrawCache.CmdBuffer.clear();
+    window->DrawCache.IdxBuffer.clear();
+    window->DrawCache.VtxBuffer.clear();
+    window->DrawCache.Valid = false;
     window->DC.ChildWindows.clear();
     window->DC.ItemWidthStack.clear();
     window->DC.TextWrapPosStack.clear();
@@ -3496,7 +3893,11 @@ float ImGui::CalcWrapWidthForPos(const ImVec2& pos, float wrap_pos_x)
 void* ImGui::MemAlloc(size_t size)
 {
     if (ImGuiContext* ctx = GImGui)
+    {
         ctx->IO.MetricsActiveAllocations++;
+        ctx->MemStatsCurrFrame.AllocCount[ctx->MemTagCurrent]++;
+        ctx->MemStatsCurrFrame.AllocBytes[ctx->MemTagCurrent] += size;
+    }
     return (*GImAllocatorAllocFunc)(size, GImAllocatorUserData);
 }
 
@@ -3505,10 +3906,26 @@ void ImGui::MemFree(void* ptr)
 {
     if (ptr)
         if (ImGuiContext* ctx = GImGui)
+        {
             ctx->IO.MetricsActiveAllocations--;
+            ctx->MemStatsCurrFrame.FreeCount++;
+        }
     return (*GImAllocatorFreeFunc)(ptr, GImAllocatorUserData);
 }
 
+// Allocations are attributed to the innermost tagged scope, e.g. a window created by a BeginTable() call will be tagged as ImGuiMemTag_Window.
+// Safe to call without a current context (e.g. when building a font atlas ahead of CreateContext()).
+ImGuiMemTag ImGui::SetMemTag(ImGuiMemTag tag)
+{
+    IM_ASSERT(tag >= 0 && tag < ImGuiMemTag_COUNT);
+    ImGuiContext* ctx = GImGui;
+    if (ctx == NULL)
+        return ImGuiMemTag_Misc;
+    ImGuiMemTag backup_tag = ctx->MemTagCurrent;
+    ctx->MemTagCurrent = tag;
+    return backup_tag;
+}
+
 const char* ImGui::GetClipboardText()
 {
     ImGuiContext& g = *GImGui;
@@ -3654,6 +4071,9 @@ static ImDrawList* GetViewportDrawList(ImGuiViewportP* viewport, size_t drawlist
     if (viewport->DrawListsLastFrame[drawlist_no] != g.FrameCount)
     {
         draw_list->_ResetForNewFrame();
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+        draw_list->VtxOrigin = viewport->Pos;
+#endif
         draw_list->PushTextureID(g.IO.Fonts->TexID);
         draw_list->PushClipRect(viewport->Pos, viewport->Pos + viewport->Size, false);
         viewport->DrawListsLastFrame[drawlist_no] = g.FrameCount;
@@ -4143,6 +4563,7 @@ void ImGui::NewFrame()
             g.Hooks.erase(&g.Hooks[n]);
 
     CallContextHooks(&g, ImGuiContextHookType_NewFramePre);
+    const ImGuiMemTag backup_mem_tag = SetMemTag(ImGuiMemTag_Frame);
 
     // Check and assert for various common IO and Configuration mistakes
     g.ConfigFlagsLastFrame = g.ConfigFlagsCurrFrame;
@@ -4155,6 +4576,8 @@ void ImGui::NewFrame()
     g.Time += g.IO.DeltaTime;
     g.WithinFrameScope = true;
     g.FrameCount += 1;
+    g.MemStatsLastFrame = g.MemStatsCurrFrame;
+    g.MemStatsCurrFrame = ImGuiMemStats();
     g.TooltipOverrideCount = 0;
     g.WindowsActiveCount = 0;
     g.MenusIdSubmittedThisFrame.resize(0);
@@ -4353,6 +4776,7 @@ void ImGui::NewFrame()
     Begin("Debug##Default");
     IM_ASSERT(g.CurrentWindow->IsFallbackWindow == true);
 
+    SetMemTag(backup_mem_tag);
     CallContextHooks(&g, ImGuiContextHookType_NewFramePost);
 }
 
@@ -4609,6 +5033,9 @@ static void SetupViewportDrawData(ImGuiViewportP* viewport, ImVector<ImDrawList*
     draw_data->DisplaySize = is_minimized ? ImVec2(0.0f, 0.0f) : viewport->Size;
     draw_data->FramebufferScale = io.DisplayFramebufferScale; // FIXME-VIEWPORT: This may vary on a per-monitor/viewport basis?
     draw_data->OwnerViewport = viewport;
+    draw_data->HasDamageRects = false;
+    draw_data->DamageRectsCount = 0;
+    draw_data->DamageRects = NULL;
     for (int n = 0; n < draw_lists->Size; n++)
     {
         draw_data->TotalVtxCount += draw_lists->Data[n]->VtxBuffer.Size;
@@ -4766,6 +5193,7 @@ void ImGui::EndFrame()
     IM_ASSERT(g.WithinFrameScope && "Forgot to call ImGui::NewFrame()?");
 
     CallContextHooks(&g, ImGuiContextHookType_EndFramePre);
+    const ImGuiMemTag backup_mem_tag = SetMemTag(ImGuiMemTag_Frame);
 
     ErrorCheckEndFrameSanityChecks();
 
@@ -4843,6 +5271,7 @@ void ImGui::EndFrame()
     g.IO.KeyModsPrev = g.IO.KeyMods; // doing it here is better than in NewFrame() as we'll tolerate backend writing to KeyMods. If we want to firmly disallow it we should detect it.
     memset(g.IO.NavInputs, 0, sizeof(g.IO.NavInputs));
 
+    SetMemTag(backup_mem_tag);
     CallContextHooks(&g, ImGuiContextHookType_EndFramePost);
 }
 
@@ -4861,6 +5290,7 @@ void ImGui::Render()
     g.IO.MetricsRenderWindows = 0;
 
     CallContextHooks(&g, ImGuiContextHookType_RenderPre);
+    const ImGuiMemTag backup_mem_tag = SetMemTag(ImGuiMemTag_Frame);
 
     // Add background ImDrawList (for each active viewport)
     for (int n = 0; n != g.Viewports.Size; n++)
@@ -4916,10 +5346,15 @@ void ImGui::Render()
 
         SetupViewportDrawData(viewport, &viewport->DrawDataBuilder.Layers[0]);
         ImDrawData* draw_data = viewport->DrawData;
+        if (g.IO.ConfigDamageTracking)
+            viewport->DrawDataDamage.Update(draw_data);
+        else if (viewport->DrawDataDamage.HasPrevFrame)
+            viewport->DrawDataDamage.Clear();
         g.IO.MetricsRenderVertices += draw_data->TotalVtxCount;
         g.IO.MetricsRenderIndices += draw_data->TotalIdxCount;
     }
 
+    SetMemTag(backup_mem_tag);
     CallContextHooks(&g, ImGuiContextHookType_RenderPost);
 }
 
@@ -6063,6 +6498,213 @@ static ImGuiWindow* ImGui::FindBlockingModal(ImGuiWindow* window)
     return NULL;
 }
 
+// Hash everything the contents of a window depend on, apart from the window position which is handled by translating the geometry.
+static ImGuiID WindowDrawCacheCalcKey(ImGuiWindow* window)
+{
+    ImGuiContext& g = *GImGui;
+    struct
+    {
+        ImVec2              Size, Scroll, InnerMin, InnerMax, InnerClipMin, InnerClipMax, CursorStartPos, VtxOrigin, TexUvWhitePixel;
+        ImGuiID             ViewportId;
+        ImGuiWindowFlags    Flags;
+        ImDrawListFlags     DrawListFlags;
+        int                 ContentVersion;
+        float               FontSize;
+        ImFont*             Font;
+        ImTextureID         FontTexId;
+    } key;
+    memset(&key, 0, sizeof(key)); // Clear padding
+    key.Size = window->Size;
+    key.Scroll = window->Scroll;
+    key.InnerMin = window->InnerRect.Min - window->Pos;
+    key.InnerMax = window->InnerRect.Max - window->Pos;
+    key.InnerClipMin = window->InnerClipRect.Min - window->Pos;
+    key.InnerClipMax = window->InnerClipRect.Max - window->Pos;
+    key.CursorStartPos = window->DC.CursorStartPos - window->Pos;
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    key.VtxOrigin = window->DrawList->VtxOrigin;
+#endif
+    key.TexUvWhitePixel = g.DrawListSharedData.TexUvWhitePixel;
+    key.ViewportId = window->ViewportId;
+    key.Flags = window->Flags;
+    key.DrawListFlags = window->DrawList->Flags;
+    key.ContentVersion = window->DrawCache.ContentVersion;
+    key.FontSize = g.FontSize;
+    key.Font = g.Font;
+    key.FontTexId = g.Font->ContainerAtlas->TexID;
+    return ImHashData(&g.Style, sizeof(g.Style), ImHashData(&key, sizeof(key)));
+}
+
+// The contents of a window react to mouse hovering, active items, keyboard navigation, popups and drag and drop: only retain them while left alone.
+// Moving the window by its title bar doesn't affect the contents, they are translated.
+static bool WindowDrawCacheIsIdle(ImGuiWindow* window)
+{
+    ImGuiContext& g = *GImGui;
+    if (window->Appearing || window->AutoFitFramesX > 0 || window->AutoFitFramesY > 0 || window->HiddenFramesCannotSkipItems > 0)
+        return false;
+    if (g.LogEnabled || g.DragDropActive || g.DebugItemPickerActive)
+        return false;
+    const bool is_moving = (g.MovingWindow != NULL && g.ActiveId == g.MovingWindow->MoveId && g.MovingWindow->RootWindowDockTree == window->RootWindowDockTree);
+    if (!is_moving)
+    {
+        if (g.HoveredWindow == window && window->InnerClipRect.Contains(g.IO.MousePos))
+            return false;
+        if (g.ActiveIdWindow == window)
+            return false;
+        if (g.NavWindow == window && (!g.NavDisableHighlight || g.NavAnyRequest || g.NavActivateId != 0))
+            return false;
+    }
+    for (int n = 0; n < g.OpenPopupStack.Size; n++)
+        if (g.OpenPopupStack[n].SourceWindow == window)
+            return false;
+    return true;
+}
+
+// Append the recorded contents geometry to the window draw list, translated to the current window position.
+static bool WindowDrawCacheReplay(ImGuiWindow* window)
+{
+    ImGuiWindowDrawCache* cache = &window->DrawCache;
+    ImDrawList* draw_list = window->DrawList;
+    if (sizeof(ImDrawIdx) == 2 && !(draw_list->Flags & ImDrawListFlags_AllowVtxOffset) && draw_list->_VtxCurrentIdx + cache->VtxBuffer.Size >= (1 << 16))
+        return false;
+
+    const ImVec2 offset = window->Pos - cache->Pos;
+    const unsigned int vtx_base = (unsigned int)draw_list->VtxBuffer.Size;
+    draw_list->VtxBuffer.resize(draw_list->VtxBuffer.Size + cache->VtxBuffer.Size);
+    ImDrawVert* vtx_write = draw_list->VtxBuffer.Data + vtx_base;
+    memcpy(vtx_write, cache->VtxBuffer.Data, (size_t)cache->VtxBuffer.size_in_bytes());
+    if (offset.x != 0.0f || offset.y != 0.0f)
+        for (int n = 0; n < cache->VtxBuffer.Size; n++)
+            draw_list->SetVtx(&vtx_write[n], draw_list->GetVtxPos(vtx_write[n]) + offset, draw_list->GetVtxUV(vtx_write[n]), vtx_write[n].col);
+
+    for (int cmd_n = 0; cmd_n < cache->CmdBuffer.Size; cmd_n++)
+    {
+        const ImGuiWindowDrawCacheCmd* cmd = &cache->CmdBuffer[cmd_n];
+        const unsigned int vtx_offset = vtx_base + cmd->VtxOffset;
+        if (sizeof(ImDrawIdx) == 2 && vtx_offset + cmd->VtxCount - draw_list->_CmdHeader.VtxOffset > (1 << 16))
+        {
+            draw_list->_CmdHeader.VtxOffset = vtx_offset;
+            draw_list->_OnChangedVtxOffset();
+        }
+        draw_list->_CmdHeader.ClipRect = ImVec4(cmd->ClipRect.x + offset.x, cmd->ClipRect.y + offset.y, cmd->ClipRect.z + offset.x, cmd->ClipRect.w + offset.y);
+        draw_list->_CmdHeader.TextureId = cmd->TextureId;
+        draw_list->_OnChangedClipRect();
+        draw_list->_OnChangedTextureID();
+
+        const unsigned int idx_add = vtx_offset - draw_list->_CmdHeader.VtxOffset;
+        const int idx_base = draw_list->IdxBuffer.Size;
+        draw_list->IdxBuffer.resize(idx_base + (int)cmd->ElemCount);
+        ImDrawIdx* idx_write = draw_list->IdxBuffer.Data + idx_base;
+        const ImDrawIdx* idx_read = cache->IdxBuffer.Data + cmd->IdxOffset;
+        for (unsigned int n = 0; n < cmd->ElemCount; n++)
+            idx_write[n] = (ImDrawIdx)(idx_read[n] + idx_add);
+        draw_list->CmdBuffer.back().ElemCount += cmd->ElemCount;
+    }
+
+    // Restore the state left by Begin()
+    draw_list->_CmdHeader.ClipRect = draw_list->_ClipRectStack.back();
+    draw_list->_CmdHeader.TextureId = draw_list->_TextureIdStack.back();
+    draw_list->_OnChangedClipRect();
+    draw_list->_OnChangedTextureID();
+    draw_list->_VtxCurrentIdx = (unsigned int)draw_list->VtxBuffer.Size - draw_list->_CmdHeader.VtxOffset;
+    draw_list->_VtxWritePtr = draw_list->VtxBuffer.Data + draw_list->VtxBuffer.Size;
+    draw_list->_IdxWritePtr = draw_list->IdxBuffer.Data + draw_list->IdxBuffer.Size;
+
+    // Preserve contents size for the next frame
+    window->DC.CursorMaxPos = window->DC.CursorStartPos + cache->CursorMaxPos;
+    window->DC.IdealMaxPos = window->DC.CursorStartPos + cache->IdealMaxPos;
+    window->DC.CursorPos = window->DC.CursorStartPos + cache->CursorPos;
+    window->DC.CursorPosPrevLine = window->DC.CursorStartPos + cache->CursorPosPrevLine;
+    return true;
+}
+
+// Called at the end of the first Begin() of the frame for windows using ImGuiWindowFlags_RetainDrawList.
+// Return true when the contents were replayed and don't need to be submitted, otherwise start recording them until End().
+static bool ImGui::WindowDrawCacheBeginContents(ImGuiWindow* window)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindowDrawCache* cache = &window->DrawCache;
+    const ImGuiID key = WindowDrawCacheCalcKey(window);
+    const bool is_idle = WindowDrawCacheIsIdle(window);
+    if (is_idle && cache->Valid && cache->Key == key && WindowDrawCacheReplay(window))
+    {
+        cache->LastFrameReplayed = g.FrameCount;
+        cache->HitCount++;
+        return true;
+    }
+
+    // Anything could have changed while the window wasn't idle (e.g. user clicked a checkbox), record again on the next idle frame.
+    cache->Valid = false;
+    cache->MissCount++;
+    if (is_idle)
+    {
+        ImDrawList* draw_list = window->DrawList;
+        cache->Key = key;
+        cache->Recording = true;
+        cache->RecordCmdStart = draw_list->CmdBuffer.Size - 1;
+        cache->RecordIdxStart = draw_list->IdxBuffer.Size;
+        cache->RecordVtxStart = draw_list->VtxBuffer.Size;
+    }
+    return false;
+}
+
+static void ImGui::WindowDrawCacheEndContents(ImGuiWindow* window)
+{
+    ImGuiWindowDrawCache* cache = &window->DrawCache;
+    ImDrawList* draw_list = window->DrawList;
+    cache->Recording = false;
+
+    // Child windows have their own draw list and need their Begin()/End() to be called, we can't retain those contents.
+    if (!WindowDrawCacheIsIdle(window) || window->DC.ChildWindows.Size > 0 || draw_list->_Splitter._Count > 1 || draw_list != &window->DrawListInst)
+        return;
+
+    cache->CmdBuffer.resize(0);
+    cache->IdxBuffer.resize(0);
+    cache->VtxBuffer.resize(0);
+    for (int cmd_n = cache->RecordCmdStart; cmd_n < draw_list->CmdBuffer.Size; cmd_n++)
+    {
+        const ImDrawCmd* src_cmd = &draw_list->CmdBuffer[cmd_n];
+        if (src_cmd->UserCallback != NULL)
+            return;
+        const unsigned int idx_start = ImMax(src_cmd->IdxOffset, (unsigned int)cache->RecordIdxStart);
+        const unsigned int idx_end = src_cmd->IdxOffset + src_cmd->ElemCount;
+        if (idx_end <= idx_start)
+            continue;
+
+        // Store indices relative to the first vertex they use
+        const ImDrawIdx* idx_read = draw_list->IdxBuffer.Data + idx_start;
+        unsigned int vtx_min = (unsigned int)-1, vtx_max = 0;
+        for (unsigned int n = 0; n < idx_end - idx_start; n++)
+        {
+            vtx_min = ImMin(vtx_min, (unsigned int)idx_read[n]);
+            vtx_max = ImMax(vtx_max, (unsigned int)idx_read[n]);
+        }
+        IM_ASSERT(src_cmd->VtxOffset + vtx_min >= (unsigned int)cache->RecordVtxStart);
+
+        ImGuiWindowDrawCacheCmd cmd;
+        cmd.ClipRect = src_cmd->ClipRect;
+        cmd.TextureId = src_cmd->TextureId;
+        cmd.VtxOffset = src_cmd->VtxOffset + vtx_min - (unsigned int)cache->RecordVtxStart;
+        cmd.VtxCount = vtx_max - vtx_min + 1;
+        cmd.IdxOffset = (unsigned int)cache->IdxBuffer.Size;
+        cmd.ElemCount = idx_end - idx_start;
+        cache->CmdBuffer.push_back(cmd);
+        cache->IdxBuffer.resize(cache->IdxBuffer.Size + (int)cmd.ElemCount);
+        ImDrawIdx* idx_write = cache->IdxBuffer.Data + cmd.IdxOffset;
+        for (unsigned int n = 0; n < cmd.ElemCount; n++)
+            idx_write[n] = (ImDrawIdx)(idx_read[n] - vtx_min);
+    }
+    const int vtx_count = draw_list->VtxBuffer.Size - cache->RecordVtxStart;
+    cache->VtxBuffer.resize(vtx_count);
+    memcpy(cache->VtxBuffer.Data, draw_list->VtxBuffer.Data + cache->RecordVtxStart, (size_t)vtx_count * sizeof(ImDrawVert));
+    cache->Pos = window->Pos;
+    cache->CursorMaxPos = window->DC.CursorMaxPos - window->DC.CursorStartPos;
+    cache->IdealMaxPos = window->DC.IdealMaxPos - window->DC.CursorStartPos;
+    cache->CursorPos = window->DC.CursorPos - window->DC.CursorStartPos;
+    cache->CursorPosPrevLine = window->DC.CursorPosPrevLine - window->DC.CursorStartPos;
+    cache->Valid = true;
+}
+
 // Push a new Dear ImGui window to add widgets to.
 // - A default window called "Debug" is automatically stacked at the beginning of every frame so you can use widgets without explicitly calling a Begin/End pair.
 // - Begin/End can be called multiple times during the frame with the same window name to append content.
@@ -6077,6 +6719,7 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
     IM_ASSERT(name != NULL && name[0] != '\0');     // Window name required
     IM_ASSERT(g.WithinFrameScope);                  // Forgot to call ImGui::NewFrame()
     IM_ASSERT(g.FrameCountEnded != g.FrameCount);   // Called ImGui::Render() or ImGui::EndFrame() and haven't called ImGui::NewFrame() again yet
+    const ImGuiMemTag backup_mem_tag = SetMemTag(ImGuiMemTag_Window);
 
     // Find or create
     ImGuiWindow* window = FindWindowByName(name);
@@ -6241,6 +6884,8 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         window->ContentSizeExplicit = ImVec2(0.0f, 0.0f);
     if (g.NextWindowData.Flags & ImGuiNextWindowDataFlags_HasWindowClass)
         window->WindowClass = g.NextWindowData.WindowClass;
+    if (first_begin_of_the_frame)
+        window->DrawCache.ContentVersion = (g.NextWindowData.Flags & ImGuiNextWindowDataFlags_HasContentVersion) ? g.NextWindowData.ContentVersionVal : 0;
     if (g.NextWindowData.Flags & ImGuiNextWindowDataFlags_HasCollapsed)
         SetWindowCollapsed(window, g.NextWindowData.CollapsedVal, g.NextWindowData.CollapsedCond);
     if (g.NextWindowData.Flags & ImGuiNextWindowDataFlags_HasFocus)
@@ -6631,6 +7276,9 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
 
         // Setup draw list and outer clipping rectangle
         IM_ASSERT(window->DrawList->CmdBuffer.Size == 1 && window->DrawList->CmdBuffer[0].ElemCount == 0);
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+        window->DrawList->VtxOrigin = window->Viewport->Pos;
+#endif
         window->DrawList->PushTextureID(g.Font->ContainerAtlas->TexID);
         PushClipRect(host_rect.Min, host_rect.Max, false);
 
@@ -6877,8 +7525,22 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         // - in BeginDocked() path when DockNodeIsVisible == DockTabIsVisible == true -> hidden _should_ be all zero // FIXME: Not formally proven, hence the assert.
         if (window->SkipItems && !window->Appearing)
             IM_ASSERT(window->Appearing == false); // Please report on GitHub if this triggers: https://github.com/ocornut/imgui/issues/4177
+
+        // Retained contents: reuse last frame geometry and skip items, or record the contents submitted until End()
+        if ((flags & ImGuiWindowFlags_RetainDrawList) && !(flags & ImGuiWindowFlags_DockNodeHost) && !window->SkipItems)
+            if (WindowDrawCacheBeginContents(window))
+                window->SkipItems = true;
+    }
+    else if (flags & ImGuiWindowFlags_RetainDrawList)
+    {
+        // Appending to the window: the cache only holds the contents of the first Begin()/End(), stop reusing it.
+        // Contents skipped by a replay this frame were already drawn from the cache, the appended ones must be submitted.
+        window->DrawCache.Valid = false;
+        if (window->DrawCache.LastFrameReplayed == g.FrameCount)
+            window->SkipItems = false;
     }
 
+    SetMemTag(backup_mem_tag);
     return !window->SkipItems;
 }
 
@@ -6898,10 +7560,13 @@ void ImGui::End()
     // Error checking: verify that user doesn't directly call End() on a child window.
     if ((window->Flags & ImGuiWindowFlags_ChildWindow) && !(window->Flags & ImGuiWindowFlags_DockNodeHost) && !window->DockIsActive)
         IM_ASSERT_USER_ERROR(g.WithinEndChild, "Must call EndChild() and not End()!");
+    const ImGuiMemTag backup_mem_tag = SetMemTag(ImGuiMemTag_Window);
 
     // Close anything that is open
     if (window->DC.CurrentColumns)
         EndColumns();
+    if (window->DrawCache.Recording)
+        WindowDrawCacheEndContents(window);
     if (!(window->Flags & ImGuiWindowFlags_DockNodeHost))   // Pop inner window clip rectangle
         PopClipRect();
 
@@ -6925,6 +7590,7 @@ void ImGui::End()
     SetCurrentWindow(g.CurrentWindowStack.Size == 0 ? NULL : g.CurrentWindowStack.back().Window);
     if (g.CurrentWindow)
         SetCurrentViewport(g.CurrentWindow, g.CurrentWindow->Viewport);
+    SetMemTag(backup_mem_tag);
 }
 
 void ImGui::BringWindowToFocusFront(ImGuiWindow* window)
@@ -7591,6 +8257,13 @@ void ImGui::SetNextWindowViewport(ImGuiID id)
     g.NextWindowData.ViewportId = id;
 }
 
+void ImGui::SetNextWindowContentVersion(int version)
+{
+    ImGuiContext& g = *GImGui;
+    g.NextWindowData.Flags |= ImGuiNextWindowDataFlags_HasContentVersion;
+    g.NextWindowData.ContentVersionVal = version;
+}
+
 void ImGui::SetNextWindowDockID(ImGuiID id, ImGuiCond cond)
 {
     ImGuiContext& g = *GImGui;
@@ -12264,6 +12937,11 @@ static void ImGui::UpdateViewportsNewFrame()
         viewport->BuildWorkOffsetMin = viewport->BuildWorkOffsetMax = ImVec2(0.0f, 0.0f);
         viewport->UpdateWorkRect();
 
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+        // Compact vertex positions are relative to the viewport position and can't reach further than IMGUI_COMPACT_DRAWVERT_POS_MAX
+        IM_ASSERT(viewport->Size.x <= IMGUI_COMPACT_DRAWVERT_POS_MAX && viewport->Size.y <= IMGUI_COMPACT_DRAWVERT_POS_MAX && "Viewport too large for IMGUI_USE_COMPACT_DRAWVERT, lower IMGUI_COMPACT_DRAWVERT_SUBPIXEL_BITS!");
+#endif
+
         // Reset alpha every frame. Users of transparency (docking) needs to request a lower alpha back.
         viewport->Alpha = 1.0f;
 
@@ -17083,6 +17761,28 @@ void ImGui::ShowMetricsWindow(bool* p_open)
     Text("Dear ImGui %s", GetVersion());
     Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / io.Framerate, io.Framerate);
     Text("%d vertices, %d indices (%d triangles)", io.MetricsRenderVertices, io.MetricsRenderIndices, io.MetricsRenderIndices / 3);
+    if (g.DebugDrawMergeFrame >= g.FrameCount - 1)
+        Text("%d draw calls, %d after ImDrawDataMerger", g.DebugDrawMergeCmdCountIn, g.DebugDrawMergeCmdCountOut);
+    {
+        // Windows using ImGuiWindowFlags_RetainDrawList, as of the last frame they were submitted
+        int retained_count = 0, replayed_count = 0, replayed_vtx_count = 0, hit_count = 0, miss_count = 0;
+        for (int n = 0; n < g.Windows.Size; n++)
+        {
+            ImGuiWindow* window = g.Windows[n];
+            if (!(window->Flags & ImGuiWindowFlags_RetainDrawList) || window->LastFrameActive < g.FrameCount - 1)
+                continue;
+            retained_count++;
+            if (window->DrawCache.LastFrameReplayed == window->LastFrameActive)
+            {
+                replayed_count++;
+                replayed_vtx_count += window->DrawCache.VtxBuffer.Size;
+            }
+            hit_count += window->DrawCache.HitCount;
+            miss_count += window->DrawCache.MissCount;
+        }
+        if (retained_count > 0)
+            Text("%d/%d retained windows reused (%d vertices), %.1f%% hit rate", replayed_count, retained_count, replayed_vtx_count, hit_count * 100.0f / ImMax(hit_count + miss_count, 1));
+    }
     Text("%d visible windows, %d active allocations", io.MetricsRenderWindows, io.MetricsActiveAllocations);
     //SameLine(); if (SmallButton("GC")) { g.GcCompactAll = true; }
 
@@ -17343,6 +18043,38 @@ void ImGui::ShowMetricsWindow(bool* p_open)
     }
 #endif
 
+    // Details for Memory
+    if (TreeNode("Memory"))
+    {
+        const ImGuiMemStats& stats = g.MemStatsLastFrame;
+        static const char* tag_names[] = { "Misc", "Frame", "Window", "Table", "Font", "Plot" };
+        IM_STATIC_ASSERT(IM_ARRAYSIZE(tag_names) == ImGuiMemTag_COUNT);
+        int total_count = 0;
+        size_t total_bytes = 0;
+        for (int tag = 0; tag < ImGuiMemTag_COUNT; tag++)
+        {
+            total_count += stats.AllocCount[tag];
+            total_bytes += stats.AllocBytes[tag];
+        }
+        Text("Last frame: %d allocations (%d bytes), %d frees", total_count, (int)total_bytes, stats.FreeCount);
+        Text("Active allocations: %d", g.IO.MetricsActiveAllocations);
+        if (BeginTable("##memtags", 3, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit))
+        {
+            TableSetupColumn("Tag");
+            TableSetupColumn("Allocs");
+            TableSetupColumn("Bytes");
+            TableHeadersRow();
+            for (int tag = 0; tag < ImGuiMemTag_COUNT; tag++)
+            {
+                TableNextColumn(); TextUnformatted(tag_names[tag]);
+                TableNextColumn(); Text("%d", stats.AllocCount[tag]);
+                TableNextColumn(); Text("%d", (int)stats.AllocBytes[tag]);
+            }
+            EndTable();
+        }
+        TreePop();
+    }
+
     // Details for Docking
 #ifdef IMGUI_HAS_DOCK
     if (TreeNode("Docking"))
@@ -17716,7 +18448,7 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, ImGuiViewportP* viewport, con
         {
             ImVec2 triangle[3];
             for (int n = 0; n < 3; n++, idx_n++)
-                triangle[n] = vtx_buffer[idx_buffer ? idx_buffer[idx_n] : idx_n].pos;
+                triangle[n] = draw_list->GetVtxPos(vtx_buffer[idx_buffer ? idx_buffer[idx_n] : idx_n]);
             total_area += ImTriangleArea(triangle[0], triangle[1], triangle[2]);
         }
 
@@ -17737,9 +18469,10 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, ImGuiViewportP* viewport, con
                 for (int n = 0; n < 3; n++, idx_i++)
                 {
                     const ImDrawVert& v = vtx_buffer[idx_buffer ? idx_buffer[idx_i] : idx_i];
-                    triangle[n] = v.pos;
+                    const ImVec2 uv = draw_list->GetVtxUV(v);
+                    triangle[n] = draw_list->GetVtxPos(v);
                     buf_p += ImFormatString(buf_p, buf_end - buf_p, "%s %04d: pos (%8.2f,%8.2f), uv (%.6f,%.6f), col %08X\n",
-                        (n == 0) ? "Vert:" : "     ", idx_i, v.pos.x, v.pos.y, v.uv.x, v.uv.y, v.col);
+                        (n == 0) ? "Vert:" : "     ", idx_i, triangle[n].x, triangle[n].y, uv.x, uv.y, v.col);
                 }
 
                 Selectable(buf, false);
@@ -17773,7 +18506,7 @@ void ImGui::DebugNodeDrawCmdShowMeshAndBoundingBox(ImDrawList* out_draw_list, co
 
         ImVec2 triangle[3];
         for (int n = 0; n < 3; n++, idx_n++)
-            vtxs_rect.Add((triangle[n] = vtx_buffer[idx_buffer ? idx_buffer[idx_n] : idx_n].pos));
+            vtxs_rect.Add((triangle[n] = draw_list->GetVtxPos(vtx_buffer[idx_buffer ? idx_buffer[idx_n] : idx_n])));
         if (show_mesh)
             out_draw_list->AddPolyline(triangle, 3, IM_COL32(255, 255, 0, 255), ImDrawFlags_Closed, 1.0f); // In yellow: mesh triangles
     }
@@ -17963,6 +18696,17 @@ void ImGui::DebugNodeViewport(ImGuiViewportP* viewport)
             (flags & ImGuiViewportFlags_Minimized) ? " Minimized" : "",
             (flags & ImGuiViewportFlags_NoAutoMerge) ? " NoAutoMerge" : "",
             (flags & ImGuiViewportFlags_CanHostOtherWindows) ? " CanHostOtherWindows" : "");
+        if (viewport->DrawDataDamage.HasPrevFrame)
+        {
+            const ImVector<ImVec4>& rects = viewport->DrawDataDamage.Rects;
+            float area = 0.0f;
+            for (int n = 0; n < rects.Size; n++)
+                area += (rects[n].z - rects[n].x) * (rects[n].w - rects[n].y);
+            BulletText("Damage: %d rects, %.1f%% of viewport", rects.Size, area * 100.0f / ImMax(viewport->Size.x * viewport->Size.y, 1.0f));
+            if (IsItemHovered())
+                for (int n = 0; n < rects.Size; n++)
+                    GetForegroundDrawList(viewport)->AddRect(ImVec2(rects[n].x, rects[n].y), ImVec2(rects[n].z, rects[n].w), IM_COL32(255, 0, 255, 255));
+        }
         for (int layer_i = 0; layer_i < IM_ARRAYSIZE(viewport->DrawDataBuilder.Layers); layer_i++)
             for (int draw_list_i = 0; draw_list_i < viewport->DrawDataBuilder.Layers[layer_i].Size; draw_list_i++)
                 DebugNodeDrawList(NULL, viewport, viewport->DrawDataBuilder.Layers[layer_i][draw_list_i], "DrawList");
@@ -18003,6 +18747,12 @@ void ImGui::DebugNodeWindow(ImGuiWindow* window, const char* label)
     BulletText("Scroll: (%.2f/%.2f,%.2f/%.2f) Scrollbar:%s%s", window->Scroll.x, window->ScrollMax.x, window->Scroll.y, window->ScrollMax.y, window->ScrollbarX ? "X" : "", window->ScrollbarY ? "Y" : "");
     BulletText("Active: %d/%d, WriteAccessed: %d, BeginOrderWithinContext: %d", window->Active, window->WasActive, window->WriteAccessed, (window->Active || window->WasActive) ? window->BeginOrderWithinContext : -1);
     BulletText("Appearing: %d, Hidden: %d (CanSkip %d Cannot %d), SkipItems: %d", window->Appearing, window->Hidden, window->HiddenFramesCanSkipItems, window->HiddenFramesCannotSkipItems, window->SkipItems);
+    if (flags & ImGuiWindowFlags_RetainDrawList)
+    {
+        const ImGuiWindowDrawCache* cache = &window->DrawCache;
+        BulletText("DrawCache: %s, %d cmds, %d vtx, %d idx, ContentVersion: %d", cache->Valid ? "Valid" : "Invalid", cache->CmdBuffer.Size, cache->VtxBuffer.Size, cache->IdxBuffer.Size, cache->ContentVersion);
+        BulletText("DrawCache: %d hits, %d misses (%.1f%%), reused last frame: %d", cache->HitCount, cache->MissCount, cache->HitCount * 100.0f / ImMax(cache->HitCount + cache->MissCount, 1), cache->LastFrameReplayed == window->LastFrameActive);
+    }
     for (int layer = 0; layer < ImGuiNavLayer_COUNT; layer++)
     {
         ImRect r = window->NavRectRel[layer];
@@ -140,10 +140,11 @@ Index of this file:
 struct ImDrawChannel;               // Temporary storage to output draw commands out of order, used by ImDrawListSplitter and ImDrawList::ChannelsSplit()
 struct ImDrawCmd;                   // A single draw command within a parent ImDrawList (generally maps to 1 GPU draw call, unless it is a callback)
 struct ImDrawData;                  // All draw command lists required to render the frame + pos/size coordinates to use for the projection matrix.
+struct ImDrawDataMerger;            // Optional pass after Render(): copies a ImDrawData into as few draw lists and draw calls as possible.
 struct ImDrawList;                  // A single draw command list (generally one per window, conceptually you may see this as a dynamic "mesh" builder)
 struct ImDrawListSharedData;        // Data shared among multiple draw lists (typically owned by parent ImGui context, but you may create one yourself)
 struct ImDrawListSplitter;          // Helper to split a draw list into different layers which can be drawn into out of order, then flattened back.
-struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
+struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default, 12 bytes with IMGUI_USE_COMPACT_DRAWVERT. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
 struct ImFont;                      // Runtime data for a single font within a parent ImFontAtlas
 struct ImFontAtlas;                 // Runtime data for multiple fonts, bake multiple fonts into a single texture, TTF/OTF font loader
 struct ImFontBuilderIO;             // Opaque interface to a font builder (stb_truetype or FreeType).
@@ -155,6 +156,7 @@ struct ImGuiContext;                // Dear ImGui context (opaque structure, unl
 struct ImGuiIO;                     // Main configuration and I/O between your application and ImGui
 struct ImGuiInputTextCallbackData;  // Shared state of InputText() when using custom ImGuiInputTextCallback (rare/advanced use)
 struct ImGuiListClipper;            // Helper to manually clip large list of items
+struct ImGuiListClipperHeights;     // Helper to store per-item heights for ImGuiListClipper variable height mode
 struct ImGuiOnceUponAFrame;         // Helper for running a block of code not more than once a frame
 struct ImGuiPayload;                // User data payload for drag and drop operations
 struct ImGuiPlatformIO;             // Multi-viewport support: interface for Platform/Renderer backends + viewports to render
@@ -166,6 +168,7 @@ struct ImGuiStyle;                  // Runtime data for styling/colors
 struct ImGuiTableSortSpecs;         // Sorting specifications for a table (often handling sort specs for a single column, occasionally more)
 struct ImGuiTableColumnSortSpecs;   // Sorting specification for one column of a table
 struct ImGuiTextBuffer;             // Helper to hold and append into a text buffer (~string builder)
+struct ImGuiTextDocument;           // Helper to hold and edit large text for InputTextLarge() (piece table + line index + delta undo stack)
 struct ImGuiTextFilter;             // Helper to parse and apply text filters (e.g. "aaaaa[,bbbbb][,ccccc]")
 struct ImGuiViewport;               // A Platform Window (always 1 unless multi-viewport are enabled. One per platform window to output to). In the future may represent Platform Monitor
 struct ImGuiWindowClass;            // Window class (rare/advanced uses: provide hints to the platform backend via altered viewport flags and parent/child info)
@@ -379,6 +382,7 @@ namespace ImGui
     IMGUI_API void          SetNextWindowFocus();                                                       // set next window to be focused / top-most. call before Begin()
     IMGUI_API void          SetNextWindowBgAlpha(float alpha);                                          // set next window background color alpha. helper to easily override the Alpha component of ImGuiCol_WindowBg/ChildBg/PopupBg. you may also use ImGuiWindowFlags_NoBackground.
     IMGUI_API void          SetNextWindowViewport(ImGuiID viewport_id);                                 // set next window viewport
+    IMGUI_API void          SetNextWindowContentVersion(int version);                                   // set next window contents version, for windows using ImGuiWindowFlags_RetainDrawList: change it whenever the data displayed by the window changes (default to 0). call before Begin()
     IMGUI_API void          SetWindowPos(const ImVec2& pos, ImGuiCond cond = 0);                        // (not recommended) set current window position - call within Begin()/End(). prefer using SetNextWindowPos(), as this may incur tearing and side-effects.
     IMGUI_API void          SetWindowSize(const ImVec2& size, ImGuiCond cond = 0);                      // (not recommended) set current window size - call within Begin()/End(). set to ImVec2(0, 0) to force an auto-fit. prefer using SetNextWindowSize(), as this may incur tearing and minor side-effects.
     IMGUI_API void          SetWindowCollapsed(bool collapsed, ImGuiCond cond = 0);                     // (not recommended) set current window collapsed state. prefer using SetNextWindowCollapsed().
@@ -585,6 +589,7 @@ namespace ImGui
     IMGUI_API bool          InputText(const char* label, char* buf, size_t buf_size, ImGuiInputTextFlags flags = 0, ImGuiInputTextCallback callback = NULL, void* user_data = NULL);
     IMGUI_API bool          InputTextMultiline(const char* label, char* buf, size_t buf_size, const ImVec2& size = ImVec2(0, 0), ImGuiInputTextFlags flags = 0, ImGuiInputTextCallback callback = NULL, void* user_data = NULL);
     IMGUI_API bool          InputTextWithHint(const char* label, const char* hint, char* buf, size_t buf_size, ImGuiInputTextFlags flags = 0, ImGuiInputTextCallback callback = NULL, void* user_data = NULL);
+    IMGUI_API bool          InputTextLarge(const char* label, ImGuiTextDocument* doc, const ImVec2& size = ImVec2(0, 0), ImGuiInputTextFlags flags = 0); // Multi-line editor for multi-megabyte text, see ImGuiTextDocument. Supports ReadOnly, AllowTabInput, NoUndoRedo flags.
     IMGUI_API bool          InputFloat(const char* label, float* v, float step = 0.0f, float step_fast = 0.0f, const char* format = "%.3f", ImGuiInputTextFlags flags = 0);
     IMGUI_API bool          InputFloat2(const char* label, float v[2], const char* format = "%.3f", ImGuiInputTextFlags flags = 0);
     IMGUI_API bool          InputFloat3(const char* label, float v[3], const char* format = "%.3f", ImGuiInputTextFlags flags = 0);
@@ -1014,6 +1019,7 @@ enum ImGuiWindowFlags_
     ImGuiWindowFlags_NoNavFocus             = 1 << 19,  // No focusing toward this window with gamepad/keyboard navigation (e.g. skipped by CTRL+TAB)
     ImGuiWindowFlags_UnsavedDocument        = 1 << 20,  // Display a dot next to the title. When used in a tab/docking context, tab is selected when clicking the X + closure is not assumed (will wait for user to stop submitting the tab). Otherwise closure is assumed when pressing the X, so if you keep submitting the tab may reappear at end of tab bar.
     ImGuiWindowFlags_NoDocking              = 1 << 21,  // Disable docking of this window
+    ImGuiWindowFlags_RetainDrawList         = 1 << 22,  // Reuse the contents geometry of the previous frame while nothing it depends on changed (size, scroll, style, font, SetNextWindowContentVersion() value) and the window is not hovered/focused/active. Begin() returns false when reusing: skip your contents like for a collapsed window. Contents must not create child windows. Appending with another Begin() in the same frame disables the reuse.
 
     ImGuiWindowFlags_NoNav                  = ImGuiWindowFlags_NoNavInputs | ImGuiWindowFlags_NoNavFocus,
     ImGuiWindowFlags_NoDecoration           = ImGuiWindowFlags_NoTitleBar | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoScrollbar | ImGuiWindowFlags_NoCollapse,
@@ -1939,6 +1945,7 @@ struct ImGuiIO
     bool        ConfigWindowsResizeFromEdges;   // = true           // Enable resizing of windows from their edges and from the lower-left corner. This requires (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors) because it needs mouse cursor feedback. (This used to be a per-window ImGuiWindowFlags_ResizeFromAnySide flag)
     bool        ConfigWindowsMoveFromTitleBarOnly; // = false       // Enable allowing to move windows only when clicking on their title bar. Does not apply to windows without a title bar.
     float       ConfigMemoryCompactTimer;       // = 60.0f          // Timer (in seconds) to free transient windows/tables memory buffers when unused. Set to -1.0f to disable.
+    bool        ConfigDamageTracking;           // = false          // Compare each frame's draw data with the previous one and report changed areas in ImDrawData::DamageRects, so renderers may redraw partially (or not at all when nothing changed).
 
     //------------------------------------------------------------------
     // Platform Functions
@@ -2192,6 +2199,7 @@ struct ImGuiTextFilter
     IMGUI_API           ImGuiTextFilter(const char* default_filter = "");
     IMGUI_API bool      Draw(const char* label = "Filter (inc,-exc)", float width = 0.0f);  // Helper calling InputText+Build
     IMGUI_API bool      PassFilter(const char* text, const char* text_end = NULL) const;
+    IMGUI_API int       PassFilterMany(const char* const* texts, int texts_count, bool* out_pass, const char* const* texts_end = NULL) const; // Test a batch of strings, return number of passing ones. Const: large arrays may be split into ranges tested from multiple threads.
     IMGUI_API void      Build();
     void                Clear()          { InputBuf[0] = 0; Build(); }
     bool                IsActive() const { return !Filters.empty(); }
@@ -2208,6 +2216,7 @@ struct ImGuiTextFilter
         IMGUI_API void  split(char separator, ImVector<ImGuiTextRange>* out) const;
     };
     char                    InputBuf[256];
+    char                    InputBufFolded[256];    // ASCII lower-cased copy of InputBuf made by Build(), Filters[] map into it at the same offsets
     ImVector<ImGuiTextRange>Filters;
     int                     CountGrep;
 };
@@ -2233,6 +2242,77 @@ struct ImGuiTextBuffer
     IMGUI_API void      appendfv(const char* fmt, va_list args) IM_FMTLIST(2);
 };
 
+// Helper: Large text storage, edited with InputTextLarge().
+// InputTextMultiline() converts the whole buffer to wide chars and rescans it on every edit, which doesn't scale to multi-megabyte text.
+// - Text is stored as a piece table: edits never move existing text, they append to the Added buffer and split the Pieces list.
+// - PieceStarts[] and LineStarts[] are updated incrementally on edits, offset -> piece and line <-> offset lookups are a binary search.
+// - Undo/redo records store deltas (position + removed/inserted text), the oldest are dropped once their text grows past UndoTextMax.
+// - Offsets are in bytes of UTF-8 text.
+struct ImGuiTextDocument
+{
+    struct ImGuiTextPiece
+    {
+        bool            InAdded;            // Source buffer: Added (true) or Original (false)
+        int             Offset;             // Offset in source buffer
+        int             Length;
+    };
+    struct ImGuiTextUndoRecord
+    {
+        int             Pos;
+        int             RemovedOffset, RemovedLen;      // Removed text, in UndoText
+        int             InsertedOffset, InsertedLen;    // Inserted text, in UndoText
+        int             CursorBefore;
+    };
+    // Sorted offsets, shifted lazily: entries from StepFrom on are stored without Step. Shifting every entry after an edit
+    // then only touches the entries between it and the previous edit, so localized edits (typing) don't depend on the size.
+    struct ImGuiTextOffsets
+    {
+        ImVector<int>   Values;
+        int             StepFrom, Step;
+        ImGuiTextOffsets()              { StepFrom = Step = 0; }
+        int Size() const                { return Values.Size; }
+        int operator[](int n) const     { return Values[n] + ((n >= StepFrom) ? Step : 0); }
+    };
+
+    ImVector<char>                  Original;       // Text given to SetText()
+    ImVector<char>                  Added;          // Append-only storage for inserted text
+    ImVector<ImGuiTextPiece>        Pieces;
+    ImGuiTextOffsets                PieceStarts;    // Offset of each piece in the text
+    ImGuiTextOffsets                LineStarts;     // Offset of the first character of each line, LineStarts[0] == 0
+    int                             Length;         // Total text length in bytes
+    ImVector<ImGuiTextUndoRecord>   UndoStack;
+    ImVector<ImGuiTextUndoRecord>   RedoStack;
+    ImVector<char>                  UndoText;
+    int                             UndoTextMax;    // Undo history is trimmed to about half of this many bytes of text when it grows past it, 0 for no limit (default 16 MB)
+    bool                            UndoMergeable;  // Next insertion can be merged with last undo record (contiguous typing)
+
+    // Editing state, used by InputTextLarge()
+    int                             Cursor;
+    int                             SelectStart;    // == Cursor when no selection
+    float                           PreferredX;     // Cursor x position maintained across Up/Down moves, -1.0f if not set
+    float                           WidestLine;     // Widest line measured so far, for horizontal scrolling extent
+    float                           CursorAnim;
+    ImVector<char>                  LineBuf;        // Scratch buffer for a line of text
+    ImVector<char>                  InputBuf;       // Scratch buffer for the characters typed in a frame
+
+    IMGUI_API ImGuiTextDocument();
+    IMGUI_API void      SetText(const char* text, const char* text_end = NULL);     // Reset contents and undo history
+    IMGUI_API void      GetText(ImVector<char>* out) const;                         // Zero-terminated copy of the whole text
+    IMGUI_API void      CopyRange(int pos, int len, ImVector<char>* out) const;     // Zero-terminated copy of [pos, pos+len)
+    IMGUI_API char      GetChar(int pos) const;
+    IMGUI_API void      Replace(int pos, int remove_len, const char* text, int text_len, bool record_undo = true);
+    void                Insert(int pos, const char* text, int text_len)             { Replace(pos, 0, text, text_len); }
+    void                Erase(int pos, int len)                                     { Replace(pos, len, NULL, 0); }
+    IMGUI_API bool      Undo();
+    IMGUI_API bool      Redo();
+    void                ClearUndo()                                                 { UndoStack.resize(0); RedoStack.resize(0); UndoText.resize(0); UndoMergeable = false; }
+    int                 GetLineCount() const                                        { return LineStarts.Size(); }
+    int                 GetLineStart(int line) const                                { return LineStarts[line]; }
+    int                 GetLineEnd(int line) const                                  { return (line + 1 < LineStarts.Size()) ? LineStarts[line + 1] - 1 : Length; } // Excluding '\n'
+    IMGUI_API int       GetLineFromOffset(int pos) const;
+    bool                HasSelection() const                                        { return SelectStart != Cursor; }
+};
+
 // Helper: Key->Value storage
 // Typically you don't have to worry about this since a storage is held within each Window.
 // We use it to e.g. store collapse state for a tree (Int 0/1)
@@ -2324,11 +2404,36 @@ struct ImGuiListClipper
     // Call ForceDisplayRangeByIndices() before first call to Step() if you need a range of items to be displayed regardless of visibility.
     IMGUI_API void  ForceDisplayRangeByIndices(int item_min, int item_max); // item_max is exclusive e.g. use (42, 42+1) to make item 42 always visible BUT due to alignment/padding of certain items it is likely that an extra item may be included on either end of the display range.
 
+    // Variable height mode: items may have different heights, which are measured as they are submitted and stored in 'heights'.
+    // - 'heights' needs to persist across frames (one per list), unmeasured items use heights->DefaultHeight (or the first measured height if <= 0.0f).
+    // - Step() hands out visible items one at a time (DisplayEnd == DisplayStart + 1) so each one can be measured. Use the same loop as above.
+    IMGUI_API void  BeginVariableHeight(int items_count, ImGuiListClipperHeights* heights);
+
 #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
     inline ImGuiListClipper(int items_count, float items_height = -1.0f) { memset(this, 0, sizeof(*this)); ItemsCount = -1; Begin(items_count, items_height); } // [removed in 1.79]
 #endif
 };
 
+// Helper: per-item heights storage for ImGuiListClipper::BeginVariableHeight().
+// Prefix sums are kept in a Fenwick tree (in double precision, to stay exact enough over millions of items),
+// so both updating one item height and mapping a scroll offset to an item index are O(log n).
+struct ImGuiListClipperHeights
+{
+    ImVector<float>     Heights;            // Height of each item, including item spacing. Unmeasured items hold DefaultHeight.
+    ImVector<double>    Tree;               // [Internal] Fenwick tree of Heights[], 1-based
+    ImVector<bool>      Measured;           // [Internal] Set once an item has been submitted and measured
+    float               DefaultHeight;      // Estimated height for unmeasured items. Set <= 0.0f to use the first measured item.
+
+    ImGuiListClipperHeights(float default_height = -1.0f) { DefaultHeight = default_height; }
+    IMGUI_API void      Resize(int items_count);                // Keep existing measurements, new items use DefaultHeight
+    IMGUI_API void      Clear();                                // Forget all measurements (e.g. when the contents of all items changed)
+    IMGUI_API void      SetHeight(int item_n, float height);
+    IMGUI_API double    GetOffset(int item_n) const;            // Sum of heights of items [0, item_n)
+    IMGUI_API int       GetIndexAtOffset(double offset) const;  // Item covering 'offset' (clamped to valid indices)
+    double              GetTotalHeight() const                  { return GetOffset(Heights.Size); }
+    int                 Size() const                            { return Heights.Size; }
+};
+
 // Helpers macros to generate 32-bit encoded colors
 #ifdef IMGUI_USE_BGRA_PACKED_COLOR
 #define IM_COL32_R_SHIFT    16
@@ -2418,13 +2523,33 @@ struct ImDrawCmd
 };
 
 // Vertex layout
-#ifndef IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT
+#if !defined(IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT) && !defined(IMGUI_USE_COMPACT_DRAWVERT)
 struct ImDrawVert
 {
     ImVec2  pos;
     ImVec2  uv;
     ImU32   col;
 };
+#elif defined(IMGUI_USE_COMPACT_DRAWVERT)
+// Compact 12 bytes layout, enabled with IMGUI_USE_COMPACT_DRAWVERT in imconfig.h.
+// Read and write vertices with ImDrawList::SetVtx(), GetVtxPos(), GetVtxUV(): positions are relative to the owning ImDrawList::VtxOrigin.
+#ifndef IMGUI_COMPACT_DRAWVERT_SUBPIXEL_BITS
+#define IMGUI_COMPACT_DRAWVERT_SUBPIXEL_BITS    3
+#endif
+#define IMGUI_COMPACT_DRAWVERT_POS_MAX          (32767.0f / (float)(1 << IMGUI_COMPACT_DRAWVERT_SUBPIXEL_BITS)) // Furthest encodable position from VtxOrigin, in pixels (~4096 with 3 sub-pixel bits)
+struct ImDrawVert
+{
+    ImS16   pos[2];     // Fixed point, 1 unit = 1/(1 << IMGUI_COMPACT_DRAWVERT_SUBPIXEL_BITS) pixel
+    ImU16   uv[2];      // Normalized, 65535 = 1.0f
+    ImU32   col;
+
+    // Out of range positions are clamped per component: exact for axis aligned geometry, but it would bend slanted edges,
+    // so AddPolyline() and ImPlot lines clip to the range beforehand, and NewFrame() asserts viewports fit in it.
+    static inline ImS16 EncodePos(float v) { v *= (float)(1 << IMGUI_COMPACT_DRAWVERT_SUBPIXEL_BITS); return (ImS16)(v <= -32767.0f ? -32767 : v >= 32767.0f ? 32767 : (int)(v >= 0.0f ? v + 0.5f : v - 0.5f)); }
+    static inline float DecodePos(ImS16 v) { return (float)v * (1.0f / (float)(1 << IMGUI_COMPACT_DRAWVERT_SUBPIXEL_BITS)); }
+    static inline ImU16 EncodeUV(float v)  { v *= 65535.0f; return (ImU16)(v <= 0.0f ? 0 : v >= 65535.0f ? 65535 : (int)(v + 0.5f)); }
+    static inline float DecodeUV(ImU16 v)  { return (float)v * (1.0f / 65535.0f); }
+};
 #else
 // You can override the vertex format layout by defining IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT in imconfig.h
 // The code expect ImVec2 pos (8 bytes), ImVec2 uv (8 bytes), ImU32 col (4 bytes), but you can re-order them or add other fields as needed to simplify integration in your engine.
@@ -2513,6 +2638,9 @@ struct ImDrawList
     ImVector<ImDrawIdx>     IdxBuffer;          // Index buffer. Each command consume ImDrawCmd::ElemCount of those
     ImVector<ImDrawVert>    VtxBuffer;          // Vertex buffer.
     ImDrawListFlags         Flags;              // Flags, you may poke into these to adjust anti-aliasing settings per-primitive.
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    ImVec2                  VtxOrigin;          // Vertex positions are stored relative to this. Set to the viewport position by ImGui, renderers add it back.
+#endif
 
     // [Internal, used while building lists]
     unsigned int            _VtxCurrentIdx;     // [Internal] generally == VtxBuffer.Size unless we are past 64K vertices, in which case this gets reset to 0.
@@ -2607,10 +2735,24 @@ struct ImDrawList
     IMGUI_API void  PrimRect(const ImVec2& a, const ImVec2& b, ImU32 col);      // Axis aligned rectangle (composed of two triangles)
     IMGUI_API void  PrimRectUV(const ImVec2& a, const ImVec2& b, const ImVec2& uv_a, const ImVec2& uv_b, ImU32 col);
     IMGUI_API void  PrimQuadUV(const ImVec2& a, const ImVec2& b, const ImVec2& c, const ImVec2& d, const ImVec2& uv_a, const ImVec2& uv_b, const ImVec2& uv_c, const ImVec2& uv_d, ImU32 col);
-    inline    void  PrimWriteVtx(const ImVec2& pos, const ImVec2& uv, ImU32 col)    { _VtxWritePtr->pos = pos; _VtxWritePtr->uv = uv; _VtxWritePtr->col = col; _VtxWritePtr++; _VtxCurrentIdx++; }
+    inline    void  PrimWriteVtx(const ImVec2& pos, const ImVec2& uv, ImU32 col)    { SetVtx(_VtxWritePtr, pos, uv, col); _VtxWritePtr++; _VtxCurrentIdx++; }
     inline    void  PrimWriteIdx(ImDrawIdx idx)                                     { *_IdxWritePtr = idx; _IdxWritePtr++; }
     inline    void  PrimVtx(const ImVec2& pos, const ImVec2& uv, ImU32 col)         { PrimWriteIdx((ImDrawIdx)_VtxCurrentIdx); PrimWriteVtx(pos, uv, col); } // Write vertex with unique index
 
+    // Advanced: Vertex access
+    // - Use these rather than the ImDrawVert fields so code works with every vertex layout (see IMGUI_USE_COMPACT_DRAWVERT in imconfig.h).
+#ifndef IMGUI_USE_COMPACT_DRAWVERT
+    inline    void  SetVtx(ImDrawVert* vtx, const ImVec2& pos, const ImVec2& uv, ImU32 col) const { vtx->pos = pos; vtx->uv = uv; vtx->col = col; }
+    inline    void  SetVtxUV(ImDrawVert* vtx, const ImVec2& uv) const                          { vtx->uv = uv; }
+    inline    ImVec2 GetVtxPos(const ImDrawVert& vtx) const                                    { return vtx.pos; }
+    inline    ImVec2 GetVtxUV(const ImDrawVert& vtx) const                                     { return vtx.uv; }
+#else
+    inline    void  SetVtx(ImDrawVert* vtx, const ImVec2& pos, const ImVec2& uv, ImU32 col) const { vtx->pos[0] = ImDrawVert::EncodePos(pos.x - VtxOrigin.x); vtx->pos[1] = ImDrawVert::EncodePos(pos.y - VtxOrigin.y); SetVtxUV(vtx, uv); vtx->col = col; }
+    inline    void  SetVtxUV(ImDrawVert* vtx, const ImVec2& uv) const                          { vtx->uv[0] = ImDrawVert::EncodeUV(uv.x); vtx->uv[1] = ImDrawVert::EncodeUV(uv.y); }
+    inline    ImVec2 GetVtxPos(const ImDrawVert& vtx) const                                    { return ImVec2(VtxOrigin.x + ImDrawVert::DecodePos(vtx.pos[0]), VtxOrigin.y + ImDrawVert::DecodePos(vtx.pos[1])); }
+    inline    ImVec2 GetVtxUV(const ImDrawVert& vtx) const                                     { return ImVec2(ImDrawVert::DecodeUV(vtx.uv[0]), ImDrawVert::DecodeUV(vtx.uv[1])); }
+#endif
+
 #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
     inline    void  AddBezierCurve(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, ImU32 col, float thickness, int num_segments = 0) { AddBezierCubic(p1, p2, p3, p4, col, thickness, num_segments); } // OBSOLETED in 1.80 (Jan 2021)
     inline    void  PathBezierCurveTo(const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, int num_segments = 0) { PathBezierCubicCurveTo(p2, p3, p4, num_segments); } // OBSOLETED in 1.80 (Jan 2021)
@@ -2643,6 +2785,9 @@ struct ImDrawData
     ImVec2          DisplaySize;            // Size of the viewport to render (== GetMainViewport()->Size for the main viewport, == io.DisplaySize in most single-viewport applications)
     ImVec2          FramebufferScale;       // Amount of pixels for each unit of DisplaySize. Based on io.DisplayFramebufferScale. Generally (1,1) on normal display, (2,2) on OSX with Retina display.
     ImGuiViewport*  OwnerViewport;          // Viewport carrying the ImDrawData instance, might be of use to the renderer (generally not).
+    bool            HasDamageRects;         // Set when io.ConfigDamageTracking is enabled. DamageRectsCount == 0 then means this frame renders exactly like the previous one.
+    int             DamageRectsCount;       // Number of rectangles in DamageRects
+    const ImVec4*   DamageRects;            // Areas which changed since the previous frame, same coordinates as ImDrawCmd::ClipRect (x1, y1, x2, y2), rounded outward to whole pixels. The first frame and display size changes damage the whole display.
 
     // Functions
     ImDrawData()    { Clear(); }
@@ -2651,6 +2796,25 @@ struct ImDrawData
     IMGUI_API void  ScaleClipRects(const ImVec2& fb_scale); // Helper to scale the ClipRect field of each ImDrawCmd. Use if your final output buffer is at a different scale than Dear ImGui expects, or if there is a difference between your window resolution and framebuffer resolution.
 };
 
+// Optional pass after Render(), producing a regular ImDrawData that any renderer backend can draw instead of the source one.
+// - All draw lists are copied into as few draw lists as possible: one with 32-bit indices, otherwise one per 64K vertices (VtxOffset is always 0).
+// - Consecutive ImDrawCmd sharing a texture are merged, across windows, child windows and table columns, when the clip rectangles allow it:
+//   a command whose vertices are all inside its clip rectangle doesn't need it, so it can take the clip rectangle of its neighbors.
+// - User callbacks are kept in order and break merging. They receive the merged ImDrawList as 'parent_list'.
+// Usage: 'static ImDrawDataMerger merger; ImGui_ImplXXXX_RenderDrawData(merger.Merge(ImGui::GetDrawData()));'
+struct ImDrawDataMerger
+{
+    ImDrawData              DrawData;           // Output, valid until the next Merge()
+    ImVector<ImDrawList*>   DrawLists;          // Output draw lists, owned. DrawData.CmdLists points here.
+    int                     CmdCountIn;         // Draw calls of the last merged ImDrawData, as a backend would issue them (user callbacks included)
+    int                     CmdCountOut;        // Draw calls after merging
+
+    ImDrawDataMerger()      { CmdCountIn = CmdCountOut = 0; }
+    ~ImDrawDataMerger()     { ClearFreeMemory(); }
+    IMGUI_API ImDrawData*   Merge(const ImDrawData* src);
+    IMGUI_API void          ClearFreeMemory();
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Font API (ImFontConfig, ImFontGlyph, ImFontAtlasFlags, ImFontAtlas, ImFontGlyphRangesBuilder, ImFont)
 //-----------------------------------------------------------------------------
@@ -2775,6 +2939,18 @@ struct ImFontAtlas
     bool                        IsBuilt() const             { return Fonts.Size > 0 && TexReady; } // Bit ambiguous: used to detect when user didn't built texture but effectively we should check TexID != 0 except that would be backend dependent...
     void                        SetTexID(ImTextureID id)    { TexID = id; }
 
+    // Baked atlas cache (skip the font builder entirely on startup).
+    // - Save*() serialize the output of Build(): texture pixels, glyphs, lookup tables, custom rects packing.
+    // - Load*() restore it if the cache was made from identical inputs (see CalcBuildHash()), else return false and leave the atlas unbuilt.
+    // - Add your fonts and custom rects first, then call BuildCached() instead of Build(). It will rebuild and rewrite the file on mismatch.
+    // - LoadBakedFromMemory() doesn't keep a reference to 'data', so you may pass it a memory-mapped file and unmap it after the call.
+    IMGUI_API bool              BuildCached(const char* filename);
+    IMGUI_API bool              LoadBakedFromFile(const char* filename);
+    IMGUI_API bool              LoadBakedFromMemory(const void* data, size_t data_size);
+    IMGUI_API bool              SaveBakedToFile(const char* filename) const;
+    IMGUI_API bool              SaveBakedToMemory(ImVector<unsigned char>* out_data) const;
+    IMGUI_API ImU32             CalcBuildHash() const;      // Hash of all Build() inputs: TTF data, ImFontConfig fields, glyph ranges, user custom rects and atlas settings.
+
     //-------------------------------------------
     // Glyph Ranges
     //-------------------------------------------
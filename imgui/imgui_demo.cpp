@@ -1410,6 +1410,28 @@ static void ShowDemoWindowWidgets()
             ImGui::TreePop();
         }
 
+        IMGUI_DEMO_MARKER("Widgets/Text Input/Large Text Input");
+        if (ImGui::TreeNode("Large Text Input"))
+        {
+            // InputTextLarge() edits a ImGuiTextDocument (piece table + line index) instead of a flat buffer,
+            // so editing cost doesn't depend on the size of the text and only visible lines are rendered.
+            static ImGuiTextDocument doc;
+            static int lines_count = 0;
+            HelpMarker("InputTextLarge() operates on a ImGuiTextDocument. Edits and undo/redo don't copy the whole text, and only visible lines are laid out and rendered.");
+            if (ImGui::Button("Generate 100000 lines") || lines_count == 0)
+            {
+                ImGuiTextBuffer buf;
+                lines_count = 100000;
+                for (int n = 0; n < lines_count; n++)
+                    buf.appendf("%06d: The quick brown fox jumps over the lazy dog.\n", n);
+                doc.SetText(buf.begin(), buf.end());
+            }
+            ImGui::SameLine();
+            ImGui::Text("%d lines, %d bytes, %d undo records", doc.GetLineCount(), doc.Length, doc.UndoStack.Size);
+            ImGui::InputTextLarge("##large", &doc, ImVec2(-FLT_MIN, ImGui::GetTextLineHeight() * 16), ImGuiInputTextFlags_AllowTabInput);
+            ImGui::TreePop();
+        }
+
         IMGUI_DEMO_MARKER("Widgets/Text Input/Filtered Text Input");
         if (ImGui::TreeNode("Filtered Text Input"))
         {
@@ -3258,6 +3280,66 @@ static void ShowDemoWindowLayout()
         ImGui::TreePop();
     }
 
+    IMGUI_DEMO_MARKER("Layout/Variable height clipper");
+    if (ImGui::TreeNode("Variable height clipper"))
+    {
+        HelpMarker(
+            "ImGuiListClipper::BeginVariableHeight() clips lists of items with different heights.\n"
+            "Heights are measured as items become visible and cached in a ImGuiListClipperHeights instance.");
+        static ImGuiListClipperHeights heights;
+        static ImGuiListClipperHeights table_heights;
+        static int items_count = 1000000;
+        static bool use_table = false;
+        ImGui::SliderInt("Items", &items_count, 1, 10000000, "%d", ImGuiSliderFlags_Logarithmic);
+        ImGui::Checkbox("Use table with a frozen row", &use_table);
+        ImGui::SameLine(); HelpMarker("The first item is submitted as a frozen row (without a header row) before visible rows are measured.");
+        ImGui::Text("Total height: %.0f", use_table ? table_heights.GetTotalHeight() : heights.GetTotalHeight());
+        if (use_table)
+        {
+            if (ImGui::BeginTable("##VariableHeightClipperTable", 2, ImGuiTableFlags_ScrollY | ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersOuter, ImVec2(0.0f, ImGui::GetFontSize() * 20.0f)))
+            {
+                ImGui::TableSetupScrollFreeze(0, 1);
+                ImGuiListClipper clipper;
+                clipper.BeginVariableHeight(items_count, &table_heights);
+                while (clipper.Step())
+                    for (int n = clipper.DisplayStart; n < clipper.DisplayEnd; n++)
+                    {
+                        ImGui::TableNextRow();
+                        ImGui::TableNextColumn();
+                        ImGui::Text("%d", n);
+                        ImGui::TableNextColumn();
+                        if (n == 0)
+                            ImGui::TextUnformatted("Frozen row");
+                        else if ((n % 7) == 0)
+                            ImGui::TextWrapped("Item %d: a longer entry which wraps over multiple lines, so this row is taller than most of its neighbors.", n);
+                        else
+                            ImGui::Text("Item %d", n);
+                    }
+                ImGui::EndTable();
+            }
+        }
+        else
+        {
+            if (ImGui::BeginChild("##VariableHeightClipper", ImVec2(0.0f, ImGui::GetFontSize() * 20.0f), true))
+            {
+                ImGuiListClipper clipper;
+                clipper.BeginVariableHeight(items_count, &heights);
+                while (clipper.Step())
+                    for (int n = clipper.DisplayStart; n < clipper.DisplayEnd; n++)
+                    {
+                        if ((n % 7) == 0)
+                            ImGui::TextWrapped("Item %d: a longer entry which wraps over multiple lines, so this row is taller than most of its neighbors.", n);
+                        else if ((n % 5) == 0)
+                            ImGui::Button("Button", ImVec2(0.0f, ImGui::GetFrameHeight() * 2.0f));
+                        else
+                            ImGui::Text("Item %d", n);
+                    }
+            }
+            ImGui::EndChild();
+        }
+        ImGui::TreePop();
+    }
+
     IMGUI_DEMO_MARKER("Layout/Clipping");
     if (ImGui::TreeNode("Clipping"))
     {
@@ -10,6 +10,8 @@ Index of this file:
 // [SECTION] ImDrawList
 // [SECTION] ImDrawListSplitter
 // [SECTION] ImDrawData
+// [SECTION] ImDrawDataMerger
+// [SECTION] ImDrawDataDamage
 // [SECTION] Helpers ShadeVertsXXX functions
 // [SECTION] ImFontConfig
 // [SECTION] ImFontAtlas
@@ -453,6 +455,9 @@ ImDrawList* ImDrawList::CloneOutput() const
     dst->IdxBuffer = IdxBuffer;
     dst->VtxBuffer = VtxBuffer;
     dst->Flags = Flags;
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    dst->VtxOrigin = VtxOrigin;
+#endif
     return dst;
 }
 
@@ -679,10 +684,10 @@ void ImDrawList::PrimRect(const ImVec2& a, const ImVec2& c, ImU32 col)
     ImDrawIdx idx = (ImDrawIdx)_VtxCurrentIdx;
     _IdxWritePtr[0] = idx; _IdxWritePtr[1] = (ImDrawIdx)(idx+1); _IdxWritePtr[2] = (ImDrawIdx)(idx+2);
     _IdxWritePtr[3] = idx; _IdxWritePtr[4] = (ImDrawIdx)(idx+2); _IdxWritePtr[5] = (ImDrawIdx)(idx+3);
-    _VtxWritePtr[0].pos = a; _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;
-    _VtxWritePtr[1].pos = b; _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col;
-    _VtxWritePtr[2].pos = c; _VtxWritePtr[2].uv = uv; _VtxWritePtr[2].col = col;
-    _VtxWritePtr[3].pos = d; _VtxWritePtr[3].uv = uv; _VtxWritePtr[3].col = col;
+    SetVtx(&_VtxWritePtr[0], a, uv, col);
+    SetVtx(&_VtxWritePtr[1], b, uv, col);
+    SetVtx(&_VtxWritePtr[2], c, uv, col);
+    SetVtx(&_VtxWritePtr[3], d, uv, col);
     _VtxWritePtr += 4;
     _VtxCurrentIdx += 4;
     _IdxWritePtr += 6;
@@ -694,10 +699,10 @@ void ImDrawList::PrimRectUV(const ImVec2& a, const ImVec2& c, const ImVec2& uv_a
     ImDrawIdx idx = (ImDrawIdx)_VtxCurrentIdx;
     _IdxWritePtr[0] = idx; _IdxWritePtr[1] = (ImDrawIdx)(idx+1); _IdxWritePtr[2] = (ImDrawIdx)(idx+2);
     _IdxWritePtr[3] = idx; _IdxWritePtr[4] = (ImDrawIdx)(idx+2); _IdxWritePtr[5] = (ImDrawIdx)(idx+3);
-    _VtxWritePtr[0].pos = a; _VtxWritePtr[0].uv = uv_a; _VtxWritePtr[0].col = col;
-    _VtxWritePtr[1].pos = b; _VtxWritePtr[1].uv = uv_b; _VtxWritePtr[1].col = col;
-    _VtxWritePtr[2].pos = c; _VtxWritePtr[2].uv = uv_c; _VtxWritePtr[2].col = col;
-    _VtxWritePtr[3].pos = d; _VtxWritePtr[3].uv = uv_d; _VtxWritePtr[3].col = col;
+    SetVtx(&_VtxWritePtr[0], a, uv_a, col);
+    SetVtx(&_VtxWritePtr[1], b, uv_b, col);
+    SetVtx(&_VtxWritePtr[2], c, uv_c, col);
+    SetVtx(&_VtxWritePtr[3], d, uv_d, col);
     _VtxWritePtr += 4;
     _VtxCurrentIdx += 4;
     _IdxWritePtr += 6;
@@ -708,10 +713,10 @@ void ImDrawList::PrimQuadUV(const ImVec2& a, const ImVec2& b, const ImVec2& c, c
     ImDrawIdx idx = (ImDrawIdx)_VtxCurrentIdx;
     _IdxWritePtr[0] = idx; _IdxWritePtr[1] = (ImDrawIdx)(idx+1); _IdxWritePtr[2] = (ImDrawIdx)(idx+2);
     _IdxWritePtr[3] = idx; _IdxWritePtr[4] = (ImDrawIdx)(idx+2); _IdxWritePtr[5] = (ImDrawIdx)(idx+3);
-    _VtxWritePtr[0].pos = a; _VtxWritePtr[0].uv = uv_a; _VtxWritePtr[0].col = col;
-    _VtxWritePtr[1].pos = b; _VtxWritePtr[1].uv = uv_b; _VtxWritePtr[1].col = col;
-    _VtxWritePtr[2].pos = c; _VtxWritePtr[2].uv = uv_c; _VtxWritePtr[2].col = col;
-    _VtxWritePtr[3].pos = d; _VtxWritePtr[3].uv = uv_d; _VtxWritePtr[3].col = col;
+    SetVtx(&_VtxWritePtr[0], a, uv_a, col);
+    SetVtx(&_VtxWritePtr[1], b, uv_b, col);
+    SetVtx(&_VtxWritePtr[2], c, uv_c, col);
+    SetVtx(&_VtxWritePtr[3], d, uv_d, col);
     _VtxWritePtr += 4;
     _VtxCurrentIdx += 4;
     _IdxWritePtr += 6;
@@ -726,11 +731,56 @@ void ImDrawList::PrimQuadUV(const ImVec2& a, const ImVec2& b, const ImVec2& c, c
 
 // TODO: Thickness anti-aliased lines cap are missing their AA fringe.
 // We avoid using the ImVec2 math operators here to reduce cost to a minimum for debug/non-inlined builds.
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+// Compact vertices clamp positions to the encodable range per component, which would bend slanted segments running out of it.
+// Draw a polyline leaving the range as the runs of it clipped to the range instead (rotating closed ones to start outside,
+// so every run starts and ends on the range border).
+static void AddPolylineClipped(ImDrawList* draw_list, const ImVec2* points, const int points_count, ImU32 col, ImDrawFlags flags, float thickness, const ImVec2& r_min, const ImVec2& r_max, int first_outside)
+{
+    const bool closed = (flags & ImDrawFlags_Closed) != 0;
+    const int count = closed ? points_count : points_count - 1;
+    const int start = closed ? first_outside : 0;
+    flags &= ~ImDrawFlags_Closed;
+    ImVector<ImVec2> run;
+    for (int n = 0; n < count; n++)
+    {
+        const int i1 = (start + n) % points_count;
+        const int i2 = (i1 + 1) % points_count;
+        ImVec2 a = points[i1], b = points[i2];
+        const bool visible = ImLineClipToRect(a, b, r_min, r_max);
+        const bool entered = visible && (a.x != points[i1].x || a.y != points[i1].y);
+        if ((!visible || entered) && run.Size > 0)
+        {
+            if (run.Size >= 2)
+                draw_list->AddPolyline(run.Data, run.Size, col, flags, thickness);
+            run.resize(0);
+        }
+        if (!visible)
+            continue;
+        if (run.Size == 0)
+            run.push_back(a);
+        run.push_back(b);
+    }
+    if (run.Size >= 2)
+        draw_list->AddPolyline(run.Data, run.Size, col, flags, thickness);
+}
+#endif
+
 void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32 col, ImDrawFlags flags, float thickness)
 {
     if (points_count < 2)
         return;
 
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    {
+        const float range = IMGUI_COMPACT_DRAWVERT_POS_MAX - (thickness * 0.5f + _FringeScale + 1.0f);
+        const ImVec2 r_min(VtxOrigin.x - range, VtxOrigin.y - range), r_max(VtxOrigin.x + range, VtxOrigin.y + range);
+        for (int i = 0; i < points_count; i++)
+            if (!(points[i].x >= r_min.x && points[i].y >= r_min.y && points[i].x <= r_max.x && points[i].y <= r_max.y))
+                return AddPolylineClipped(this, points, points_count, col, flags, thickness, r_min, r_max, i);
+    }
+#endif
+
     const bool closed = (flags & ImDrawFlags_Closed) != 0;
     const ImVec2 opaque_uv = _Data->TexUvWhitePixel;
     const int count = closed ? points_count : points_count - 1; // The number of line segments we need to draw
@@ -859,8 +909,8 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 ImVec2 tex_uv1(tex_uvs.z, tex_uvs.w);
                 for (int i = 0; i < points_count; i++)
                 {
-                    _VtxWritePtr[0].pos = temp_points[i * 2 + 0]; _VtxWritePtr[0].uv = tex_uv0; _VtxWritePtr[0].col = col; // Left-side outer edge
-                    _VtxWritePtr[1].pos = temp_points[i * 2 + 1]; _VtxWritePtr[1].uv = tex_uv1; _VtxWritePtr[1].col = col; // Right-side outer edge
+                    SetVtx(&_VtxWritePtr[0], temp_points[i * 2 + 0], tex_uv0, col); // Left-side outer edge
+                    SetVtx(&_VtxWritePtr[1], temp_points[i * 2 + 1], tex_uv1, col); // Right-side outer edge
                     _VtxWritePtr += 2;
                 }
             }
@@ -869,9 +919,9 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 // If we're not using a texture, we need the center vertex as well
                 for (int i = 0; i < points_count; i++)
                 {
-                    _VtxWritePtr[0].pos = points[i];              _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col;       // Center of line
-                    _VtxWritePtr[1].pos = temp_points[i * 2 + 0]; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col_trans; // Left-side outer edge
-                    _VtxWritePtr[2].pos = temp_points[i * 2 + 1]; _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col_trans; // Right-side outer edge
+                    SetVtx(&_VtxWritePtr[0], points[i], opaque_uv, col);                    // Center of line
+                    SetVtx(&_VtxWritePtr[1], temp_points[i * 2 + 0], opaque_uv, col_trans); // Left-side outer edge
+                    SetVtx(&_VtxWritePtr[2], temp_points[i * 2 + 1], opaque_uv, col_trans); // Right-side outer edge
                     _VtxWritePtr += 3;
                 }
             }
@@ -939,10 +989,10 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
             // Add vertices
             for (int i = 0; i < points_count; i++)
             {
-                _VtxWritePtr[0].pos = temp_points[i * 4 + 0]; _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col_trans;
-                _VtxWritePtr[1].pos = temp_points[i * 4 + 1]; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col;
-                _VtxWritePtr[2].pos = temp_points[i * 4 + 2]; _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col;
-                _VtxWritePtr[3].pos = temp_points[i * 4 + 3]; _VtxWritePtr[3].uv = opaque_uv; _VtxWritePtr[3].col = col_trans;
+                SetVtx(&_VtxWritePtr[0], temp_points[i * 4 + 0], opaque_uv, col_trans);
+                SetVtx(&_VtxWritePtr[1], temp_points[i * 4 + 1], opaque_uv, col);
+                SetVtx(&_VtxWritePtr[2], temp_points[i * 4 + 2], opaque_uv, col);
+                SetVtx(&_VtxWritePtr[3], temp_points[i * 4 + 3], opaque_uv, col_trans);
                 _VtxWritePtr += 4;
             }
         }
@@ -967,10 +1017,10 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
             dx *= (thickness * 0.5f);
             dy *= (thickness * 0.5f);
 
-            _VtxWritePtr[0].pos.x = p1.x + dy; _VtxWritePtr[0].pos.y = p1.y - dx; _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col;
-            _VtxWritePtr[1].pos.x = p2.x + dy; _VtxWritePtr[1].pos.y = p2.y - dx; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col;
-            _VtxWritePtr[2].pos.x = p2.x - dy; _VtxWritePtr[2].pos.y = p2.y + dx; _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col;
-            _VtxWritePtr[3].pos.x = p1.x - dy; _VtxWritePtr[3].pos.y = p1.y + dx; _VtxWritePtr[3].uv = opaque_uv; _VtxWritePtr[3].col = col;
+            SetVtx(&_VtxWritePtr[0], ImVec2(p1.x + dy, p1.y - dx), opaque_uv, col);
+            SetVtx(&_VtxWritePtr[1], ImVec2(p2.x + dy, p2.y - dx), opaque_uv, col);
+            SetVtx(&_VtxWritePtr[2], ImVec2(p2.x - dy, p2.y + dx), opaque_uv, col);
+            SetVtx(&_VtxWritePtr[3], ImVec2(p1.x - dy, p1.y + dx), opaque_uv, col);
             _VtxWritePtr += 4;
 
             _IdxWritePtr[0] = (ImDrawIdx)(_VtxCurrentIdx); _IdxWritePtr[1] = (ImDrawIdx)(_VtxCurrentIdx + 1); _IdxWritePtr[2] = (ImDrawIdx)(_VtxCurrentIdx + 2);
@@ -1032,8 +1082,8 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
             dm_y *= AA_SIZE * 0.5f;
 
             // Add vertices
-            _VtxWritePtr[0].pos.x = (points[i1].x - dm_x); _VtxWritePtr[0].pos.y = (points[i1].y - dm_y); _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;        // Inner
-            _VtxWritePtr[1].pos.x = (points[i1].x + dm_x); _VtxWritePtr[1].pos.y = (points[i1].y + dm_y); _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col_trans;  // Outer
+            SetVtx(&_VtxWritePtr[0], ImVec2(points[i1].x - dm_x, points[i1].y - dm_y), uv, col);        // Inner
+            SetVtx(&_VtxWritePtr[1], ImVec2(points[i1].x + dm_x, points[i1].y + dm_y), uv, col_trans);  // Outer
             _VtxWritePtr += 2;
 
             // Add indexes for fringes
@@ -1051,7 +1101,7 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
         PrimReserve(idx_count, vtx_count);
         for (int i = 0; i < vtx_count; i++)
         {
-            _VtxWritePtr[0].pos = points[i]; _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;
+            SetVtx(&_VtxWritePtr[0], points[i], uv, col);
             _VtxWritePtr++;
         }
         for (int i = 2; i < points_count; i++)
@@ -1856,6 +1906,447 @@ void ImDrawData::ScaleClipRects(const ImVec2& fb_scale)
     }
 }
 
+//-----------------------------------------------------------------------------
+// [SECTION] ImDrawDataMerger
+//-----------------------------------------------------------------------------
+
+static inline bool ImDrawDataMerger_Contains(const ImVec4& outer, const ImVec4& inner)
+{
+    return inner.x >= outer.x && inner.y >= outer.y && inner.z <= outer.z && inner.w <= outer.w;
+}
+
+static inline ImVec4 ImDrawDataMerger_Union(const ImVec4& a, const ImVec4& b)
+{
+    return ImVec4(ImMin(a.x, b.x), ImMin(a.y, b.y), ImMax(a.z, b.z), ImMax(a.w, b.w));
+}
+
+void ImDrawDataMerger::ClearFreeMemory()
+{
+    for (int n = 0; n < DrawLists.Size; n++)
+        IM_DELETE(DrawLists[n]);
+    DrawLists.clear();
+    DrawData.Clear();
+}
+
+// Source commands are walked in 'segments' of equal VtxOffset, each at most 64K vertices when ImDrawIdx is 16-bit. A segment is copied whole
+// into the current output list (or a new one when it doesn't fit), its indices rebased so the output never needs VtxOffset.
+// Merging a command into the previous output command keeps the output identical when, for the resulting clip rectangle C:
+// - members with all vertices inside their own clip rectangle ('unclipped') have all vertices inside C,
+// - members actually clipped have C equal to their own clip rectangle.
+// A run with no clipped member uses the union of its members clip rectangles, a run with a clipped member uses its clip rectangle.
+ImDrawData* ImDrawDataMerger::Merge(const ImDrawData* src)
+{
+    const int max_vtx_per_list = (sizeof(ImDrawIdx) == 2) ? (1 << 16) : INT_MAX;
+    CmdCountIn = CmdCountOut = 0;
+
+    int out_lists_count = 0;
+    ImDrawList* out_list = NULL;
+    bool run_open = false;      // Last output command can be extended
+    bool run_clipped = false;   // Run clip rectangle is required by a clipped member
+    ImVec4 run_clip;            // Clip rectangle of the last output command
+    ImVec4 run_bounds;          // Vertex bounds of the run
+
+    for (int n = 0; n < src->CmdListsCount; n++)
+    {
+        const ImDrawList* src_list = src->CmdLists[n];
+        for (int cmd_i = 0; cmd_i < src_list->CmdBuffer.Size; )
+        {
+            // Segment: consecutive commands sharing a VtxOffset, vertices up to the next VtxOffset
+            const unsigned int seg_vtx_offset = src_list->CmdBuffer[cmd_i].VtxOffset;
+            int seg_cmd_end = cmd_i + 1;
+            while (seg_cmd_end < src_list->CmdBuffer.Size && src_list->CmdBuffer[seg_cmd_end].VtxOffset == seg_vtx_offset)
+                seg_cmd_end++;
+            const int seg_vtx_end = (seg_cmd_end < src_list->CmdBuffer.Size) ? (int)src_list->CmdBuffer[seg_cmd_end].VtxOffset : src_list->VtxBuffer.Size;
+            const int seg_vtx_count = seg_vtx_end - (int)seg_vtx_offset;
+            IM_ASSERT(seg_vtx_count >= 0 && seg_vtx_count <= max_vtx_per_list);
+
+            bool new_list = (out_list == NULL || out_list->VtxBuffer.Size + seg_vtx_count > max_vtx_per_list);
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+            new_list |= (out_list != NULL && (out_list->VtxOrigin.x != src_list->VtxOrigin.x || out_list->VtxOrigin.y != src_list->VtxOrigin.y)); // Vertices are copied as is
+#endif
+            if (new_list)
+            {
+                if (out_lists_count == DrawLists.Size)
+                    DrawLists.push_back(IM_NEW(ImDrawList)(ImGui::GetDrawListSharedData()));
+                out_list = DrawLists[out_lists_count++];
+                out_list->CmdBuffer.resize(0);
+                out_list->IdxBuffer.resize(0);
+                out_list->VtxBuffer.resize(0);
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+                out_list->VtxOrigin = src_list->VtxOrigin;
+#endif
+                run_open = false;
+            }
+
+            const int vtx_base = out_list->VtxBuffer.Size;
+            out_list->VtxBuffer.resize(vtx_base + seg_vtx_count);
+            if (seg_vtx_count > 0)
+                memcpy(out_list->VtxBuffer.Data + vtx_base, src_list->VtxBuffer.Data + seg_vtx_offset, (size_t)seg_vtx_count * sizeof(ImDrawVert));
+            const ImDrawVert* out_vtx = out_list->VtxBuffer.Data;
+
+            for (; cmd_i < seg_cmd_end; cmd_i++)
+            {
+                const ImDrawCmd* src_cmd = &src_list->CmdBuffer[cmd_i];
+                if (src_cmd->UserCallback != NULL)
+                {
+                    ImDrawCmd callback_cmd = *src_cmd;
+                    callback_cmd.VtxOffset = 0;
+                    callback_cmd.IdxOffset = (unsigned int)out_list->IdxBuffer.Size;
+                    callback_cmd.ElemCount = 0;
+                    out_list->CmdBuffer.push_back(callback_cmd);
+                    CmdCountIn++;
+                    CmdCountOut++;
+                    run_open = false;
+                    continue;
+                }
+                if (src_cmd->ElemCount == 0)
+                    continue;
+                CmdCountIn++;
+
+                // Rebased indices, and bounds of the vertices they use
+                const int idx_base = out_list->IdxBuffer.Size;
+                out_list->IdxBuffer.resize(idx_base + (int)src_cmd->ElemCount);
+                const ImDrawIdx* src_idx = src_list->IdxBuffer.Data + src_cmd->IdxOffset;
+                ImDrawIdx* dst_idx = out_list->IdxBuffer.Data + idx_base;
+                ImVec4 bounds(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+                for (unsigned int i = 0; i < src_cmd->ElemCount; i++)
+                {
+                    const int idx = (int)src_idx[i] + vtx_base;
+                    dst_idx[i] = (ImDrawIdx)idx;
+                    const ImVec2 pos = out_list->GetVtxPos(out_vtx[idx]);
+                    bounds.x = ImMin(bounds.x, pos.x);
+                    bounds.y = ImMin(bounds.y, pos.y);
+                    bounds.z = ImMax(bounds.z, pos.x);
+                    bounds.w = ImMax(bounds.w, pos.y);
+                }
+
+                const bool clipped = !ImDrawDataMerger_Contains(src_cmd->ClipRect, bounds);
+                ImDrawCmd* last_cmd = run_open ? &out_list->CmdBuffer.back() : NULL;
+                bool merge = false;
+                if (last_cmd != NULL && last_cmd->TextureId == src_cmd->TextureId)
+                {
+                    if (!clipped && !run_clipped)
+                    {
+                        merge = true;
+                        run_clip = ImDrawDataMerger_Union(run_clip, src_cmd->ClipRect);
+                    }
+                    else if (!clipped && run_clipped)
+                    {
+                        merge = ImDrawDataMerger_Contains(run_clip, bounds);
+                    }
+                    else if (clipped && !run_clipped)
+                    {
+                        merge = ImDrawDataMerger_Contains(src_cmd->ClipRect, run_bounds);
+                        if (merge)
+                        {
+                            run_clipped = true;
+                            run_clip = src_cmd->ClipRect;
+                        }
+                    }
+                    else
+                    {
+                        merge = memcmp(&run_clip, &src_cmd->ClipRect, sizeof(ImVec4)) == 0;
+                    }
+                }
+
+                if (merge)
+                {
+                    last_cmd->ClipRect = run_clip;
+                    last_cmd->ElemCount += src_cmd->ElemCount;
+                    run_bounds = ImDrawDataMerger_Union(run_bounds, bounds);
+                    continue;
+                }
+
+                ImDrawCmd out_cmd = *src_cmd;
+                out_cmd.VtxOffset = 0;
+                out_cmd.IdxOffset = (unsigned int)idx_base;
+                out_list->CmdBuffer.push_back(out_cmd);
+                CmdCountOut++;
+                run_open = true;
+                run_clipped = clipped;
+                run_clip = src_cmd->ClipRect;
+                run_bounds = bounds;
+            }
+        }
+    }
+
+    DrawData.Clear();
+    DrawData.Valid = src->Valid;
+    DrawData.CmdLists = DrawLists.Data;
+    DrawData.CmdListsCount = out_lists_count;
+    DrawData.DisplayPos = src->DisplayPos;
+    DrawData.DisplaySize = src->DisplaySize;
+    DrawData.FramebufferScale = src->FramebufferScale;
+    DrawData.OwnerViewport = src->OwnerViewport;
+    DrawData.HasDamageRects = src->HasDamageRects;
+    DrawData.DamageRectsCount = src->DamageRectsCount;
+    DrawData.DamageRects = src->DamageRects;
+    for (int n = 0; n < out_lists_count; n++)
+    {
+        DrawData.TotalVtxCount += DrawLists[n]->VtxBuffer.Size;
+        DrawData.TotalIdxCount += DrawLists[n]->IdxBuffer.Size;
+    }
+
+    // Draw call counts for Metrics, summed over the viewports merged this frame
+    ImGuiContext& g = *GImGui;
+    if (g.DebugDrawMergeFrame != g.FrameCount)
+    {
+        g.DebugDrawMergeFrame = g.FrameCount;
+        g.DebugDrawMergeCmdCountIn = g.DebugDrawMergeCmdCountOut = 0;
+    }
+    g.DebugDrawMergeCmdCountIn += CmdCountIn;
+    g.DebugDrawMergeCmdCountOut += CmdCountOut;
+    return &DrawData;
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] ImDrawDataDamage
+//-----------------------------------------------------------------------------
+
+static inline bool ImDrawDataDamage_Overlaps(const ImVec4& a, const ImVec4& b)
+{
+    return a.x <= b.z && b.x <= a.z && a.y <= b.w && b.y <= a.w;
+}
+
+// Hash 0 is reserved for user callbacks, which we can't see through and always consider damaged
+static inline bool ImDrawDataDamage_CmdEquals(const ImDrawDataDamageCmd& a, const ImDrawDataDamageCmd& b)
+{
+    return a.Hash != 0 && a.Hash == b.Hash && memcmp(&a.Bounds, &b.Bounds, sizeof(ImVec4)) == 0;
+}
+
+// Rounded outward to whole pixels and clipped to the display. Overlapping rectangles are merged as we go, and past 64 rectangles
+// everything collapses into their bounding box: both only ever grow the damaged area.
+static void ImDrawDataDamage_AddRect(ImVector<ImVec4>& rects, const ImVec4& display_rect, const ImVec4& r_in)
+{
+    ImVec4 r(ImMax(ImFloorSigned(r_in.x), display_rect.x), ImMax(ImFloorSigned(r_in.y), display_rect.y),
+             ImMin(-ImFloorSigned(-r_in.z), display_rect.z), ImMin(-ImFloorSigned(-r_in.w), display_rect.w));
+    if (r.z <= r.x || r.w <= r.y)
+        return;
+    for (int n = 0; n < rects.Size; n++)
+        if (ImDrawDataDamage_Overlaps(rects[n], r))
+        {
+            rects[n] = ImDrawDataMerger_Union(rects[n], r);
+            return;
+        }
+    if (rects.Size == 64)
+    {
+        for (int n = 1; n < rects.Size; n++)
+            rects[0] = ImDrawDataMerger_Union(rects[0], rects[n]);
+        rects.resize(1);
+        rects[0] = ImDrawDataMerger_Union(rects[0], r);
+        return;
+    }
+    rects.push_back(r);
+}
+
+static void ImDrawDataDamage_AddCmds(ImVector<ImVec4>& rects, const ImVec4& display_rect, const ImDrawDataDamageCmd* cmds, int count)
+{
+    for (int n = 0; n < count; n++)
+        ImDrawDataDamage_AddRect(rects, display_rect, cmds[n].Bounds);
+}
+
+// One record per command which may output pixels
+static void ImDrawDataDamage_HashDrawList(ImVector<ImDrawDataDamageCmd>& out, const ImDrawList* draw_list)
+{
+    for (int cmd_i = 0; cmd_i < draw_list->CmdBuffer.Size; cmd_i++)
+    {
+        const ImDrawCmd* pcmd = &draw_list->CmdBuffer[cmd_i];
+        ImDrawDataDamageCmd rec;
+        if (pcmd->UserCallback != NULL)
+        {
+            if (pcmd->UserCallback == ImDrawCallback_ResetRenderState)
+                continue;
+            rec.Hash = 0;
+            rec.Bounds = pcmd->ClipRect;
+            out.push_back(rec);
+            continue;
+        }
+        if (pcmd->ElemCount == 0)
+            continue;
+
+        // Indices are hashed relative to the first one, so geometry moving around in the vertex buffer doesn't count as a change
+        const ImDrawIdx* idx = draw_list->IdxBuffer.Data + pcmd->IdxOffset;
+        const unsigned int idx_first = idx[0];
+        unsigned int idx_min = idx_first, idx_max = idx_first;
+        ImU64 hash = pcmd->ElemCount;
+        for (unsigned int i = 0; i < pcmd->ElemCount; i++)
+        {
+            const unsigned int v = idx[i];
+            idx_min = ImMin(idx_min, v);
+            idx_max = ImMax(idx_max, v);
+            hash = (hash ^ (ImU64)(v - idx_first)) * 0x9E3779B97F4A7C15ULL;
+        }
+
+        // Vertices are emitted in the same order as indices, the range between the smallest and largest index is the command's own
+        const ImDrawVert* vtx = draw_list->VtxBuffer.Data + pcmd->VtxOffset + idx_min;
+        const int vtx_count = (int)(idx_max - idx_min) + 1;
+        ImVec4 bounds(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+        for (int i = 0; i < vtx_count; i++)
+        {
+            const ImVec2 pos = draw_list->GetVtxPos(vtx[i]);
+            bounds.x = ImMin(bounds.x, pos.x);
+            bounds.y = ImMin(bounds.y, pos.y);
+            bounds.z = ImMax(bounds.z, pos.x);
+            bounds.w = ImMax(bounds.w, pos.y);
+        }
+        rec.Bounds = ImVec4(ImMax(bounds.x, pcmd->ClipRect.x), ImMax(bounds.y, pcmd->ClipRect.y), ImMin(bounds.z, pcmd->ClipRect.z), ImMin(bounds.w, pcmd->ClipRect.w));
+        if (rec.Bounds.z <= rec.Bounds.x || rec.Bounds.w <= rec.Bounds.y)
+            continue;
+
+        hash = ImHashData64(vtx, (size_t)vtx_count * sizeof(ImDrawVert), hash);
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+        hash = ImHashData64(&draw_list->VtxOrigin, sizeof(draw_list->VtxOrigin), hash);
+#endif
+        hash = ImHashData64(&pcmd->ClipRect, sizeof(pcmd->ClipRect), hash);
+        hash = ImHashData64(&pcmd->TextureId, sizeof(pcmd->TextureId), hash);
+        rec.Hash = (hash != 0) ? hash : 1;
+        out.push_back(rec);
+    }
+}
+
+// Matching keeps the order of draw lists and of commands within them, so a pixel outside of every damaged area is covered by
+// the same sequence of identical commands on both frames, and renders the same. Texture contents are not compared: a texture
+// updated in place (e.g. a font atlas rebuild) needs the application to redraw everything.
+void ImDrawDataDamage::Update(ImDrawData* draw_data)
+{
+    draw_data->HasDamageRects = false;
+    draw_data->DamageRectsCount = 0;
+    draw_data->DamageRects = NULL;
+    if (draw_data->DisplaySize.x <= 0.0f || draw_data->DisplaySize.y <= 0.0f)
+    {
+        HasPrevFrame = false;
+        return;
+    }
+
+    // Hash current frame
+    ImVector<ImDrawDataDamageCmd>& curr_cmds = Cmds[1];
+    ImVector<ImDrawDataDamageList>& curr_lists = Lists[1];
+    curr_cmds.resize(0);
+    curr_lists.resize(0);
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    {
+        ImDrawDataDamageList list;
+        list.DrawList = draw_data->CmdLists[n];
+        list.CmdStart = curr_cmds.Size;
+        ImDrawDataDamage_HashDrawList(curr_cmds, list.DrawList);
+        list.CmdCount = curr_cmds.Size - list.CmdStart;
+        curr_lists.push_back(list);
+    }
+
+    const ImVec4 display_rect(draw_data->DisplayPos.x, draw_data->DisplayPos.y, draw_data->DisplayPos.x + draw_data->DisplaySize.x, draw_data->DisplayPos.y + draw_data->DisplaySize.y);
+    const ImVector<ImDrawDataDamageCmd>& prev_cmds = Cmds[0];
+    const ImVector<ImDrawDataDamageList>& prev_lists = Lists[0];
+    const int prev_count = prev_lists.Size;
+    const int curr_count = curr_lists.Size;
+    Rects.resize(0);
+
+    bool full_damage = !HasPrevFrame;
+    full_damage |= (DisplayPos.x != draw_data->DisplayPos.x || DisplayPos.y != draw_data->DisplayPos.y || DisplaySize.x != draw_data->DisplaySize.x || DisplaySize.y != draw_data->DisplaySize.y);
+    full_damage |= (FramebufferScale.x != draw_data->FramebufferScale.x || FramebufferScale.y != draw_data->FramebufferScale.y);
+    full_damage |= ((prev_count + 1) * (curr_count + 1) > 65536); // Keep the matching table small
+    if (full_damage)
+    {
+        Rects.push_back(display_rect);
+    }
+    else
+    {
+        // Longest common subsequence of draw lists (LcsTable[i,j] = length for prev_lists[i..] and curr_lists[j..])
+        const int stride = curr_count + 1;
+        LcsTable.resize((prev_count + 1) * stride);
+        for (int i = prev_count; i >= 0; i--)
+            for (int j = curr_count; j >= 0; j--)
+            {
+                short len = 0;
+                if (i < prev_count && j < curr_count)
+                    len = (prev_lists[i].DrawList == curr_lists[j].DrawList) ? LcsTable[(i + 1) * stride + j + 1] + 1 : ImMax(LcsTable[(i + 1) * stride + j], LcsTable[i * stride + j + 1]);
+                LcsTable[i * stride + j] = len;
+            }
+
+        int i = 0, j = 0;
+        while (i < prev_count || j < curr_count)
+        {
+            if (i < prev_count && j < curr_count && prev_lists[i].DrawList == curr_lists[j].DrawList)
+            {
+                // Same draw list on both frames: match commands by common prefix and suffix
+                const ImDrawDataDamageCmd* a = prev_cmds.Data + prev_lists[i].CmdStart;
+                const ImDrawDataDamageCmd* b = curr_cmds.Data + curr_lists[j].CmdStart;
+                int a_end = prev_lists[i].CmdCount;
+                int b_end = curr_lists[j].CmdCount;
+                int start = 0;
+                while (start < a_end && start < b_end && ImDrawDataDamage_CmdEquals(a[start], b[start]))
+                    start++;
+                while (a_end > start && b_end > start && ImDrawDataDamage_CmdEquals(a[a_end - 1], b[b_end - 1]))
+                    a_end--, b_end--;
+                ImDrawDataDamage_AddCmds(Rects, display_rect, a + start, a_end - start);
+                ImDrawDataDamage_AddCmds(Rects, display_rect, b + start, b_end - start);
+                i++;
+                j++;
+            }
+            else if (j == curr_count || (i < prev_count && LcsTable[(i + 1) * stride + j] >= LcsTable[i * stride + j + 1]))
+            {
+                // Draw list gone or moved in z-order
+                ImDrawDataDamage_AddCmds(Rects, display_rect, prev_cmds.Data + prev_lists[i].CmdStart, prev_lists[i].CmdCount);
+                i++;
+            }
+            else
+            {
+                // Draw list new or moved in z-order
+                ImDrawDataDamage_AddCmds(Rects, display_rect, curr_cmds.Data + curr_lists[j].CmdStart, curr_lists[j].CmdCount);
+                j++;
+            }
+        }
+
+        // Output rectangles never overlap, so a renderer may process them one at a time. Merging grows rectangles into others:
+        // merge overlapping ones until there are none left, then the pair adding the least area while there are too many.
+        const int max_rects = 8;
+        for (;;)
+        {
+            for (bool merged = true; merged; )
+            {
+                merged = false;
+                for (int a = 0; a < Rects.Size; a++)
+                    for (int b = a + 1; b < Rects.Size; b++)
+                        if (ImDrawDataDamage_Overlaps(Rects[a], Rects[b]))
+                        {
+                            Rects[a] = ImDrawDataMerger_Union(Rects[a], Rects[b]);
+                            Rects.erase(Rects.Data + b);
+                            merged = true;
+                            b--;
+                        }
+            }
+            if (Rects.Size <= max_rects)
+                break;
+            int best_a = 0, best_b = 1;
+            float best_cost = FLT_MAX;
+            for (int a = 0; a < Rects.Size; a++)
+                for (int b = a + 1; b < Rects.Size; b++)
+                {
+                    const ImVec4 u = ImDrawDataMerger_Union(Rects[a], Rects[b]);
+                    const float cost = (u.z - u.x) * (u.w - u.y) - (Rects[a].z - Rects[a].x) * (Rects[a].w - Rects[a].y) - (Rects[b].z - Rects[b].x) * (Rects[b].w - Rects[b].y);
+                    if (cost < best_cost)
+                    {
+                        best_cost = cost;
+                        best_a = a;
+                        best_b = b;
+                    }
+                }
+            Rects[best_a] = ImDrawDataMerger_Union(Rects[best_a], Rects[best_b]);
+            Rects.erase(Rects.Data + best_b);
+        }
+    }
+
+    Cmds[0].swap(Cmds[1]);
+    Lists[0].swap(Lists[1]);
+    DisplayPos = draw_data->DisplayPos;
+    DisplaySize = draw_data->DisplaySize;
+    FramebufferScale = draw_data->FramebufferScale;
+    HasPrevFrame = true;
+
+    draw_data->HasDamageRects = true;
+    draw_data->DamageRectsCount = Rects.Size;
+    draw_data->DamageRects = Rects.Data;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] Helpers ShadeVertsXXX functions
 //-----------------------------------------------------------------------------
@@ -1875,7 +2366,7 @@ void ImGui::ShadeVertsLinearColorGradientKeepAlpha(ImDrawList* draw_list, int ve
     const int col_delta_b = ((int)(col1 >> IM_COL32_B_SHIFT) & 0xFF) - col0_b;
     for (ImDrawVert* vert = vert_start; vert < vert_end; vert++)
     {
-        float d = ImDot(vert->pos - gradient_p0, gradient_extent);
+        float d = ImDot(draw_list->GetVtxPos(*vert) - gradient_p0, gradient_extent);
         float t = ImClamp(d * gradient_inv_length2, 0.0f, 1.0f);
         int r = (int)(col0_r + col_delta_r * t);
         int g = (int)(col0_g + col_delta_g * t);
@@ -1900,12 +2391,12 @@ void ImGui::ShadeVertsLinearUV(ImDrawList* draw_list, int vert_start_idx, int ve
         const ImVec2 min = ImMin(uv_a, uv_b);
         const ImVec2 max = ImMax(uv_a, uv_b);
         for (ImDrawVert* vertex = vert_start; vertex < vert_end; ++vertex)
-            vertex->uv = ImClamp(uv_a + ImMul(ImVec2(vertex->pos.x, vertex->pos.y) - a, scale), min, max);
+            draw_list->SetVtxUV(vertex, ImClamp(uv_a + ImMul(draw_list->GetVtxPos(*vertex) - a, scale), min, max));
     }
     else
     {
         for (ImDrawVert* vertex = vert_start; vertex < vert_end; ++vertex)
-            vertex->uv = uv_a + ImMul(ImVec2(vertex->pos.x, vertex->pos.y) - a, scale);
+            draw_list->SetVtxUV(vertex, uv_a + ImMul(draw_list->GetVtxPos(*vertex) - a, scale));
     }
 }
 
@@ -2289,7 +2780,10 @@ bool    ImFontAtlas::Build()
     }
 
     // Build
-    return builder_io->FontBuilder_Build(this);
+    const ImGuiMemTag backup_mem_tag = ImGui::SetMemTag(ImGuiMemTag_Font);
+    bool ret = builder_io->FontBuilder_Build(this);
+    ImGui::SetMemTag(backup_mem_tag);
+    return ret;
 }
 
 void    ImFontAtlasBuildMultiplyCalcLookupTable(unsigned char out_table[256], float in_brighten_factor)
@@ -2812,6 +3306,314 @@ void ImFontAtlasBuildFinish(ImFontAtlas* atlas)
     atlas->TexReady = true;
 }
 
+//-----------------------------------------------------------------------------
+// Baked atlas cache
+//-----------------------------------------------------------------------------
+// File layout (native endianness, the cache is meant to be reused on the same machine/build):
+//   ImFontAtlasBakedHeader
+//   CustomRects.Size x { X, Y }
+//   Fonts.Size x { ImFontAtlasBakedFont, Glyphs[], IndexAdvanceX[], IndexLookup[] }
+//   TexWidth * TexHeight * BytesPerPixel texture pixels
+//-----------------------------------------------------------------------------
+
+#define IM_FONT_ATLAS_BAKED_MAGIC       0x41464D49  // "IMFA"
+#define IM_FONT_ATLAS_BAKED_VERSION     1
+
+struct ImFontAtlasBakedHeader
+{
+    ImU32       Magic;
+    ImU32       Version;
+    ImU32       ImGuiVersion;
+    ImU32       BuildHash;
+    ImU16       SizeofWchar, SizeofGlyph;
+    int         TexWidth, TexHeight;
+    int         TexBytesPerPixel;
+    int         FontsCount;
+    int         CustomRectsCount;
+    int         PackIdMouseCursors, PackIdLines;
+    ImVec2      TexUvWhitePixel;
+    ImVec4      TexUvLines[IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1];
+};
+
+struct ImFontAtlasBakedFont
+{
+    float       FontSize;
+    float       Ascent, Descent;
+    float       FallbackAdvanceX;
+    int         FallbackGlyphIndex;
+    int         MetricsTotalSurface;
+    ImWchar     FallbackChar, EllipsisChar, DotChar;
+    int         GlyphsCount, IndexAdvanceXCount, IndexLookupCount;
+    ImU8        Used4kPagesMap[(IM_UNICODE_CODEPOINT_MAX+1)/4096/8];
+};
+
+static void ImFontAtlasBakedWrite(ImVector<unsigned char>* out, const void* data, size_t size)
+{
+    const int offset = out->Size;
+    out->resize(offset + (int)size);
+    if (size > 0)
+        memcpy(out->Data + offset, data, size);
+}
+
+static bool ImFontAtlasBakedRead(const unsigned char** p, const unsigned char* p_end, void* dst, size_t size)
+{
+    if ((size_t)(p_end - *p) < size)
+        return false;
+    memcpy(dst, *p, size);
+    *p += size;
+    return true;
+}
+
+template<typename T>
+static inline ImU32 ImFontAtlasHashValue(const T& v, ImU32 seed) { return ImHashData(&v, sizeof(T), seed); }
+
+ImU32 ImFontAtlas::CalcBuildHash() const
+{
+    ImU32 hash = ImFontAtlasHashValue((int)IMGUI_VERSION_NUM, 0);
+    hash = ImFontAtlasHashValue((int)sizeof(ImWchar), hash);
+#ifdef IMGUI_ENABLE_FREETYPE
+    hash = ImFontAtlasHashValue(1, hash);
+#endif
+    hash = ImFontAtlasHashValue(Flags, hash);
+    hash = ImFontAtlasHashValue(TexDesiredWidth, hash);
+    hash = ImFontAtlasHashValue(TexGlyphPadding, hash);
+    hash = ImFontAtlasHashValue(FontBuilderFlags, hash);
+    for (int i = 0; i < ConfigData.Size; i++)
+    {
+        // Hash fields individually as ImFontConfig has padding, pointers and debug name.
+        const ImFontConfig& cfg = ConfigData[i];
+        hash = ImHashData(cfg.FontData, (size_t)cfg.FontDataSize, hash);
+        hash = ImFontAtlasHashValue(cfg.FontNo, hash);
+        hash = ImFontAtlasHashValue(cfg.SizePixels, hash);
+        hash = ImFontAtlasHashValue(cfg.OversampleH, hash);
+        hash = ImFontAtlasHashValue(cfg.OversampleV, hash);
+        hash = ImFontAtlasHashValue(cfg.PixelSnapH, hash);
+        hash = ImFontAtlasHashValue(cfg.GlyphExtraSpacing, hash);
+        hash = ImFontAtlasHashValue(cfg.GlyphOffset, hash);
+        hash = ImFontAtlasHashValue(cfg.GlyphMinAdvanceX, hash);
+        hash = ImFontAtlasHashValue(cfg.GlyphMaxAdvanceX, hash);
+        hash = ImFontAtlasHashValue(cfg.MergeMode, hash);
+        hash = ImFontAtlasHashValue(cfg.FontBuilderFlags, hash);
+        hash = ImFontAtlasHashValue(cfg.RasterizerMultiply, hash);
+        hash = ImFontAtlasHashValue(cfg.EllipsisChar, hash);
+        hash = ImFontAtlasHashValue(Fonts.index_from_ptr(Fonts.find(cfg.DstFont)), hash);
+        if (const ImWchar* ranges = cfg.GlyphRanges)
+            for (; ranges[0] && ranges[1]; ranges += 2)
+                hash = ImHashData(ranges, sizeof(ImWchar) * 2, hash);
+    }
+    for (int i = 0; i < CustomRects.Size; i++)
+    {
+        // Default rects registered by ImFontAtlasBuildInit() are covered by Flags
+        if (i == PackIdMouseCursors || i == PackIdLines)
+            continue;
+        const ImFontAtlasCustomRect& r = CustomRects[i];
+        hash = ImFontAtlasHashValue(r.Width, hash);
+        hash = ImFontAtlasHashValue(r.Height, hash);
+        hash = ImFontAtlasHashValue(r.GlyphID, hash);
+        hash = ImFontAtlasHashValue(r.GlyphAdvanceX, hash);
+        hash = ImFontAtlasHashValue(r.GlyphOffset, hash);
+        hash = ImFontAtlasHashValue(r.Font ? Fonts.index_from_ptr(Fonts.find(r.Font)) : -1, hash);
+    }
+    return hash;
+}
+
+bool ImFontAtlas::SaveBakedToMemory(ImVector<unsigned char>* out_data) const
+{
+    IM_ASSERT(out_data != NULL);
+    out_data->resize(0);
+    if (!TexReady || (TexPixelsAlpha8 == NULL && TexPixelsRGBA32 == NULL))
+        return false;
+
+    ImFontAtlasBakedHeader header;
+    memset(&header, 0, sizeof(header));
+    header.Magic = IM_FONT_ATLAS_BAKED_MAGIC;
+    header.Version = IM_FONT_ATLAS_BAKED_VERSION;
+    header.ImGuiVersion = IMGUI_VERSION_NUM;
+    header.BuildHash = CalcBuildHash();
+    header.SizeofWchar = (ImU16)sizeof(ImWchar);
+    header.SizeofGlyph = (ImU16)sizeof(ImFontGlyph);
+    header.TexWidth = TexWidth;
+    header.TexHeight = TexHeight;
+    header.TexBytesPerPixel = TexPixelsAlpha8 ? 1 : 4; // Prefer the smaller format, RGBA32 is derived from it on demand
+    header.FontsCount = Fonts.Size;
+    header.CustomRectsCount = CustomRects.Size;
+    header.PackIdMouseCursors = PackIdMouseCursors;
+    header.PackIdLines = PackIdLines;
+    header.TexUvWhitePixel = TexUvWhitePixel;
+    memcpy(header.TexUvLines, TexUvLines, sizeof(TexUvLines));
+    ImFontAtlasBakedWrite(out_data, &header, sizeof(header));
+
+    for (int i = 0; i < CustomRects.Size; i++)
+    {
+        const unsigned short pos[2] = { CustomRects[i].X, CustomRects[i].Y };
+        ImFontAtlasBakedWrite(out_data, pos, sizeof(pos));
+    }
+
+    for (int i = 0; i < Fonts.Size; i++)
+    {
+        const ImFont* font = Fonts[i];
+        ImFontAtlasBakedFont baked;
+        memset(&baked, 0, sizeof(baked));
+        baked.FontSize = font->FontSize;
+        baked.Ascent = font->Ascent;
+        baked.Descent = font->Descent;
+        baked.FallbackAdvanceX = font->FallbackAdvanceX;
+        baked.FallbackGlyphIndex = font->FallbackGlyph ? (int)(font->FallbackGlyph - font->Glyphs.Data) : -1;
+        baked.MetricsTotalSurface = font->MetricsTotalSurface;
+        baked.FallbackChar = font->FallbackChar;
+        baked.EllipsisChar = font->EllipsisChar;
+        baked.DotChar = font->DotChar;
+        baked.GlyphsCount = font->Glyphs.Size;
+        baked.IndexAdvanceXCount = font->IndexAdvanceX.Size;
+        baked.IndexLookupCount = font->IndexLookup.Size;
+        memcpy(baked.Used4kPagesMap, font->Used4kPagesMap, sizeof(baked.Used4kPagesMap));
+        ImFontAtlasBakedWrite(out_data, &baked, sizeof(baked));
+        ImFontAtlasBakedWrite(out_data, font->Glyphs.Data, (size_t)font->Glyphs.size_in_bytes());
+        ImFontAtlasBakedWrite(out_data, font->IndexAdvanceX.Data, (size_t)font->IndexAdvanceX.size_in_bytes());
+        ImFontAtlasBakedWrite(out_data, font->IndexLookup.Data, (size_t)font->IndexLookup.size_in_bytes());
+    }
+
+    const void* pixels = TexPixelsAlpha8 ? (const void*)TexPixelsAlpha8 : (const void*)TexPixelsRGBA32;
+    ImFontAtlasBakedWrite(out_data, pixels, (size_t)TexWidth * (size_t)TexHeight * (size_t)header.TexBytesPerPixel);
+    return true;
+}
+
+bool ImFontAtlas::LoadBakedFromMemory(const void* data, size_t data_size)
+{
+    IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    const unsigned char* p = (const unsigned char*)data;
+    const unsigned char* p_end = p + data_size;
+
+    // Default font if none are specified, same as Build()
+    if (ConfigData.Size == 0)
+        AddFontDefault();
+
+    // Validate header against current inputs
+    ImFontAtlasBakedHeader header;
+    if (!ImFontAtlasBakedRead(&p, p_end, &header, sizeof(header)))
+        return false;
+    if (header.Magic != IM_FONT_ATLAS_BAKED_MAGIC || header.Version != IM_FONT_ATLAS_BAKED_VERSION || header.ImGuiVersion != IMGUI_VERSION_NUM)
+        return false;
+    if (header.SizeofWchar != sizeof(ImWchar) || header.SizeofGlyph != sizeof(ImFontGlyph) || (header.TexBytesPerPixel != 1 && header.TexBytesPerPixel != 4))
+        return false;
+    if (header.BuildHash != CalcBuildHash() || header.FontsCount != Fonts.Size)
+        return false;
+    const size_t tex_size = (size_t)header.TexWidth * (size_t)header.TexHeight * (size_t)header.TexBytesPerPixel;
+    if (header.TexWidth <= 0 || header.TexHeight <= 0 || tex_size > data_size)
+        return false;
+
+    // Register default rects exactly as the builder would have, so PackId* and CustomRects match the cached packing
+    ImFontAtlasBuildInit(this);
+    if (header.CustomRectsCount != CustomRects.Size || header.PackIdMouseCursors != PackIdMouseCursors || header.PackIdLines != PackIdLines)
+        return false;
+    ImVector<unsigned short> rects_pos;
+    rects_pos.resize(CustomRects.Size * 2);
+    if (!ImFontAtlasBakedRead(&p, p_end, rects_pos.Data, (size_t)rects_pos.size_in_bytes()))
+        return false;
+
+    // From here we start overwriting output data: a truncated file past this point leaves the atlas cleared/unbuilt.
+    ClearTexData();
+    TexReady = false;
+    for (int i = 0; i < ConfigData.Size; i++)
+        ImFontAtlasBuildSetupFont(this, ConfigData[i].DstFont, &ConfigData[i], 0.0f, 0.0f);
+
+    for (int font_n = 0; font_n < Fonts.Size; font_n++)
+    {
+        ImFont* font = Fonts[font_n];
+        ImFontAtlasBakedFont baked;
+        if (!ImFontAtlasBakedRead(&p, p_end, &baked, sizeof(baked)))
+            return false;
+        if (baked.GlyphsCount < 0 || baked.IndexLookupCount < 0 || baked.IndexAdvanceXCount != baked.IndexLookupCount || baked.FallbackGlyphIndex >= baked.GlyphsCount)
+            return false;
+        const size_t font_data_size = (size_t)baked.GlyphsCount * sizeof(ImFontGlyph) + (size_t)baked.IndexLookupCount * (sizeof(float) + sizeof(ImWchar));
+        if (baked.IndexLookupCount > IM_UNICODE_CODEPOINT_MAX + 1 || font_data_size > (size_t)(p_end - p))
+            return false;
+        font->Glyphs.resize(baked.GlyphsCount);
+        font->IndexAdvanceX.resize(baked.IndexAdvanceXCount);
+        font->IndexLookup.resize(baked.IndexLookupCount);
+        if (!ImFontAtlasBakedRead(&p, p_end, font->Glyphs.Data, (size_t)font->Glyphs.size_in_bytes()) ||
+            !ImFontAtlasBakedRead(&p, p_end, font->IndexAdvanceX.Data, (size_t)font->IndexAdvanceX.size_in_bytes()) ||
+            !ImFontAtlasBakedRead(&p, p_end, font->IndexLookup.Data, (size_t)font->IndexLookup.size_in_bytes()))
+            return false;
+
+        // FindGlyph() indexes Glyphs[] with IndexLookup[] unchecked, reject a corrupted or stale lookup table
+        for (int i = 0; i < font->IndexLookup.Size; i++)
+            if (font->IndexLookup[i] != (ImWchar)-1 && font->IndexLookup[i] >= font->Glyphs.Size)
+                return false;
+        font->FontSize = baked.FontSize;
+        font->Ascent = baked.Ascent;
+        font->Descent = baked.Descent;
+        font->FallbackAdvanceX = baked.FallbackAdvanceX;
+        font->FallbackGlyph = baked.FallbackGlyphIndex >= 0 ? &font->Glyphs[baked.FallbackGlyphIndex] : NULL;
+        font->MetricsTotalSurface = baked.MetricsTotalSurface;
+        font->FallbackChar = baked.FallbackChar;
+        font->EllipsisChar = baked.EllipsisChar;
+        font->DotChar = baked.DotChar;
+        font->DirtyLookupTables = false;
+        memcpy(font->Used4kPagesMap, baked.Used4kPagesMap, sizeof(font->Used4kPagesMap));
+    }
+
+    if ((size_t)(p_end - p) < tex_size)
+        return false;
+    TexWidth = header.TexWidth;
+    TexHeight = header.TexHeight;
+    TexUvScale = ImVec2(1.0f / TexWidth, 1.0f / TexHeight);
+    TexUvWhitePixel = header.TexUvWhitePixel;
+    memcpy(TexUvLines, header.TexUvLines, sizeof(TexUvLines));
+    if (header.TexBytesPerPixel == 1)
+    {
+        TexPixelsAlpha8 = (unsigned char*)IM_ALLOC(tex_size);
+        memcpy(TexPixelsAlpha8, p, tex_size);
+    }
+    else
+    {
+        TexPixelsRGBA32 = (unsigned int*)IM_ALLOC(tex_size);
+        memcpy(TexPixelsRGBA32, p, tex_size);
+        TexPixelsUseColors = true;
+    }
+    for (int i = 0; i < CustomRects.Size; i++)
+    {
+        CustomRects[i].X = rects_pos[i * 2 + 0];
+        CustomRects[i].Y = rects_pos[i * 2 + 1];
+    }
+    TexReady = true;
+    return true;
+}
+
+bool ImFontAtlas::SaveBakedToFile(const char* filename) const
+{
+    ImVector<unsigned char> data;
+    if (!SaveBakedToMemory(&data))
+        return false;
+    ImFileHandle f = ImFileOpen(filename, "wb");
+    if (!f)
+        return false;
+    const bool ret = ImFileWrite(data.Data, sizeof(unsigned char), (ImU64)data.Size, f) == (ImU64)data.Size;
+    ImFileClose(f);
+    return ret;
+}
+
+bool ImFontAtlas::LoadBakedFromFile(const char* filename)
+{
+    size_t data_size = 0;
+    void* data = ImFileLoadToMemory(filename, "rb", &data_size);
+    if (!data)
+        return false;
+    const bool ret = LoadBakedFromMemory(data, data_size);
+    IM_FREE(data);
+    return ret;
+}
+
+bool ImFontAtlas::BuildCached(const char* filename)
+{
+    if (LoadBakedFromFile(filename))
+        return true;
+    if (!Build())
+        return false;
+    SaveBakedToFile(filename); // Failing to write the cache is not an error, we'll simply rebuild next time
+    return true;
+}
+
 // Retrieve list of range (2 int per range, values are inclusive)
 const ImWchar*   ImFontAtlas::GetGlyphRangesDefault()
 {
@@ -3713,10 +4515,10 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
                 {
                     idx_write[0] = (ImDrawIdx)(vtx_current_idx); idx_write[1] = (ImDrawIdx)(vtx_current_idx+1); idx_write[2] = (ImDrawIdx)(vtx_current_idx+2);
                     idx_write[3] = (ImDrawIdx)(vtx_current_idx); idx_write[4] = (ImDrawIdx)(vtx_current_idx+2); idx_write[5] = (ImDrawIdx)(vtx_current_idx+3);
-                    vtx_write[0].pos.x = x1; vtx_write[0].pos.y = y1; vtx_write[0].col = glyph_col; vtx_write[0].uv.x = u1; vtx_write[0].uv.y = v1;
-                    vtx_write[1].pos.x = x2; vtx_write[1].pos.y = y1; vtx_write[1].col = glyph_col; vtx_write[1].uv.x = u2; vtx_write[1].uv.y = v1;
-                    vtx_write[2].pos.x = x2; vtx_write[2].pos.y = y2; vtx_write[2].col = glyph_col; vtx_write[2].uv.x = u2; vtx_write[2].uv.y = v2;
-                    vtx_write[3].pos.x = x1; vtx_write[3].pos.y = y2; vtx_write[3].col = glyph_col; vtx_write[3].uv.x = u1; vtx_write[3].uv.y = v2;
+                    draw_list->SetVtx(&vtx_write[0], ImVec2(x1, y1), ImVec2(u1, v1), glyph_col);
+                    draw_list->SetVtx(&vtx_write[1], ImVec2(x2, y1), ImVec2(u2, v1), glyph_col);
+                    draw_list->SetVtx(&vtx_write[2], ImVec2(x2, y2), ImVec2(u2, v2), glyph_col);
+                    draw_list->SetVtx(&vtx_write[3], ImVec2(x1, y2), ImVec2(u1, v2), glyph_col);
                     vtx_write += 4;
                     vtx_current_idx += 4;
                     idx_write += 6;
@@ -112,6 +112,7 @@ Index of this file:
 struct ImBitVector;                 // Store 1-bit per value
 struct ImRect;                      // An axis-aligned rectangle (2 points)
 struct ImDrawDataBuilder;           // Helper to build a ImDrawData instance
+struct ImDrawDataDamage;            // Helper to compare a ImDrawData with the previous frame and output ImDrawData::DamageRects
 struct ImDrawListSharedData;        // Data shared between all ImDrawList instances
 struct ImGuiColorMod;               // Stacked color modifier, backup of modified data so we can restore it
 struct ImGuiContext;                // Main Dear ImGui context
@@ -149,6 +150,7 @@ struct ImGuiWindowSettings;         // Storage for a window .ini settings (we ke
 // Use your programming IDE "Go to definition" facility on the names of the center columns to find the actual flags/enum lists.
 typedef int ImGuiDataAuthority;         // -> enum ImGuiDataAuthority_      // Enum: for storing the source authority (dock node vs window) of a field
 typedef int ImGuiLayoutType;            // -> enum ImGuiLayoutType_         // Enum: Horizontal or vertical
+typedef int ImGuiMemTag;                // -> enum ImGuiMemTag_             // Enum: Subsystem heap allocations are attributed to, for Metrics
 typedef int ImGuiActivateFlags;         // -> enum ImGuiActivateFlags_      // Flags: for navigation/focus function (will be for ActivateItem() later)
 typedef int ImGuiItemFlags;             // -> enum ImGuiItemFlags_          // Flags: for PushItemFlag()
 typedef int ImGuiItemStatusFlags;       // -> enum ImGuiItemStatusFlags_    // Flags: for DC.LastItemStatusFlags
@@ -309,6 +311,7 @@ namespace ImStb
 // Helpers: Hashing
 IMGUI_API ImGuiID       ImHashData(const void* data, size_t data_size, ImU32 seed = 0);
 IMGUI_API ImGuiID       ImHashStr(const char* data, size_t data_size = 0, ImU32 seed = 0);
+IMGUI_API ImU64         ImHashData64(const void* data, size_t data_size, ImU64 seed = 0);
 #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
 static inline ImGuiID   ImHash(const void* data, int size, ImU32 seed = 0) { return size ? ImHashData(data, (size_t)size, seed) : ImHashStr((const char*)data, 0, seed); } // [moved to ImHashStr/ImHashData in 1.68]
 #endif
@@ -337,6 +340,7 @@ IMGUI_API int           ImStrlenW(const ImWchar* str);
 IMGUI_API const char*   ImStreolRange(const char* str, const char* str_end);                // End end-of-line
 IMGUI_API const ImWchar*ImStrbolW(const ImWchar* buf_mid_line, const ImWchar* buf_begin);   // Find beginning-of-line
 IMGUI_API const char*   ImStristr(const char* haystack, const char* haystack_end, const char* needle, const char* needle_end);
+IMGUI_API const char*   ImStristrFolded(const char* haystack, const char* haystack_end, const char* needle_folded, const char* needle_folded_end); // Same as ImStristr() with a needle already ASCII lower-cased (see ImCharFoldA)
 IMGUI_API void          ImStrTrimBlanks(char* str);
 IMGUI_API const char*   ImStrSkipBlank(const char* str);
 IMGUI_API int           ImFormatString(char* buf, size_t buf_size, const char* fmt, ...) IM_FMTARGS(3);
@@ -347,6 +351,7 @@ IMGUI_API const char*   ImParseFormatTrimDecorations(const char* format, char* b
 IMGUI_API int           ImParseFormatPrecision(const char* format, int default_value);
 static inline bool      ImCharIsBlankA(char c)          { return c == ' ' || c == '\t'; }
 static inline bool      ImCharIsBlankW(unsigned int c)  { return c == ' ' || c == '\t' || c == 0x3000; }
+static inline char      ImCharFoldA(char c)             { return (c >= 'A' && c <= 'Z') ? (char)(c + ('a' - 'A')) : c; } // ASCII case folding, as used by ImStristr()
 
 // Helpers: UTF-8 <> wchar conversions
 IMGUI_API const char*   ImTextCharToUtf8(char out_buf[5], unsigned int c);                                                      // return out_buf
@@ -469,6 +474,7 @@ IMGUI_API ImVec2     ImBezierCubicClosestPoint(const ImVec2& p1, const ImVec2& p
 IMGUI_API ImVec2     ImBezierCubicClosestPointCasteljau(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, const ImVec2& p, float tess_tol);// For auto-tessellated curves you can use tess_tol = style.CurveTessellationTol
 IMGUI_API ImVec2     ImBezierQuadraticCalc(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, float t);
 IMGUI_API ImVec2     ImLineClosestPoint(const ImVec2& a, const ImVec2& b, const ImVec2& p);
+IMGUI_API bool       ImLineClipToRect(ImVec2& a, ImVec2& b, const ImVec2& r_min, const ImVec2& r_max);                                                          // Clip segment in place, false if fully outside
 IMGUI_API bool       ImTriangleContainsPoint(const ImVec2& a, const ImVec2& b, const ImVec2& c, const ImVec2& p);
 IMGUI_API ImVec2     ImTriangleClosestPoint(const ImVec2& a, const ImVec2& b, const ImVec2& c, const ImVec2& p);
 IMGUI_API void       ImTriangleBarycentricCoords(const ImVec2& a, const ImVec2& b, const ImVec2& c, const ImVec2& p, float& out_u, float& out_v, float& out_w);
@@ -750,6 +756,39 @@ struct ImDrawDataBuilder
     IMGUI_API void FlattenIntoSingleLayer();
 };
 
+// Damage tracking, enabled with io.ConfigDamageTracking (one instance per viewport).
+// Every draw command is reduced to a hash of what it renders (vertices, indices, clip rectangle, texture) + the bounding box of its
+// vertices clipped by its clip rectangle. Draw lists are matched with the previous frame by identity and z-order, then commands are
+// matched by their common prefix/suffix: the bounding boxes of everything left unmatched (on either frame) are the damaged areas.
+struct ImDrawDataDamageCmd
+{
+    ImU64                   Hash;
+    ImVec4                  Bounds;
+};
+
+struct ImDrawDataDamageList
+{
+    const ImDrawList*       DrawList;
+    int                     CmdStart;           // Index into ImDrawDataDamage::Cmds[]
+    int                     CmdCount;
+};
+
+struct ImDrawDataDamage
+{
+    ImVector<ImDrawDataDamageCmd>   Cmds[2];    // [0] previous frame, [1] current frame
+    ImVector<ImDrawDataDamageList>  Lists[2];
+    ImVector<ImVec4>        Rects;              // Output, ImDrawData::DamageRects points here
+    ImVector<short>         LcsTable;           // Temporary storage to match draw lists
+    ImVec2                  DisplayPos;         // Of the previous frame
+    ImVec2                  DisplaySize;
+    ImVec2                  FramebufferScale;
+    bool                    HasPrevFrame;
+
+    ImDrawDataDamage()      { DisplayPos = DisplaySize = FramebufferScale = ImVec2(0.0f, 0.0f); HasPrevFrame = false; }
+    void Clear()            { for (int n = 0; n < 2; n++) { Cmds[n].clear(); Lists[n].clear(); } Rects.clear(); LcsTable.clear(); HasPrevFrame = false; }
+    IMGUI_API void Update(ImDrawData* draw_data);
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Widgets support: flags, enums, data structures
 //-----------------------------------------------------------------------------
@@ -1088,7 +1127,8 @@ enum ImGuiNextWindowDataFlags_
     ImGuiNextWindowDataFlags_HasScroll          = 1 << 7,
     ImGuiNextWindowDataFlags_HasViewport        = 1 << 8,
     ImGuiNextWindowDataFlags_HasDock            = 1 << 9,
-    ImGuiNextWindowDataFlags_HasWindowClass     = 1 << 10
+    ImGuiNextWindowDataFlags_HasWindowClass     = 1 << 10,
+    ImGuiNextWindowDataFlags_HasContentVersion  = 1 << 11
 };
 
 // Storage for SetNexWindow** functions
@@ -1113,6 +1153,7 @@ struct ImGuiNextWindowData
     ImGuiID                     ViewportId;
     ImGuiID                     DockId;
     ImGuiWindowClass            WindowClass;
+    int                         ContentVersionVal;
     ImVec2                      MenuBarOffsetMinVal;    // (Always on) This is not exposed publicly, so we don't clear it and it doesn't have a corresponding flag (could we? for consistency?)
 
     ImGuiNextWindowData()       { memset(this, 0, sizeof(*this)); }
@@ -1215,9 +1256,13 @@ struct ImGuiListClipperData
     int                             StepNo;
     int                             ItemsFrozen;
     ImVector<ImGuiListClipperRange> Ranges;
+    ImGuiListClipperHeights*        Heights;                // Variable height mode storage, NULL otherwise
+    int                             MeasureItem;            // Variable height mode: item being submitted by user, measured on next Step()
+    float                           MeasureStartY;          // Variable height mode: cursor position before MeasureItem
+    bool                            MeasureRangesBuilt;     // Variable height mode: visible ranges have been computed (DisplayStart can't tell as frozen rows set it first)
 
     ImGuiListClipperData()          { memset(this, 0, sizeof(*this)); }
-    void                            Reset(ImGuiListClipper* clipper) { ListClipper = clipper; StepNo = ItemsFrozen = 0; Ranges.resize(0); }
+    void                            Reset(ImGuiListClipper* clipper) { ListClipper = clipper; StepNo = ItemsFrozen = 0; Ranges.resize(0); Heights = NULL; MeasureItem = -1; MeasureStartY = 0.0f; MeasureRangesBuilt = false; }
 };
 
 //-----------------------------------------------------------------------------
@@ -1532,6 +1577,7 @@ struct ImGuiViewportP : public ImGuiViewport
     ImDrawList*         DrawLists[2];           // Convenience background (0) and foreground (1) draw lists. We use them to draw software mouser cursor when io.MouseDrawCursor is set and to draw most debug overlays.
     ImDrawData          DrawDataP;
     ImDrawDataBuilder   DrawDataBuilder;
+    ImDrawDataDamage    DrawDataDamage;         // When io.ConfigDamageTracking is set
     ImVec2              LastPlatformPos;
     ImVec2              LastPlatformSize;
     ImVec2              LastRendererSize;
@@ -1624,6 +1670,28 @@ struct ImGuiMetricsConfig
     }
 };
 
+// Subsystems MemAlloc() calls are attributed to, see SetMemTag()
+enum ImGuiMemTag_
+{
+    ImGuiMemTag_Misc,           // Not attributed: user code, widgets
+    ImGuiMemTag_Frame,          // NewFrame(), EndFrame(), Render(): draw data, sorting buffers, settings
+    ImGuiMemTag_Window,         // Begin(), End(): window creation, decorations, id stack
+    ImGuiMemTag_Table,          // BeginTable(), EndTable()
+    ImGuiMemTag_Font,           // ImFontAtlas::Build()
+    ImGuiMemTag_Plot,           // ImPlot BeginPlot(), SetupFinish(), EndPlot()
+    ImGuiMemTag_COUNT
+};
+
+// Heap calls made through MemAlloc()/MemFree() during one frame
+struct ImGuiMemStats
+{
+    int         AllocCount[ImGuiMemTag_COUNT];
+    size_t      AllocBytes[ImGuiMemTag_COUNT];
+    int         FreeCount;
+
+    ImGuiMemStats() { memset(this, 0, sizeof(*this)); }
+};
+
 struct ImGuiStackLevelInfo
 {
     ImGuiID                 ID;
@@ -1927,6 +1995,12 @@ struct ImGuiContext
     ImGuiID                 DebugItemPickerBreakId;             // Will call IM_DEBUG_BREAK() when encountering this ID
     ImGuiMetricsConfig      DebugMetricsConfig;
     ImGuiStackTool          DebugStackTool;
+    int                     DebugDrawMergeFrame;                // Frame of the last ImDrawDataMerger::Merge(), draw call counts summed over viewports for Metrics
+    int                     DebugDrawMergeCmdCountIn;
+    int                     DebugDrawMergeCmdCountOut;
+    ImGuiMemTag             MemTagCurrent;                      // Subsystem following MemAlloc() calls are attributed to
+    ImGuiMemStats           MemStatsCurrFrame;
+    ImGuiMemStats           MemStatsLastFrame;
 
     // Misc
     float                   FramerateSecPerFrame[120];          // Calculate estimate of framerate for user over the last 2 seconds.
@@ -2088,6 +2162,9 @@ struct ImGuiContext
 
         DebugItemPickerActive = false;
         DebugItemPickerBreakId = 0;
+        DebugDrawMergeFrame = -1;
+        MemTagCurrent = ImGuiMemTag_Misc;
+        DebugDrawMergeCmdCountIn = DebugDrawMergeCmdCountOut = 0;
 
         memset(FramerateSecPerFrame, 0, sizeof(FramerateSecPerFrame));
         FramerateSecPerFrameIdx = FramerateSecPerFrameCount = 0;
@@ -2150,6 +2227,42 @@ struct IMGUI_API ImGuiWindowTempData
     ImVector<float>         TextWrapPosStack;       // Store text wrap pos to restore (attention: .back() is not == TextWrapPos)
 };
 
+// One command of ImGuiWindowDrawCache
+struct ImGuiWindowDrawCacheCmd
+{
+    ImVec4                  ClipRect;
+    ImTextureID             TextureId;
+    unsigned int            VtxOffset;              // First vertex in ImGuiWindowDrawCache::VtxBuffer, indices are relative to it
+    unsigned int            VtxCount;               // Span of vertices referenced by the indices (< 64K with 16-bit indices)
+    unsigned int            IdxOffset;
+    unsigned int            ElemCount;
+};
+
+// Retained geometry of a window contents, for windows using ImGuiWindowFlags_RetainDrawList.
+// Recorded between the end of Begin() and End() of the first Begin/End pair of a frame, and appended to the draw list instead
+// of submitting the contents on the following frames as long as Key doesn't change and the window is left alone by the user.
+struct ImGuiWindowDrawCache
+{
+    ImVector<ImGuiWindowDrawCacheCmd> CmdBuffer;
+    ImVector<ImDrawIdx>     IdxBuffer;
+    ImVector<ImDrawVert>    VtxBuffer;
+    ImGuiID                 Key;                    // Hash of everything the contents geometry depends on besides the window position (size, scroll, clipping, style, font, content version..)
+    ImVec2                  Pos;                    // Window position at record time, geometry is translated when only the position changed
+    ImVec2                  CursorMaxPos;           // DC.CursorMaxPos/DC.IdealMaxPos relative to DC.CursorStartPos at record time, restored on replay to preserve ContentSize
+    ImVec2                  IdealMaxPos;
+    ImVec2                  CursorPos;              // DC.CursorPos/DC.CursorPosPrevLine relative to DC.CursorStartPos at record time, restored on replay so contents appended by another Begin() follow the replayed ones
+    ImVec2                  CursorPosPrevLine;
+    bool                    Valid;
+    bool                    Recording;              // Set from Begin() to End() while recording
+    int                     RecordCmdStart;         // Draw list sizes at the end of Begin(), start of the recorded contents
+    int                     RecordIdxStart;
+    int                     RecordVtxStart;
+    int                     ContentVersion;         // Set with SetNextWindowContentVersion(), 0 otherwise
+    int                     LastFrameReplayed;
+    int                     HitCount;               // Number of frames replayed/submitted, for Metrics
+    int                     MissCount;
+};
+
 // Storage for one window
 struct IMGUI_API ImGuiWindow
 {
@@ -2255,6 +2368,7 @@ struct IMGUI_API ImGuiWindow
     int                     MemoryDrawListIdxCapacity;          // Backup of last idx/vtx count, so when waking up the window we can preallocate and avoid iterative alloc/copy
     int                     MemoryDrawListVtxCapacity;
     bool                    MemoryCompacted;                    // Set when window extraneous data have been garbage collected
+    ImGuiWindowDrawCache    DrawCache;                          // Retained contents geometry when using ImGuiWindowFlags_RetainDrawList
 
     // Docking
     bool                    DockIsActive        :1;             // When docking artifacts are actually visible. When this is set, DockNode is guaranteed to be != NULL. ~~ (DockNode != NULL) && (DockNode->Windows.Size > 1).
@@ -3063,6 +3177,9 @@ namespace ImGui
     IMGUI_API void          ShadeVertsLinearColorGradientKeepAlpha(ImDrawList* draw_list, int vert_start_idx, int vert_end_idx, ImVec2 gradient_p0, ImVec2 gradient_p1, ImU32 col0, ImU32 col1);
     IMGUI_API void          ShadeVertsLinearUV(ImDrawList* draw_list, int vert_start_idx, int vert_end_idx, const ImVec2& a, const ImVec2& b, const ImVec2& uv_a, const ImVec2& uv_b, bool clamp);
 
+    // Memory
+    IMGUI_API ImGuiMemTag   SetMemTag(ImGuiMemTag tag);     // Attribute following MemAlloc() calls to 'tag' for Metrics, return the previous tag to restore
+
     // Garbage collection
     IMGUI_API void          GcCompactTransientMiscBuffers();
     IMGUI_API void          GcCompactTransientWindowBuffers(ImGuiWindow* window);
@@ -331,6 +331,7 @@ bool    ImGui::BeginTableEx(const char* name, ImGuiID id, int columns_count, ImG
     }
 
     // Acquire storage for the table
+    const ImGuiMemTag backup_mem_tag = SetMemTag(ImGuiMemTag_Table);
     ImGuiTable* table = g.Tables.GetOrAddByKey(id);
     const int instance_no = (table->LastFrameActive != g.FrameCount) ? 0 : table->InstanceCurrent + 1;
     const ImGuiID instance_id = id + instance_no;
@@ -556,6 +557,7 @@ bool    ImGui::BeginTableEx(const char* name, ImGuiID id, int columns_count, ImG
     // Apply queued resizing/reordering/hiding requests
     TableBeginApplyRequests(table);
 
+    SetMemTag(backup_mem_tag);
     return true;
 }
 
@@ -1197,6 +1199,7 @@ void    ImGui::EndTable()
     ImGuiContext& g = *GImGui;
     ImGuiTable* table = g.CurrentTable;
     IM_ASSERT(table != NULL && "Only call EndTable() if BeginTable() returns true!");
+    const ImGuiMemTag backup_mem_tag = SetMemTag(ImGuiMemTag_Table);
 
     // This assert would be very useful to catch a common error... unfortunately it would probably trigger in some
     // cases, and for consistency user may sometimes output empty tables (and still benefit from e.g. outer border)
@@ -1390,6 +1393,7 @@ void    ImGui::EndTable()
         g.CurrentTable->DrawSplitter = &temp_data->DrawSplitter;
     }
     outer_window->DC.CurrentTableIdx = g.CurrentTable ? g.Tables.GetIndex(g.CurrentTable) : -1;
+    SetMemTag(backup_mem_tag);
 }
 
 // See "COLUMN SIZING POLICIES" comments at the top of this file
@@ -15,6 +15,7 @@ Index of this file:
 // [SECTION] Widgets: SliderScalar, SliderFloat, SliderInt, etc.
 // [SECTION] Widgets: InputScalar, InputFloat, InputInt, etc.
 // [SECTION] Widgets: InputText, InputTextMultiline
+// [SECTION] Widgets: InputTextLarge, ImGuiTextDocument
 // [SECTION] Widgets: ColorEdit, ColorPicker, ColorButton, etc.
 // [SECTION] Widgets: TreeNode, CollapsingHeader, etc.
 // [SECTION] Widgets: Selectable
@@ -4837,6 +4838,686 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         return value_changed;
 }
 
+//-------------------------------------------------------------------------
+// [SECTION] Widgets: InputTextLarge, ImGuiTextDocument
+//-------------------------------------------------------------------------
+// - ImGuiTextDocument
+// - InputTextLarge()
+//-------------------------------------------------------------------------
+
+ImGuiTextDocument::ImGuiTextDocument()
+{
+    Length = 0;
+    UndoTextMax = 16 * 1024 * 1024;
+    UndoMergeable = false;
+    Cursor = SelectStart = 0;
+    PreferredX = -1.0f;
+    WidestLine = 0.0f;
+    CursorAnim = 0.0f;
+    LineStarts.Values.push_back(0);
+}
+
+// Add 'delta' to offsets [from, end) by moving the pending step to start at 'from', which only touches the entries in between
+static void ImGuiTextDocument_ShiftOffsets(ImGuiTextDocument::ImGuiTextOffsets* offsets, int from, int delta)
+{
+    ImVector<int>& values = offsets->Values;
+    if (offsets->Step != 0)
+    {
+        if (from > offsets->StepFrom)
+            for (int n = offsets->StepFrom; n < from && n < values.Size; n++)
+                values[n] += offsets->Step;
+        else
+            for (int n = from; n < offsets->StepFrom && n < values.Size; n++)
+                values[n] -= offsets->Step;
+    }
+    offsets->StepFrom = from;
+    offsets->Step += delta;
+}
+
+// Make room for 'count' offsets at 'at' in a single splice, the caller stores them less offsets->Step
+static int* ImGuiTextDocument_InsertOffsets(ImGuiTextDocument::ImGuiTextOffsets* offsets, int at, int count)
+{
+    ImGuiTextDocument_ShiftOffsets(offsets, at, 0);
+    ImVector<int>& values = offsets->Values;
+    const int old_size = values.Size;
+    values.resize(old_size + count);
+    memmove(values.Data + at + count, values.Data + at, (size_t)(old_size - at) * sizeof(int));
+    return values.Data + at;
+}
+
+static void ImGuiTextDocument_EraseOffsets(ImGuiTextDocument::ImGuiTextOffsets* offsets, int at, int count)
+{
+    if (count == 0)
+        return;
+    ImGuiTextDocument_ShiftOffsets(offsets, at, 0);
+    offsets->Values.erase(offsets->Values.Data + at, offsets->Values.Data + at + count);
+}
+
+// Index of the piece containing 'pos', Pieces.Size when 'pos' is at or past the end of the text
+static int ImGuiTextDocument_FindPiece(const ImGuiTextDocument* doc, int pos)
+{
+    if (pos >= doc->Length)
+        return doc->Pieces.Size;
+    int lo = 0, hi = doc->Pieces.Size - 1;
+    while (lo < hi)
+    {
+        const int mid = (lo + hi + 1) >> 1;
+        if (doc->PieceStarts[mid] <= pos)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+    return lo;
+}
+
+void ImGuiTextDocument::SetText(const char* text, const char* text_end)
+{
+    if (!text_end)
+        text_end = text + strlen(text);
+    const int len = (int)(text_end - text);
+    Original.resize(len);
+    if (len > 0)
+        memcpy(Original.Data, text, (size_t)len);
+    Added.resize(0);
+    Pieces.resize(0);
+    PieceStarts.Values.resize(0);
+    PieceStarts.StepFrom = PieceStarts.Step = 0;
+    if (len > 0)
+    {
+        ImGuiTextPiece piece = { false, 0, len };
+        Pieces.push_back(piece);
+        PieceStarts.Values.push_back(0);
+    }
+    Length = len;
+
+    // Full scan only happens here, edits update LineStarts incrementally
+    LineStarts.Values.resize(0);
+    LineStarts.Values.push_back(0);
+    LineStarts.StepFrom = LineStarts.Step = 0;
+    for (const char* p = text; (p = (const char*)memchr(p, '\n', (size_t)(text_end - p))) != NULL; p++)
+        LineStarts.Values.push_back((int)(p - text) + 1);
+
+    ClearUndo();
+    Cursor = SelectStart = 0;
+    PreferredX = -1.0f;
+    WidestLine = 0.0f;
+}
+
+void ImGuiTextDocument::CopyRange(int pos, int len, ImVector<char>* out) const
+{
+    IM_ASSERT(pos >= 0 && len >= 0 && pos + len <= Length);
+    out->resize(len + 1);
+    char* dst = out->Data;
+    for (int n = ImGuiTextDocument_FindPiece(this, pos); n < Pieces.Size && len > 0; n++)
+    {
+        const ImGuiTextPiece& piece = Pieces[n];
+        const int copy_offset = pos - PieceStarts[n];
+        const int copy_len = ImMin(len, piece.Length - copy_offset);
+        const char* src = (piece.InAdded ? Added.Data : Original.Data) + piece.Offset + copy_offset;
+        memcpy(dst, src, (size_t)copy_len);
+        dst += copy_len;
+        pos += copy_len;
+        len -= copy_len;
+    }
+    *dst = 0;
+}
+
+void ImGuiTextDocument::GetText(ImVector<char>* out) const
+{
+    CopyRange(0, Length, out);
+}
+
+char ImGuiTextDocument::GetChar(int pos) const
+{
+    const int n = ImGuiTextDocument_FindPiece(this, pos);
+    if (n == Pieces.Size)
+        return 0;
+    const ImGuiTextPiece& piece = Pieces[n];
+    return (piece.InAdded ? Added.Data : Original.Data)[piece.Offset + pos - PieceStarts[n]];
+}
+
+int ImGuiTextDocument::GetLineFromOffset(int pos) const
+{
+    // Last line starting at or before 'pos'
+    int lo = 0, hi = LineStarts.Size() - 1;
+    while (lo < hi)
+    {
+        const int mid = (lo + hi + 1) >> 1;
+        if (LineStarts[mid] <= pos)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+    return lo;
+}
+
+// Split piece containing 'pos' so that a piece boundary exists at 'pos', return index of the piece starting at 'pos' (may be == Pieces.Size)
+static int ImGuiTextDocument_SplitPieceAt(ImGuiTextDocument* doc, int pos)
+{
+    const int n = ImGuiTextDocument_FindPiece(doc, pos);
+    if (n == doc->Pieces.Size)
+        return n;
+    const int piece_start = doc->PieceStarts[n];
+    if (pos == piece_start)
+        return n;
+    ImGuiTextDocument::ImGuiTextPiece tail = doc->Pieces[n];
+    tail.Offset += pos - piece_start;
+    tail.Length -= pos - piece_start;
+    doc->Pieces[n].Length = pos - piece_start;
+    doc->Pieces.insert(doc->Pieces.Data + n + 1, tail);
+    *ImGuiTextDocument_InsertOffsets(&doc->PieceStarts, n + 1, 1) = pos - doc->PieceStarts.Step;
+    return n + 1;
+}
+
+void ImGuiTextDocument::Replace(int pos, int remove_len, const char* text, int text_len, bool record_undo)
+{
+    IM_ASSERT(pos >= 0 && remove_len >= 0 && pos + remove_len <= Length);
+    if (remove_len == 0 && text_len == 0)
+        return;
+
+    // Record delta for undo. Contiguous typing is merged in a single record.
+    if (record_undo)
+    {
+        RedoStack.resize(0);
+        ImGuiTextUndoRecord* last = UndoStack.Size > 0 ? &UndoStack.back() : NULL;
+        const bool merge = UndoMergeable && last && remove_len == 0 && last->Pos + last->InsertedLen == pos && last->InsertedOffset + last->InsertedLen == UndoText.Size;
+        if (merge)
+        {
+            UndoText.resize(UndoText.Size + text_len);
+            memcpy(UndoText.Data + UndoText.Size - text_len, text, (size_t)text_len);
+            last->InsertedLen += text_len;
+        }
+        else
+        {
+            ImGuiTextUndoRecord rec;
+            rec.Pos = pos;
+            rec.CursorBefore = Cursor;
+            rec.RemovedOffset = UndoText.Size;
+            rec.RemovedLen = remove_len;
+            if (remove_len > 0)
+            {
+                CopyRange(pos, remove_len, &LineBuf);
+                UndoText.resize(UndoText.Size + remove_len);
+                memcpy(UndoText.Data + rec.RemovedOffset, LineBuf.Data, (size_t)remove_len);
+            }
+            rec.InsertedOffset = UndoText.Size;
+            rec.InsertedLen = text_len;
+            UndoText.resize(UndoText.Size + text_len);
+            if (text_len > 0)
+                memcpy(UndoText.Data + rec.InsertedOffset, text, (size_t)text_len);
+            UndoStack.push_back(rec);
+        }
+
+        // Forget the oldest records once their text outgrows UndoTextMax, always keeping the last one
+        if (UndoTextMax > 0 && UndoText.Size > UndoTextMax)
+        {
+            int keep_from = UndoStack.Size - 1;
+            while (keep_from > 0 && UndoText.Size - UndoStack[keep_from - 1].RemovedOffset <= UndoTextMax / 2)
+                keep_from--;
+            const int text_start = UndoStack[keep_from].RemovedOffset;
+            if (text_start > 0)
+            {
+                UndoStack.erase(UndoStack.Data, UndoStack.Data + keep_from);
+                memmove(UndoText.Data, UndoText.Data + text_start, (size_t)(UndoText.Size - text_start));
+                UndoText.resize(UndoText.Size - text_start);
+                for (int n = 0; n < UndoStack.Size; n++)
+                {
+                    UndoStack[n].RemovedOffset -= text_start;
+                    UndoStack[n].InsertedOffset -= text_start;
+                }
+            }
+        }
+    }
+
+    // Remove pieces in [pos, pos + remove_len)
+    int piece_n = ImGuiTextDocument_SplitPieceAt(this, pos);
+    if (remove_len > 0)
+    {
+        const int piece_end_n = ImGuiTextDocument_SplitPieceAt(this, pos + remove_len);
+        Pieces.erase(Pieces.Data + piece_n, Pieces.Data + piece_end_n);
+        ImGuiTextDocument_EraseOffsets(&PieceStarts, piece_n, piece_end_n - piece_n);
+    }
+
+    // Insert new piece, or extend previous one when appending right after it in the Added buffer (typing)
+    if (text_len > 0)
+    {
+        ImGuiTextPiece* prev = piece_n > 0 ? &Pieces[piece_n - 1] : NULL;
+        if (prev && prev->InAdded && prev->Offset + prev->Length == Added.Size)
+        {
+            prev->Length += text_len;
+        }
+        else
+        {
+            ImGuiTextPiece piece = { true, Added.Size, text_len };
+            Pieces.insert(Pieces.Data + piece_n, piece);
+            *ImGuiTextDocument_InsertOffsets(&PieceStarts, piece_n, 1) = pos - PieceStarts.Step;
+            piece_n++;
+        }
+        Added.resize(Added.Size + text_len);
+        memcpy(Added.Data + Added.Size - text_len, text, (size_t)text_len);
+    }
+    const int delta = text_len - remove_len;
+    ImGuiTextDocument_ShiftOffsets(&PieceStarts, piece_n, delta);
+    Length += delta;
+
+    // Update line index: drop starts inside the removed range, shift following ones, splice in starts for inserted newlines
+    const int line_n = GetLineFromOffset(pos) + 1;
+    int line_removed_end = line_n;
+    while (line_removed_end < LineStarts.Size() && LineStarts[line_removed_end] <= pos + remove_len)
+        line_removed_end++;
+    ImGuiTextDocument_EraseOffsets(&LineStarts, line_n, line_removed_end - line_n);
+    ImGuiTextDocument_ShiftOffsets(&LineStarts, line_n, delta);
+    int new_lines = 0;
+    for (const char* p = text; text_len > 0 && (p = (const char*)memchr(p, '\n', (size_t)(text + text_len - p))) != NULL; p++)
+        new_lines++;
+    if (new_lines > 0)
+    {
+        int* dst = ImGuiTextDocument_InsertOffsets(&LineStarts, line_n, new_lines);
+        for (const char* p = text; (p = (const char*)memchr(p, '\n', (size_t)(text + text_len - p))) != NULL; p++)
+            *dst++ = pos + (int)(p - text) + 1 - LineStarts.Step;
+    }
+}
+
+bool ImGuiTextDocument::Undo()
+{
+    if (UndoStack.Size == 0)
+        return false;
+    ImGuiTextUndoRecord rec = UndoStack.back();
+    UndoStack.pop_back();
+    Replace(rec.Pos, rec.InsertedLen, UndoText.Data + rec.RemovedOffset, rec.RemovedLen, false);
+    RedoStack.push_back(rec);
+    Cursor = SelectStart = rec.CursorBefore;
+    UndoMergeable = false;
+    return true;
+}
+
+bool ImGuiTextDocument::Redo()
+{
+    if (RedoStack.Size == 0)
+        return false;
+    ImGuiTextUndoRecord rec = RedoStack.back();
+    RedoStack.pop_back();
+    Replace(rec.Pos, rec.RemovedLen, UndoText.Data + rec.InsertedOffset, rec.InsertedLen, false);
+    UndoStack.push_back(rec);
+    Cursor = SelectStart = rec.Pos + rec.InsertedLen;
+    UndoMergeable = false;
+    return true;
+}
+
+// Offset of the character under horizontal position 'x' (relative to line start) within 'line'
+static int InputTextLargeOffsetFromX(ImGuiTextDocument* doc, int line, float x)
+{
+    ImGuiContext& g = *GImGui;
+    const int line_start = doc->GetLineStart(line);
+    doc->CopyRange(line_start, doc->GetLineEnd(line) - line_start, &doc->LineBuf);
+    const float scale = g.FontSize / g.Font->FontSize;
+    const char* text = doc->LineBuf.Data;
+    const char* text_end = text + doc->LineBuf.Size - 1;
+    float line_x = 0.0f;
+    for (const char* p = text; p < text_end; )
+    {
+        unsigned int c;
+        const int c_len = ImTextCharFromUtf8(&c, p, text_end);
+        const float advance = ((c == '\t') ? g.Font->GetCharAdvance((ImWchar)' ') * IM_TABSIZE : g.Font->GetCharAdvance((ImWchar)c)) * scale;
+        if (x < line_x + advance * 0.5f)
+            return line_start + (int)(p - text);
+        line_x += advance;
+        p += c_len ? c_len : 1;
+    }
+    return line_start + (int)(text_end - text);
+}
+
+static float InputTextLargeXFromOffset(ImGuiTextDocument* doc, int pos)
+{
+    const int line_start = doc->GetLineStart(doc->GetLineFromOffset(pos));
+    doc->CopyRange(line_start, pos - line_start, &doc->LineBuf);
+    return ImGui::CalcTextSize(doc->LineBuf.Data, doc->LineBuf.Data + doc->LineBuf.Size - 1).x;
+}
+
+static int InputTextLargeMoveChar(const ImGuiTextDocument* doc, int pos, int dir)
+{
+    // Step over UTF-8 continuation bytes
+    if (dir < 0)
+    {
+        if (pos <= 0)
+            return 0;
+        pos--;
+        while (pos > 0 && (doc->GetChar(pos) & 0xC0) == 0x80)
+            pos--;
+    }
+    else
+    {
+        if (pos >= doc->Length)
+            return doc->Length;
+        pos++;
+        while (pos < doc->Length && (doc->GetChar(pos) & 0xC0) == 0x80)
+            pos++;
+    }
+    return pos;
+}
+
+// Only visible lines are measured and rendered. The contents width is the widest line seen so far.
+bool ImGui::InputTextLarge(const char* label, ImGuiTextDocument* doc, const ImVec2& size_arg, ImGuiInputTextFlags flags)
+{
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return false;
+
+    IM_ASSERT(doc != NULL);
+    ImGuiContext& g = *GImGui;
+    ImGuiIO& io = g.IO;
+    const ImGuiStyle& style = g.Style;
+    const bool is_readonly = (flags & ImGuiInputTextFlags_ReadOnly) != 0;
+    const bool is_undoable = (flags & ImGuiInputTextFlags_NoUndoRedo) == 0;
+
+    BeginGroup();
+    const ImGuiID id = window->GetID(label);
+    const ImVec2 label_size = CalcTextSize(label, NULL, true);
+    const ImVec2 frame_size = CalcItemSize(size_arg, CalcItemWidth(), g.FontSize * 8.0f + style.FramePadding.y * 2.0f);
+    const ImVec2 total_size = ImVec2(frame_size.x + (label_size.x > 0.0f ? style.ItemInnerSpacing.x + label_size.x : 0.0f), frame_size.y);
+    const ImRect frame_bb(window->DC.CursorPos, window->DC.CursorPos + frame_size);
+    const ImRect total_bb(frame_bb.Min, frame_bb.Min + total_size);
+
+    ImVec2 backup_pos = window->DC.CursorPos;
+    ItemSize(total_bb, style.FramePadding.y);
+    if (!ItemAdd(total_bb, id, &frame_bb, ImGuiItemFlags_Inputable))
+    {
+        EndGroup();
+        return false;
+    }
+    window->DC.CursorPos = backup_pos;
+
+    // Same child window setup as InputTextMultiline()
+    PushStyleColor(ImGuiCol_ChildBg, style.Colors[ImGuiCol_FrameBg]);
+    PushStyleVar(ImGuiStyleVar_ChildRounding, style.FrameRounding);
+    PushStyleVar(ImGuiStyleVar_ChildBorderSize, style.FrameBorderSize);
+    PushStyleVar(ImGuiStyleVar_WindowPadding, ImVec2(0, 0));
+    bool child_visible = BeginChildEx(label, id, frame_bb.GetSize(), true, ImGuiWindowFlags_NoMove | ImGuiWindowFlags_HorizontalScrollbar);
+    PopStyleVar(3);
+    PopStyleColor();
+    if (!child_visible)
+    {
+        EndChild();
+        EndGroup();
+        return false;
+    }
+    ImGuiWindow* draw_window = g.CurrentWindow;
+    const ImVec2 text_pos = draw_window->DC.CursorPos + style.FramePadding;
+    const float line_height = g.FontSize;
+    const ImRect inner_rect = draw_window->InnerRect;
+
+    const bool hovered = ItemHoverable(frame_bb, id);
+    if (hovered)
+        g.MouseCursor = ImGuiMouseCursor_TextInput;
+
+    // Activation
+    if (hovered && io.MouseClicked[0] && g.ActiveId != id)
+    {
+        SetActiveID(id, window);
+        SetFocusID(id, window);
+        FocusWindow(window);
+        g.ActiveIdUsingNavDirMask |= (1 << ImGuiDir_Left) | (1 << ImGuiDir_Right) | (1 << ImGuiDir_Up) | (1 << ImGuiDir_Down);
+        g.ActiveIdUsingNavInputMask |= (1 << ImGuiNavInput_Cancel);
+        g.ActiveIdUsingKeyInputMask |= ((ImU64)1 << ImGuiKey_Home) | ((ImU64)1 << ImGuiKey_End) | ((ImU64)1 << ImGuiKey_PageUp) | ((ImU64)1 << ImGuiKey_PageDown);
+        if (flags & ImGuiInputTextFlags_AllowTabInput)
+            g.ActiveIdUsingKeyInputMask |= ((ImU64)1 << ImGuiKey_Tab);
+    }
+    else if (g.ActiveId == id && io.MouseClicked[0] && !hovered)
+    {
+        ClearActiveID();
+    }
+
+    bool value_changed = false;
+    const int cursor_before = doc->Cursor;
+    if (g.ActiveId == id)
+    {
+        g.ActiveIdAllowOverlap = !io.MouseDown[0];
+        g.WantTextInputNextFrame = 1;
+        doc->Cursor = ImClamp(doc->Cursor, 0, doc->Length);
+        doc->SelectStart = ImClamp(doc->SelectStart, 0, doc->Length);
+
+        // Mouse: click to place cursor (shift+click extends selection), drag to select
+        const int line_count = doc->GetLineCount();
+        if (hovered && (io.MouseClicked[0] || (io.MouseDown[0] && !io.MouseClicked[0])))
+        {
+            const int line = ImClamp((int)ImFloor((io.MousePos.y - text_pos.y) / line_height), 0, line_count - 1);
+            doc->Cursor = InputTextLargeOffsetFromX(doc, line, io.MousePos.x - text_pos.x);
+            if (io.MouseClicked[0] && !io.KeyShift)
+                doc->SelectStart = doc->Cursor;
+            doc->PreferredX = -1.0f;
+        }
+
+        // Keyboard navigation
+        const bool is_osx = io.ConfigMacOSXBehaviors;
+        const bool is_shortcut_key = is_osx ? (io.KeyMods == ImGuiKeyModFlags_Super) : (io.KeyMods == ImGuiKeyModFlags_Ctrl);
+        const int page_lines = ImMax((int)(inner_rect.GetHeight() / line_height) - 1, 1);
+
+        // Character inputs, encoded back to UTF-8. Processed before other keys like InputTextEx() does, so characters
+        // queued on the same frame as an edit key or shortcut are kept.
+        const bool ignore_char_inputs = (io.KeyCtrl && !io.KeyAlt) || (is_osx && io.KeySuper);
+        if ((flags & ImGuiInputTextFlags_AllowTabInput) && IsKeyPressedMap(ImGuiKey_Tab) && !ignore_char_inputs && !io.KeyShift && !is_readonly && !io.InputQueueCharacters.contains('\t'))
+            io.AddInputCharacter('\t');
+        if (io.InputQueueCharacters.Size > 0)
+        {
+            ImVector<char>& input_buf = doc->InputBuf;
+            input_buf.resize(0);
+            if (!ignore_char_inputs && !is_readonly)
+            {
+                input_buf.reserve(io.InputQueueCharacters.Size * 4);
+                for (int n = 0; n < io.InputQueueCharacters.Size; n++)
+                {
+                    const unsigned int c = (unsigned int)io.InputQueueCharacters[n];
+                    if ((c < 0x20 && c != '\t') || (c == '\t' && !(flags & ImGuiInputTextFlags_AllowTabInput)) || c == 0x7F || (c >= 0xE000 && c <= 0xF8FF))
+                        continue;
+                    char utf8[5];
+                    const int utf8_len = (int)strlen(ImTextCharToUtf8(utf8, c));
+                    input_buf.resize(input_buf.Size + utf8_len);
+                    memcpy(input_buf.Data + input_buf.Size - utf8_len, utf8, (size_t)utf8_len);
+                }
+            }
+            io.InputQueueCharacters.resize(0);
+            if (input_buf.Size > 0)
+            {
+                // Typing is merged in a single undo record while nothing else happens in between
+                const int sel_min = ImMin(doc->Cursor, doc->SelectStart);
+                const int sel_max = ImMax(doc->Cursor, doc->SelectStart);
+                const bool typing = (sel_min == sel_max);
+                doc->UndoMergeable = doc->UndoMergeable && typing;
+                doc->Replace(sel_min, sel_max - sel_min, input_buf.Data, input_buf.Size, is_undoable);
+                doc->Cursor = doc->SelectStart = sel_min + input_buf.Size;
+                doc->UndoMergeable = typing;
+                doc->PreferredX = -1.0f;
+                value_changed = true;
+            }
+        }
+
+        int move_to = -1;
+        int move_lines = 0;
+        if (IsKeyPressedMap(ImGuiKey_LeftArrow))
+            move_to = (doc->HasSelection() && !io.KeyShift) ? ImMin(doc->Cursor, doc->SelectStart) : InputTextLargeMoveChar(doc, doc->Cursor, -1);
+        else if (IsKeyPressedMap(ImGuiKey_RightArrow))
+            move_to = (doc->HasSelection() && !io.KeyShift) ? ImMax(doc->Cursor, doc->SelectStart) : InputTextLargeMoveChar(doc, doc->Cursor, +1);
+        else if (IsKeyPressedMap(ImGuiKey_UpArrow))
+            move_lines = -1;
+        else if (IsKeyPressedMap(ImGuiKey_DownArrow))
+            move_lines = +1;
+        else if (IsKeyPressedMap(ImGuiKey_PageUp))
+            move_lines = -page_lines;
+        else if (IsKeyPressedMap(ImGuiKey_PageDown))
+            move_lines = +page_lines;
+        else if (IsKeyPressedMap(ImGuiKey_Home))
+            move_to = io.KeyCtrl ? 0 : doc->GetLineStart(doc->GetLineFromOffset(doc->Cursor));
+        else if (IsKeyPressedMap(ImGuiKey_End))
+            move_to = io.KeyCtrl ? doc->Length : doc->GetLineEnd(doc->GetLineFromOffset(doc->Cursor));
+        if (move_lines != 0)
+        {
+            if (doc->PreferredX < 0.0f)
+                doc->PreferredX = InputTextLargeXFromOffset(doc, doc->Cursor);
+            const int line = ImClamp(doc->GetLineFromOffset(doc->Cursor) + move_lines, 0, line_count - 1);
+            const float preferred_x = doc->PreferredX;
+            doc->Cursor = InputTextLargeOffsetFromX(doc, line, preferred_x);
+            doc->PreferredX = preferred_x;
+            if (!io.KeyShift)
+                doc->SelectStart = doc->Cursor;
+        }
+        else if (move_to >= 0)
+        {
+            doc->Cursor = move_to;
+            doc->PreferredX = -1.0f;
+            if (!io.KeyShift)
+                doc->SelectStart = doc->Cursor;
+        }
+
+        // Editing
+        const int sel_min = ImMin(doc->Cursor, doc->SelectStart);
+        const int sel_max = ImMax(doc->Cursor, doc->SelectStart);
+        const char* insert_text = NULL;
+        int insert_len = 0;
+        int remove_min = sel_min, remove_max = sel_max;
+        bool edit = false;
+        if (is_shortcut_key && IsKeyPressedMap(ImGuiKey_A))
+        {
+            doc->SelectStart = 0;
+            doc->Cursor = doc->Length;
+        }
+        else if (is_shortcut_key && (IsKeyPressedMap(ImGuiKey_C) || IsKeyPressedMap(ImGuiKey_X)) && doc->HasSelection())
+        {
+            doc->CopyRange(sel_min, sel_max - sel_min, &doc->LineBuf);
+            SetClipboardText(doc->LineBuf.Data);
+            edit = !is_readonly && IsKeyPressedMap(ImGuiKey_X);
+        }
+        else if (is_shortcut_key && IsKeyPressedMap(ImGuiKey_V) && !is_readonly)
+        {
+            if (const char* clipboard = GetClipboardText())
+            {
+                insert_text = clipboard;
+                insert_len = (int)strlen(clipboard);
+                edit = true;
+            }
+        }
+        else if (is_shortcut_key && IsKeyPressedMap(ImGuiKey_Z) && !is_readonly && is_undoable)
+        {
+            value_changed |= doc->Undo();
+        }
+        else if (is_shortcut_key && IsKeyPressedMap(ImGuiKey_Y) && !is_readonly && is_undoable)
+        {
+            value_changed |= doc->Redo();
+        }
+        else if (IsKeyPressedMap(ImGuiKey_Backspace) && !is_readonly)
+        {
+            if (!doc->HasSelection())
+                remove_min = InputTextLargeMoveChar(doc, doc->Cursor, -1);
+            edit = true;
+        }
+        else if (IsKeyPressedMap(ImGuiKey_Delete) && !is_readonly)
+        {
+            if (!doc->HasSelection())
+                remove_max = InputTextLargeMoveChar(doc, doc->Cursor, +1);
+            edit = true;
+        }
+        else if ((IsKeyPressedMap(ImGuiKey_Enter) || IsKeyPressedMap(ImGuiKey_KeyPadEnter)) && !is_readonly)
+        {
+            insert_text = "\n";
+            insert_len = 1;
+            edit = true;
+        }
+        else if (IsKeyPressedMap(ImGuiKey_Escape))
+        {
+            ClearActiveID();
+        }
+
+        if (edit && (remove_max > remove_min || insert_len > 0))
+        {
+            doc->UndoMergeable = false;
+            doc->Replace(remove_min, remove_max - remove_min, insert_text, insert_len, is_undoable);
+            doc->Cursor = doc->SelectStart = remove_min + insert_len;
+            doc->PreferredX = -1.0f;
+            value_changed = true;
+        }
+    }
+
+    // Keep cursor visible after it moved
+    const int cursor_line = doc->GetLineFromOffset(doc->Cursor);
+    if (g.ActiveId == id && (doc->Cursor != cursor_before || value_changed))
+    {
+        doc->CursorAnim = -0.30f;
+        if (!value_changed)
+            doc->UndoMergeable = false;
+        const float cursor_y = cursor_line * line_height;
+        const float visible_h = inner_rect.GetHeight() - style.FramePadding.y * 2.0f;
+        if (cursor_y < draw_window->Scroll.y)
+            SetScrollY(draw_window, cursor_y);
+        else if (cursor_y + line_height > draw_window->Scroll.y + visible_h)
+            SetScrollY(draw_window, cursor_y + line_height - visible_h);
+        const float cursor_x = InputTextLargeXFromOffset(doc, doc->Cursor);
+        const float visible_w = inner_rect.GetWidth() - style.FramePadding.x * 2.0f;
+        if (cursor_x < draw_window->Scroll.x)
+            SetScrollX(draw_window, ImMax(cursor_x - visible_w * 0.25f, 0.0f));
+        else if (cursor_x > draw_window->Scroll.x + visible_w)
+            SetScrollX(draw_window, cursor_x - visible_w * 0.75f);
+    }
+
+    // Render visible lines only
+    const int line_count = doc->GetLineCount();
+    const int line_first = ImClamp((int)((inner_rect.Min.y - text_pos.y) / line_height), 0, line_count);
+    const int line_last = ImClamp((int)((inner_rect.Max.y - text_pos.y) / line_height) + 1, line_first, line_count);
+    const int sel_min = ImMin(doc->Cursor, doc->SelectStart);
+    const int sel_max = ImMax(doc->Cursor, doc->SelectStart);
+    const ImU32 text_col = GetColorU32(ImGuiCol_Text);
+    const ImU32 sel_col = GetColorU32(ImGuiCol_TextSelectedBg);
+    const ImVec4 clip_rect = draw_window->ClipRect.ToVec4();
+    ImDrawList* draw_list = draw_window->DrawList;
+    for (int line = line_first; line < line_last; line++)
+    {
+        const int line_start = doc->GetLineStart(line);
+        const int line_end = doc->GetLineEnd(line);
+        doc->CopyRange(line_start, line_end - line_start, &doc->LineBuf);
+        const char* text = doc->LineBuf.Data;
+        const char* text_end = text + (line_end - line_start);
+        const ImVec2 line_pos(text_pos.x, text_pos.y + line * line_height);
+        const float line_w = CalcTextSize(text, text_end).x;
+        doc->WidestLine = ImMax(doc->WidestLine, line_w);
+        if (sel_min < sel_max && sel_min <= line_end && sel_max > line_start)
+        {
+            const float x0 = (sel_min > line_start) ? CalcTextSize(text, text + (sel_min - line_start)).x : 0.0f;
+            float x1 = (sel_max <= line_end) ? CalcTextSize(text, text + (sel_max - line_start)).x : line_w;
+            if (sel_max > line_end)
+                x1 += IM_FLOOR(g.Font->GetCharAdvance((ImWchar)' ') * 0.50f); // So we can see selected line breaks
+            draw_list->AddRectFilled(line_pos + ImVec2(x0, 0.0f), line_pos + ImVec2(x1, line_height), sel_col);
+        }
+        draw_list->AddText(g.Font, g.FontSize, line_pos, text_col, text, text_end, 0.0f, &clip_rect);
+    }
+
+    // Draw blinking cursor
+    if (g.ActiveId == id)
+    {
+        doc->CursorAnim += io.DeltaTime;
+        const bool cursor_is_visible = (!io.ConfigInputTextCursorBlink) || (doc->CursorAnim <= 0.0f) || ImFmod(doc->CursorAnim, 1.20f) <= 0.80f;
+        const ImVec2 cursor_pos = ImFloor(ImVec2(text_pos.x + InputTextLargeXFromOffset(doc, doc->Cursor), text_pos.y + cursor_line * line_height));
+        if (cursor_is_visible)
+            draw_list->AddLine(cursor_pos + ImVec2(0.0f, 0.5f), cursor_pos + ImVec2(0.0f, line_height - 1.5f), text_col);
+        if (!is_readonly)
+        {
+            g.PlatformImeData.WantVisible = true;
+            g.PlatformImeData.InputPos = ImVec2(cursor_pos.x - 1.0f, cursor_pos.y);
+            g.PlatformImeData.InputLineHeight = line_height;
+            g.PlatformImeViewport = window->Viewport->ID;
+        }
+    }
+
+    // Declare contents size for scrolling
+    Dummy(ImVec2(doc->WidestLine + style.FramePadding.x * 2.0f, line_count * line_height + style.FramePadding.y * 2.0f));
+    EndChild();
+
+    if (label_size.x > 0)
+        RenderText(ImVec2(frame_bb.Max.x + style.ItemInnerSpacing.x, frame_bb.Min.y + style.FramePadding.y), label);
+    EndGroup();
+
+    if (value_changed)
+        MarkItemEdited(id);
+    return value_changed;
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Widgets: ColorEdit, ColorPicker, ColorButton, etc.
 //-------------------------------------------------------------------------
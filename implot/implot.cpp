@@ -112,6 +112,11 @@ You can read releases logs https://github.com/epezent/implot/releases for more d
 #include "implot_internal.h"
 
 #include <stdlib.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 
 #ifdef _MSC_VER
 #define sprintf sprintf_s
@@ -127,6 +132,23 @@ You can read releases logs https://github.com/epezent/implot/releases for more d
 ImPlotContext* GImPlot = NULL;
 #endif
 
+// Worker pool running RunJobs. The calling thread takes jobs too, threads count - 1 workers are spawned.
+struct ImPlotWorkerPool {
+    ImVector<std::thread*>  Workers;
+    std::mutex              Mutex;
+    std::condition_variable WakeCond;
+    std::condition_variable DoneCond;
+    unsigned int            Generation;
+    int                     BusyWorkers;
+    bool                    Quit;
+    ImPlotJobFunc           JobFunc;
+    void*                   JobUserData;
+    int                     JobsCount;
+    std::atomic<int>        NextJob;
+
+    ImPlotWorkerPool() : Generation(0), BusyWorkers(0), Quit(false), JobFunc(NULL), JobUserData(NULL), JobsCount(0), NextJob(0) { }
+};
+
 //-----------------------------------------------------------------------------
 // Struct Implementations
 //-----------------------------------------------------------------------------
@@ -393,6 +415,209 @@ void SetImGuiContext(ImGuiContext* ctx) {
     ImGui::SetCurrentContext(ctx);
 }
 
+static void RunPoolJobs(ImPlotWorkerPool* pool) {
+    for (int job = pool->NextJob.fetch_add(1); job < pool->JobsCount; job = pool->NextJob.fetch_add(1))
+        pool->JobFunc(pool->JobUserData, job);
+}
+
+static void WorkerMain(ImPlotWorkerPool* pool) {
+    unsigned int generation = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(pool->Mutex);
+            while (!pool->Quit && pool->Generation == generation)
+                pool->WakeCond.wait(lock);
+            if (pool->Quit)
+                return;
+            generation = pool->Generation;
+        }
+        RunPoolJobs(pool);
+        std::lock_guard<std::mutex> lock(pool->Mutex);
+        if (--pool->BusyWorkers == 0)
+            pool->DoneCond.notify_one();
+    }
+}
+
+static void StopWorkers(ImPlotWorkerPool* pool) {
+    {
+        std::lock_guard<std::mutex> lock(pool->Mutex);
+        pool->Quit = true;
+    }
+    pool->WakeCond.notify_all();
+    for (int i = 0; i < pool->Workers.Size; ++i) {
+        pool->Workers[i]->join();
+        IM_DELETE(pool->Workers[i]);
+    }
+    pool->Workers.clear();
+    pool->Quit = false;
+    pool->Generation = 0;
+}
+
+void RunJobs(int jobs_count, ImPlotJobFunc func, void* user_data) {
+    ImPlotWorkerPool* pool = GImPlot->Workers;
+    if (pool == NULL || pool->Workers.Size == 0 || jobs_count <= 1) {
+        for (int job = 0; job < jobs_count; ++job)
+            func(user_data, job);
+        return;
+    }
+    pool->JobFunc     = func;
+    pool->JobUserData = user_data;
+    pool->JobsCount   = jobs_count;
+    pool->NextJob     = 0;
+    {
+        std::lock_guard<std::mutex> lock(pool->Mutex);
+        pool->BusyWorkers = pool->Workers.Size;
+        pool->Generation++;
+    }
+    pool->WakeCond.notify_all();
+    RunPoolJobs(pool);
+    std::unique_lock<std::mutex> lock(pool->Mutex);
+    while (pool->BusyWorkers > 0)
+        pool->DoneCond.wait(lock);
+}
+
+void SetThreadsCount(int threads_count) {
+    ImPlotContext& gp = *GImPlot;
+    if (threads_count <= 0)
+        threads_count = (int)std::thread::hardware_concurrency();
+    if (threads_count <= 0)
+        threads_count = 1;
+    if (threads_count == GetThreadsCount())
+        return;
+    if (gp.Workers == NULL)
+        gp.Workers = IM_NEW(ImPlotWorkerPool)();
+    StopWorkers(gp.Workers);
+    for (int i = 0; i < threads_count - 1; ++i)
+        gp.Workers->Workers.push_back(IM_NEW(std::thread)(WorkerMain, gp.Workers));
+}
+
+int GetThreadsCount() {
+    return GImPlot->Workers ? GImPlot->Workers->Workers.Size + 1 : 1;
+}
+
+//-----------------------------------------------------------------------------
+// Stats
+//-----------------------------------------------------------------------------
+
+double GetStatsTime() {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+ImPlotStatsMark GetStatsMark(const ImDrawList* draw_list) {
+    ImPlotStatsMark mark;
+    mark.Time     = GetStatsTime();
+    mark.VtxCount = draw_list->VtxBuffer.Size;
+    mark.IdxCount = draw_list->IdxBuffer.Size;
+    mark.CmdCount = draw_list->CmdBuffer.Size;
+    return mark;
+}
+
+void AddStatsSince(ImPlotStats& stats, const ImPlotStatsMark& mark, const ImDrawList* draw_list) {
+    stats.Vertices  += draw_list->VtxBuffer.Size - mark.VtxCount;
+    stats.Indices   += draw_list->IdxBuffer.Size - mark.IdxCount;
+    stats.DrawCmds  += draw_list->CmdBuffer.Size - mark.CmdCount;
+    stats.TotalTime += GetStatsTime() - mark.Time;
+}
+
+void SetStatsEnabled(bool enabled, bool overlay) {
+    ImPlotContext& gp = *GImPlot;
+    gp.StatsEnabled = enabled;
+    gp.StatsOverlay = enabled && overlay;
+}
+
+bool GetStatsEnabled() {
+    return GImPlot->StatsEnabled;
+}
+
+const ImPlotStats* GetPlotStats(const char* plot_title_id) {
+    ImPlotContext& gp = *GImPlot;
+    ImPlotPlot* plot = gp.Plots.GetByKey(ImGui::GetCurrentWindow()->GetID(plot_title_id));
+    return plot != NULL ? &plot->Stats : NULL;
+}
+
+const ImPlotStats* GetLastItemStats() {
+    ImPlotContext& gp = *GImPlot;
+    return gp.PreviousItem != NULL ? &gp.PreviousItem->Stats : NULL;
+}
+
+static void AppendStatsCSV(ImGuiTextBuffer& buf, const char* plot_name, const char* item_name, const ImPlotStats& stats) {
+    buf.appendf("%d,", stats.Frame);
+    const char* names[2] = { plot_name, item_name };
+    for (int n = 0; n < 2; ++n) {
+        buf.append("\"");
+        for (const char* c = names[n]; *c; ++c) {
+            if (*c == '"')
+                buf.append("\"\"");
+            else
+                buf.append(c, c + 1);
+        }
+        buf.append("\",");
+    }
+    buf.appendf("%d,%d,%d,%d,%d,%d,%.4f,%.4f,%.4f,%.4f\n", stats.Points, stats.PrimsEmitted, stats.PrimsCulled,
+                stats.Vertices, stats.Indices, stats.DrawCmds, stats.FitTime, stats.TessTime, stats.TickTime, stats.TotalTime);
+}
+
+static void AppendItemStatsCSV(ImGuiTextBuffer& buf, const char* plot_name, ImPlotItemGroup& items) {
+    for (int i = 0; i < items.GetItemCount(); ++i) {
+        ImPlotItem* item = items.GetItemByIndex(i);
+        // labels are rebuilt every frame, so only those of the items in the group's last frame are valid
+        const bool has_label = item->NameOffset >= 0 && item->NameOffset < items.Legend.Labels.size();
+        AppendStatsCSV(buf, plot_name, has_label ? items.Legend.Labels.Buf.Data + item->NameOffset : "", item->Stats);
+    }
+}
+
+const char* SaveStatsToMemory(size_t* out_size) {
+    ImPlotContext& gp = *GImPlot;
+    ImGuiTextBuffer& buf = gp.StatsCSV;
+    buf.Buf.shrink(0);
+    buf.append("frame,plot,item,points,prims_emitted,prims_culled,vertices,indices,draw_cmds,fit_ms,tessellation_ms,tick_ms,total_ms\n");
+    for (int p = 0; p < gp.Plots.GetBufSize(); ++p) {
+        ImPlotPlot* plot = gp.Plots.GetByIndex(p);
+        const char* plot_name = plot->TitleOffset != -1 ? plot->GetTitle() : "";
+        AppendStatsCSV(buf, plot_name, "", plot->Stats);
+        AppendItemStatsCSV(buf, plot_name, plot->Items);
+    }
+    // items of subplots that share their legend are held by the subplot
+    for (int p = 0; p < gp.Subplots.GetBufSize(); ++p) {
+        ImPlotSubplot* subplot = gp.Subplots.GetByIndex(p);
+        char subplot_name[32];
+        ImFormatString(subplot_name, sizeof(subplot_name), "subplot %08X", subplot->ID);
+        AppendItemStatsCSV(buf, subplot_name, subplot->Items);
+    }
+    if (out_size != NULL)
+        *out_size = (size_t)buf.size();
+    return buf.c_str();
+}
+
+bool SaveStatsToDisk(const char* filename) {
+    size_t size = 0;
+    const char* csv = SaveStatsToMemory(&size);
+    ImFileHandle f = ImFileOpen(filename, "wt");
+    if (f == NULL)
+        return false;
+    const bool ok = ImFileWrite(csv, sizeof(char), size, f) == size;
+    ImFileClose(f);
+    return ok;
+}
+
+static void RenderStatsOverlay(const ImPlotPlot& plot, ImDrawList& draw_list) {
+    const ImPlotStats& st = plot.Stats;
+    char buff[256];
+    ImFormatString(buff, sizeof(buff), "%d points, %d prims (%d culled)\n%d vtx, %d idx, %d cmds\n"
+                   "fit %.2f ms, tess %.2f ms, ticks %.2f ms\ntotal %.2f ms",
+                   st.Points, st.PrimsEmitted, st.PrimsCulled, st.Vertices, st.Indices, st.DrawCmds,
+                   st.FitTime, st.TessTime, st.TickTime, st.TotalTime);
+    const ImVec2 pad = GImPlot->Style.LegendInnerPadding;
+    const ImVec2 text_size = ImGui::CalcTextSize(buff);
+    const ImVec2 size(text_size.x + pad.x * 2, text_size.y + pad.y * 2);
+    const ImVec2 pos = GetLocationPos(plot.PlotRect, size, ImPlotLocation_SouthWest, GImPlot->Style.MousePosPadding);
+    draw_list.PushClipRect(plot.PlotRect.Min, plot.PlotRect.Max, true);
+    draw_list.AddRectFilled(pos, pos + size, GetStyleColorU32(ImPlotCol_LegendBg));
+    draw_list.AddRect(pos, pos + size, GetStyleColorU32(ImPlotCol_LegendBorder));
+    draw_list.AddText(pos + pad, GetStyleColorU32(ImPlotCol_InlayText), buff);
+    draw_list.PopClipRect();
+}
+
 ImPlotContext* CreateContext() {
     ImPlotContext* ctx = IM_NEW(ImPlotContext)();
     Initialize(ctx);
@@ -406,6 +631,12 @@ void DestroyContext(ImPlotContext* ctx) {
         ctx = GImPlot;
     if (GImPlot == ctx)
         SetCurrentContext(NULL);
+    if (ctx->Workers != NULL) {
+        StopWorkers(ctx->Workers);
+        IM_DELETE(ctx->Workers);
+    }
+    for (int i = 0; i < ctx->JobDrawLists.Size; ++i)
+        IM_DELETE(ctx->JobDrawLists[i]);
     IM_DELETE(ctx);
 }
 
@@ -425,6 +656,10 @@ void Initialize(ImPlotContext* ctx) {
     ResetCtxForNextAlignedPlots(ctx);
     ResetCtxForNextSubplot(ctx);
 
+    ctx->TimeZoneSpanIdx = 0;
+    ctx->Workers = NULL;
+    ctx->StatsEnabled = ctx->StatsOverlay = false;
+
     const ImU32 Deep[]     = {4289753676, 4283598045, 4285048917, 4283584196, 4289950337, 4284512403, 4291005402, 4287401100, 4285839820, 4291671396                        };
     const ImU32 Dark[]     = {4280031972, 4290281015, 4283084621, 4288892568, 4278222847, 4281597951, 4280833702, 4290740727, 4288256409                                    };
     const ImU32 Pastel[]   = {4289639675, 4293119411, 4291161036, 4293184478, 4289124862, 4291624959, 4290631909, 4293712637, 4294111986                                    };
@@ -536,34 +771,80 @@ ImVec2 GetLocationPos(const ImRect& outer_rect, const ImVec2& inner_size, ImPlot
     return pos;
 }
 
+static ImPlotItemGroup* GSortItems = NULL;
+
+static int IMGUI_CDECL LegendSortingComp(const void* _a, const void* _b) {
+    const int a = *(const int*)_a;
+    const int b = *(const int*)_b;
+    const char* label_a = GSortItems->GetLegendLabel(a);
+    const char* label_b = GSortItems->GetLegendLabel(b);
+    const int cmp = strcmp(label_a,label_b);
+    return cmp != 0 ? cmp : a - b;
+}
+
+void UpdateLegendLayout(ImPlotItemGroup& items, const ImVec2& spacing, bool vertical) {
+    ImPlotLegend& legend = items.Legend;
+    const int   nItems   = items.GetLegendCount();
+    const bool  sort     = ImHasFlag(legend.Flags, ImPlotLegendFlags_Sort);
+    const float txt_ht   = ImGui::GetTextLineHeight();
+    const ImFont* font   = ImGui::GetFont();
+    // the labels buffer holds the legend labels in submission order, so it and the item indices identify the entries
+    const float layout[] = { txt_ht, spacing.x, spacing.y, vertical ? 1.0f : 0.0f, sort ? 1.0f : 0.0f };
+    ImGuiID key = ImHashData(layout, sizeof(layout), 0);
+    key = ImHashData(&font, sizeof(font), key);
+    key = ImHashData(legend.Indices.Data, legend.Indices.size_in_bytes(), key);
+    key = ImHashData(legend.Labels.Buf.Data, legend.Labels.Buf.Size, key);
+    if (key == legend.LayoutKey && legend.Order.Size == nItems)
+        return;
+    legend.LayoutKey = key;
+    legend.Order.resize(nItems);
+    for (int i = 0; i < nItems; ++i)
+        legend.Order[i] = i;
+    if (sort && nItems > 1) {
+        GSortItems = &items;
+        ImQsort(legend.Order.Data, nItems, sizeof(int), LegendSortingComp);
+        GSortItems = NULL;
+    }
+    legend.Widths.resize(nItems);
+    legend.Offsets.resize(nItems + 1);
+    legend.MaxLabelWidth = 0;
+    float offset = 0;
+    for (int i = 0; i < nItems; ++i) {
+        const float label_width = ImGui::CalcTextSize(items.GetLegendLabel(legend.Order[i]), NULL, true).x;
+        legend.Widths[i]        = label_width;
+        legend.Offsets[i]       = offset;
+        legend.MaxLabelWidth    = label_width > legend.MaxLabelWidth ? label_width : legend.MaxLabelWidth;
+        offset                 += vertical ? txt_ht + spacing.y : txt_ht + label_width + spacing.x;
+    }
+    legend.Offsets[nItems] = offset;
+}
+
 ImVec2 CalcLegendSize(ImPlotItemGroup& items, const ImVec2& pad, const ImVec2& spacing, bool vertical) {
     // vars
     const int   nItems      = items.GetLegendCount();
     const float txt_ht      = ImGui::GetTextLineHeight();
     const float icon_size   = txt_ht;
-    // get label max width
-    float max_label_width = 0;
-    float sum_label_width = 0;
-    for (int i = 0; i < nItems; ++i) {
-        const char* label       = items.GetLegendLabel(i);
-        const float label_width = ImGui::CalcTextSize(label, NULL, true).x;
-        max_label_width         = label_width > max_label_width ? label_width : max_label_width;
-        sum_label_width        += label_width;
-    }
+    // entry extent and max label width come from the cached layout
+    UpdateLegendLayout(items, spacing, vertical);
+    const ImPlotLegend& legend = items.Legend;
     // calc legend size
     const ImVec2 legend_size = vertical ?
-                               ImVec2(pad.x * 2 + icon_size + max_label_width, pad.y * 2 + nItems * txt_ht + (nItems - 1) * spacing.y) :
-                               ImVec2(pad.x * 2 + icon_size * nItems + sum_label_width + (nItems - 1) * spacing.x, pad.y * 2 + txt_ht);
+                               ImVec2(pad.x * 2 + icon_size + legend.MaxLabelWidth, pad.y * 2 + legend.Offsets[nItems] - spacing.y) :
+                               ImVec2(pad.x * 2 + legend.Offsets[nItems] - spacing.x, pad.y * 2 + txt_ht);
     return legend_size;
 }
 
-int LegendSortingComp(void* _items, const void* _a, const void* _b) {
-    ImPlotItemGroup* items = (ImPlotItemGroup*)_items;
-    const int a = *(const int*)_a;
-    const int b = *(const int*)_b;
-    const char* label_a = items->GetLegendLabel(a);
-    const char* label_b = items->GetLegendLabel(b);
-    return strcmp(label_a,label_b);
+// Index of the legend entry whose span along the legend direction contains #pos (binary search of the cached offsets)
+static int GetLegendEntryAt(const ImPlotLegend& legend, float pos) {
+    int lo = 0, hi = legend.Order.Size - 1;
+    while (lo < hi) {
+        const int mid = (lo + hi + 1) / 2;
+        if (legend.Offsets[mid] <= pos)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+    return lo;
 }
 
 bool ShowLegendEntries(ImPlotItemGroup& items, const ImRect& legend_bb, bool hovered, const ImVec2& pad, const ImVec2& spacing, bool vertical, ImDrawList& DrawList) {
@@ -573,32 +854,45 @@ bool ShowLegendEntries(ImPlotItemGroup& items, const ImRect& legend_bb, bool hov
     const float icon_shrink = 2;
     ImU32 col_txt           = GetStyleColorU32(ImPlotCol_LegendText);
     ImU32  col_txt_dis      = ImAlphaU32(col_txt, 0.25f);
-    // render each legend item
-    float sum_label_width = 0;
     bool any_item_hovered = false;
 
     const int num_items = items.GetLegendCount();
     if (num_items < 1)
         return hovered;
-    // ImVector<int>& indices = GImPlot->TempInt1;
-    // indices.resize(num_items);
-    // // bool sort = true;
-    // // if (sort && num_items > 1) {
-    // //     qsort_s(indices.Data, num_items, sizeof(int), LegendSortingComp, &items);
-    // // }
-    // // else {
-    // //     for (int i = 0; i < num_items; ++i)
-    // //         indices[i] = i;
-    // // }
-    for (int i = 0; i < num_items; ++i) {
-        const int idx           = i; //indices[i];
+    UpdateLegendLayout(items, spacing, vertical);
+    ImPlotLegend& legend = items.Legend;
+    const ImGuiIO& IO = ImGui::GetIO();
+
+    // scroll the entries that do not fit in the legend, with the mouse wheel
+    const float content    = legend.Offsets[num_items] - (vertical ? spacing.y : spacing.x);
+    const float visible    = vertical ? legend_bb.GetHeight() - pad.y * 2 : legend_bb.GetWidth() - pad.x * 2;
+    const float max_scroll = ImMax(0.0f, content - visible);
+    legend.Scrollable = max_scroll > 0;
+    if (hovered && legend.Scrollable) {
+        const float wheel = vertical || IO.MouseWheelH == 0 ? IO.MouseWheel : IO.MouseWheelH;
+        legend.Scroll -= wheel * 5 * txt_ht;
+    }
+    legend.Scroll = ImFloor(ImClamp(legend.Scroll, 0.0f, max_scroll));
+    if (legend.Scrollable)
+        DrawList.PushClipRect(legend_bb.Min, legend_bb.Max, true);
+
+    // only the entries in view are rendered, and only the one under the mouse (or held) gets button behavior
+    const int first = GetLegendEntryAt(legend, legend.Scroll);
+    const int last  = GetLegendEntryAt(legend, legend.Scroll + ImMax(0.0f, visible));
+    const ImVec2 origin = legend_bb.Min + pad - (vertical ? ImVec2(0, legend.Scroll) : ImVec2(legend.Scroll, 0));
+    const int hovered_entry = legend_bb.Contains(IO.MousePos)
+                            ? GetLegendEntryAt(legend, vertical ? IO.MousePos.y - origin.y : IO.MousePos.x - origin.x)
+                            : -1;
+    const ImGuiID active_id = ImGui::GetActiveID();
+
+    for (int i = first; i <= last; ++i) {
+        const int idx           = legend.Order[i];
         ImPlotItem* item        = items.GetLegendItem(idx);
         const char* label       = items.GetLegendLabel(idx);
-        const float label_width = ImGui::CalcTextSize(label, NULL, true).x;
+        const float label_width = legend.Widths[i];
         const ImVec2 top_left   = vertical ?
-                                  legend_bb.Min + pad + ImVec2(0, i * (txt_ht + spacing.y)) :
-                                  legend_bb.Min + pad + ImVec2(i * (icon_size + spacing.x) + sum_label_width, 0);
-        sum_label_width        += label_width;
+                                  origin + ImVec2(0, legend.Offsets[i]) :
+                                  origin + ImVec2(legend.Offsets[i], 0);
         ImRect icon_bb;
         icon_bb.Min = top_left + ImVec2(icon_shrink,icon_shrink);
         icon_bb.Max = top_left + ImVec2(icon_size - icon_shrink, icon_size - icon_shrink);
@@ -613,7 +907,7 @@ bool ShowLegendEntries(ImPlotItemGroup& items, const ImRect& legend_bb, bool hov
 
         bool item_hov = false;
         bool item_hld = false;
-        bool item_clk = ImHasFlag(items.Legend.Flags, ImPlotLegendFlags_NoButtons)
+        bool item_clk = ImHasFlag(items.Legend.Flags, ImPlotLegendFlags_NoButtons) || (i != hovered_entry && item->ID != active_id)
                       ? false
                       : ImGui::ButtonBehavior(button_bb, item->ID, &item_hov, &item_hld);
 
@@ -648,6 +942,8 @@ bool ShowLegendEntries(ImPlotItemGroup& items, const ImRect& legend_bb, bool hov
         if (label != text_display_end)
             DrawList.AddText(top_left + ImVec2(icon_size, 0), item->Show ? col_txt_hl  : col_txt_dis, label, text_display_end);
     }
+    if (legend.Scrollable)
+        DrawList.PopClipRect();
     return hovered && !any_item_hovered;
 }
 
@@ -808,13 +1104,65 @@ inline int GetTimeStep(int max_divs, ImPlotTimeUnit unit) {
     return 0;
 }
 
+// Proleptic Gregorian days since 1970-01-01 for month 1..12, H. Hinnant's days_from_civil (as in utils/date.h)
+static inline ImS64 DaysFromCivil(ImS64 y, int m, int d) {
+    y -= m <= 2;
+    const ImS64 era = (y >= 0 ? y : y - 399) / 400;
+    const int   yoe = (int)(y - era * 400);                               // [0, 399]
+    const int   doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1;    // [0, 365]
+    const int   doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;              // [0, 146096]
+    return era * 146097 + doe - 719468;
+}
+
+// Inverse of DaysFromCivil, H. Hinnant's civil_from_days
+static inline void CivilFromDays(ImS64 z, int* y, int* m, int* d) {
+    z += 719468;
+    const ImS64 era = (z >= 0 ? z : z - 146096) / 146097;
+    const int   doe = (int)(z - era * 146097);                            // [0, 146096]
+    const int   yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365; // [0, 399]
+    const int   doy = doe - (365 * yoe + yoe / 4 - yoe / 100);            // [0, 365]
+    const int   mp  = (5 * doy + 2) / 153;                                // [0, 11]
+    *d = doy - (153 * mp + 2) / 5 + 1;
+    *m = mp < 10 ? mp + 3 : mp - 9;
+    *y = (int)(yoe + era * 400 + (*m <= 2));
+}
+
+// Seconds since the epoch of broken down time, out of range fields normalized like timegm (months carry into years)
+static ImS64 TmToSeconds(const tm* ptm) {
+    ImS64 y = (ImS64)ptm->tm_year + 1900;
+    int mon = ptm->tm_mon % 12;
+    y += ptm->tm_mon / 12;
+    if (mon < 0) {
+        mon += 12;
+        y--;
+    }
+    const ImS64 days = DaysFromCivil(y, mon + 1, 1) + ptm->tm_mday - 1;
+    return days * 86400 + (ImS64)ptm->tm_hour * 3600 + (ImS64)ptm->tm_min * 60 + ptm->tm_sec;
+}
+
+static void SecondsToTm(ImS64 s, tm* ptm) {
+    ImS64 days = s / 86400;
+    int   secs = (int)(s - days * 86400);
+    if (secs < 0) {
+        secs += 86400;
+        days--;
+    }
+    int y, m, d;
+    CivilFromDays(days, &y, &m, &d);
+    ptm->tm_year  = y - 1900;
+    ptm->tm_mon   = m - 1;
+    ptm->tm_mday  = d;
+    ptm->tm_hour  = secs / 3600;
+    ptm->tm_min   = secs / 60 % 60;
+    ptm->tm_sec   = secs % 60;
+    ptm->tm_wday  = (int)((days % 7 + 11) % 7); // 1970-01-01 was a Thursday
+    ptm->tm_yday  = (int)(days - DaysFromCivil(y, 1, 1));
+    ptm->tm_isdst = 0;
+}
+
 ImPlotTime MkGmtTime(struct tm *ptm) {
     ImPlotTime t;
-#ifdef _WIN32
-    t.S = _mkgmtime(ptm);
-#else
-    t.S = timegm(ptm);
-#endif
+    t.S = (time_t)TmToSeconds(ptm);
     if (t.S < 0)
         t.S = 0;
     return t;
@@ -822,33 +1170,106 @@ ImPlotTime MkGmtTime(struct tm *ptm) {
 
 tm* GetGmtTime(const ImPlotTime& t, tm* ptm)
 {
-#ifdef _WIN32
-  if (gmtime_s(ptm, &t.S) == 0)
+    SecondsToTm(t.S, ptm);
     return ptm;
-  else
-    return NULL;
+}
+
+// UTC offset at t from libc, the only place local time goes through the (locked) libc time zone code
+static ImPlotTimeZoneSpan GetTimeZoneLibc(time_t t) {
+    ImPlotTimeZoneSpan span;
+    tm Tm;
+#ifdef _WIN32
+    bool ok = localtime_s(&Tm, &t) == 0;
 #else
-  return gmtime_r(&t.S, ptm);
+    bool ok = localtime_r(&t, &Tm) != NULL;
 #endif
+    span.Start  = span.End = t;
+    span.Offset = ok ? (int)(TmToSeconds(&Tm) - t) : 0;
+    span.Dst    = ok && Tm.tm_isdst > 0;
+    return span;
+}
+
+// Local time zone span containing t. Spans are built a year at a time: monthly samples, then the transition
+// second found by bisection between samples that differ (assumes at most one transition per month)
+static const ImPlotTimeZoneSpan& GetTimeZoneSpan(time_t t) {
+    ImPlotContext& gp = *GImPlot;
+    ImVector<ImPlotTimeZoneSpan>& spans = gp.TimeZoneSpans;
+    if (gp.TimeZoneSpanIdx < spans.Size && spans[gp.TimeZoneSpanIdx].Start <= t && t < spans[gp.TimeZoneSpanIdx].End)
+        return spans[gp.TimeZoneSpanIdx];
+    int lo = 0, hi = spans.Size;
+    while (lo < hi) {
+        const int mid = (lo + hi) / 2;
+        if (spans[mid].End <= t)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    if (lo < spans.Size && spans[lo].Start <= t) {
+        gp.TimeZoneSpanIdx = lo;
+        return spans[lo];
+    }
+
+    // build the UTC year containing t
+    int y, m, d;
+    CivilFromDays((t >= 0 ? t : t - 86399) / 86400, &y, &m, &d);
+    ImPlotTimeZoneSpan year[24];
+    int count = 0;
+    ImPlotTimeZoneSpan prev = GetTimeZoneLibc((time_t)(DaysFromCivil(y, 1, 1) * 86400));
+    year[count++] = prev;
+    for (int mo = 2; mo <= 13; mo++) {
+        const time_t sample = (time_t)(DaysFromCivil(mo == 13 ? y + 1 : y, mo == 13 ? 1 : mo, 1) * 86400);
+        ImPlotTimeZoneSpan next = GetTimeZoneLibc(sample);
+        if (next.Offset != prev.Offset || next.Dst != prev.Dst) {
+            time_t a = prev.Start, b = sample; // prev zone at a, next zone at b
+            while (b - a > 1) {
+                const time_t c = a + (b - a) / 2;
+                const ImPlotTimeZoneSpan mid = GetTimeZoneLibc(c);
+                if (mid.Offset == prev.Offset && mid.Dst == prev.Dst)
+                    a = c;
+                else
+                    b = c;
+            }
+            year[count - 1].End = b;
+            next.Start = b;
+            if (count < 24)
+                year[count++] = next;
+        }
+        year[count - 1].End = sample;
+        prev = next;
+        prev.Start = sample;
+    }
+
+    // insert sorted, years never overlap
+    int at = 0;
+    while (at < spans.Size && spans[at].Start < year[0].Start)
+        at++;
+    for (int i = 0; i < count; i++)
+        spans.insert(spans.Data + at + i, year[i]);
+    return GetTimeZoneSpan(t);
 }
 
 ImPlotTime MkLocTime(struct tm *ptm) {
+    // local seconds to UTC, the offset taken where the result lands (DST gaps resolve like mktime with tm_isdst = 0)
+    const ImS64 local = TmToSeconds(ptm);
+    const int offset = GetTimeZoneSpan((time_t)(local - GetTimeZoneSpan((time_t)local).Offset)).Offset;
     ImPlotTime t;
-    t.S = mktime(ptm);
+    t.S = (time_t)(local - offset);
     if (t.S < 0)
         t.S = 0;
     return t;
 }
 
 tm* GetLocTime(const ImPlotTime& t, tm* ptm) {
-#ifdef _WIN32
-  if (localtime_s(ptm, &t.S) == 0)
+    const ImPlotTimeZoneSpan& span = GetTimeZoneSpan(t.S);
+    SecondsToTm((ImS64)t.S + span.Offset, ptm);
+    ptm->tm_isdst = span.Dst ? 1 : 0;
     return ptm;
-  else
-    return NULL;
-#else
-    return localtime_r(&t.S, ptm);
-#endif
+}
+
+void BustTimeZoneCache() {
+    ImPlotContext& gp = *GImPlot;
+    gp.TimeZoneSpans.clear();
+    gp.TimeZoneSpanIdx = 0;
 }
 
 inline ImPlotTime MkTime(struct tm *ptm) {
@@ -974,6 +1395,27 @@ static const char* MONTH_NAMES[]  = {"January","February","March","April","May",
 static const char* WD_ABRVS[]     = {"Su","Mo","Tu","We","Th","Fr","Sa"};
 static const char* MONTH_ABRVS[]  = {"Jan","Feb","Mar","Apr","May","Jun","Jul","Aug","Sep","Oct","Nov","Dec"};
 
+// Allocation free label writer, output matches the printf formats it replaces ("%d", "%02d", "%03d", "%s")
+struct ImPlotTimeWriter {
+    char* Buf;
+    int   Size;
+    int   Len;
+    ImPlotTimeWriter(char* buf, int size) { Buf = buf; Size = size; Len = 0; }
+    ImPlotTimeWriter& Char(char c) { if (Len + 1 < Size) Buf[Len++] = c; return *this; }
+    ImPlotTimeWriter& Str(const char* str) { while (*str) Char(*str++); return *this; }
+    ImPlotTimeWriter& Int(int v, int width = 0) {
+        char digits[12];
+        int n = 0;
+        unsigned int u = v < 0 ? 0u - (unsigned int)v : (unsigned int)v;
+        do { digits[n++] = (char)('0' + u % 10); u /= 10; } while (u != 0);
+        if (v < 0) { Char('-'); width--; }
+        for (int i = n; i < width; i++) Char('0');
+        while (n > 0) Char(digits[--n]);
+        return *this;
+    }
+    int End() { if (Size > 0) Buf[Len] = 0; return Len; }
+};
+
 int FormatTime(const ImPlotTime& t, char* buffer, int size, ImPlotTimeFmt fmt, bool use_24_hr_clk) {
     tm& Tm = GImPlot->Tm;
     GetTime(t, &Tm);
@@ -981,17 +1423,18 @@ int FormatTime(const ImPlotTime& t, char* buffer, int size, ImPlotTimeFmt fmt, b
     const int ms   = t.Us / 1000;
     const int sec  = Tm.tm_sec;
     const int min  = Tm.tm_min;
+    ImPlotTimeWriter w(buffer, size);
     if (use_24_hr_clk) {
         const int hr   = Tm.tm_hour;
         switch(fmt) {
-            case ImPlotTimeFmt_Us:        return snprintf(buffer, size, ".%03d %03d", ms, us);
-            case ImPlotTimeFmt_SUs:       return snprintf(buffer, size, ":%02d.%03d %03d", sec, ms, us);
-            case ImPlotTimeFmt_SMs:       return snprintf(buffer, size, ":%02d.%03d", sec, ms);
-            case ImPlotTimeFmt_S:         return snprintf(buffer, size, ":%02d", sec);
-            case ImPlotTimeFmt_HrMinSMs:  return snprintf(buffer, size, "%02d:%02d:%02d.%03d", hr, min, sec, ms);
-            case ImPlotTimeFmt_HrMinS:    return snprintf(buffer, size, "%02d:%02d:%02d", hr, min, sec);
-            case ImPlotTimeFmt_HrMin:     return snprintf(buffer, size, "%02d:%02d", hr, min);
-            case ImPlotTimeFmt_Hr:        return snprintf(buffer, size, "%02d:00", hr);
+            case ImPlotTimeFmt_Us:        return w.Char('.').Int(ms,3).Char(' ').Int(us,3).End();
+            case ImPlotTimeFmt_SUs:       return w.Char(':').Int(sec,2).Char('.').Int(ms,3).Char(' ').Int(us,3).End();
+            case ImPlotTimeFmt_SMs:       return w.Char(':').Int(sec,2).Char('.').Int(ms,3).End();
+            case ImPlotTimeFmt_S:         return w.Char(':').Int(sec,2).End();
+            case ImPlotTimeFmt_HrMinSMs:  return w.Int(hr,2).Char(':').Int(min,2).Char(':').Int(sec,2).Char('.').Int(ms,3).End();
+            case ImPlotTimeFmt_HrMinS:    return w.Int(hr,2).Char(':').Int(min,2).Char(':').Int(sec,2).End();
+            case ImPlotTimeFmt_HrMin:     return w.Int(hr,2).Char(':').Int(min,2).End();
+            case ImPlotTimeFmt_Hr:        return w.Int(hr,2).Str(":00").End();
             default:                      return 0;
         }
     }
@@ -999,14 +1442,14 @@ int FormatTime(const ImPlotTime& t, char* buffer, int size, ImPlotTimeFmt fmt, b
         const char* ap = Tm.tm_hour < 12 ? "am" : "pm";
         const int hr   = (Tm.tm_hour == 0 || Tm.tm_hour == 12) ? 12 : Tm.tm_hour % 12;
         switch(fmt) {
-            case ImPlotTimeFmt_Us:        return snprintf(buffer, size, ".%03d %03d", ms, us);
-            case ImPlotTimeFmt_SUs:       return snprintf(buffer, size, ":%02d.%03d %03d", sec, ms, us);
-            case ImPlotTimeFmt_SMs:       return snprintf(buffer, size, ":%02d.%03d", sec, ms);
-            case ImPlotTimeFmt_S:         return snprintf(buffer, size, ":%02d", sec);
-            case ImPlotTimeFmt_HrMinSMs:  return snprintf(buffer, size, "%d:%02d:%02d.%03d%s", hr, min, sec, ms, ap);
-            case ImPlotTimeFmt_HrMinS:    return snprintf(buffer, size, "%d:%02d:%02d%s", hr, min, sec, ap);
-            case ImPlotTimeFmt_HrMin:     return snprintf(buffer, size, "%d:%02d%s", hr, min, ap);
-            case ImPlotTimeFmt_Hr:        return snprintf(buffer, size, "%d%s", hr, ap);
+            case ImPlotTimeFmt_Us:        return w.Char('.').Int(ms,3).Char(' ').Int(us,3).End();
+            case ImPlotTimeFmt_SUs:       return w.Char(':').Int(sec,2).Char('.').Int(ms,3).Char(' ').Int(us,3).End();
+            case ImPlotTimeFmt_SMs:       return w.Char(':').Int(sec,2).Char('.').Int(ms,3).End();
+            case ImPlotTimeFmt_S:         return w.Char(':').Int(sec,2).End();
+            case ImPlotTimeFmt_HrMinSMs:  return w.Int(hr).Char(':').Int(min,2).Char(':').Int(sec,2).Char('.').Int(ms,3).Str(ap).End();
+            case ImPlotTimeFmt_HrMinS:    return w.Int(hr).Char(':').Int(min,2).Char(':').Int(sec,2).Str(ap).End();
+            case ImPlotTimeFmt_HrMin:     return w.Int(hr).Char(':').Int(min,2).Str(ap).End();
+            case ImPlotTimeFmt_Hr:        return w.Int(hr).Str(ap).End();
             default:                      return 0;
         }
     }
@@ -1019,23 +1462,24 @@ int FormatDate(const ImPlotTime& t, char* buffer, int size, ImPlotDateFmt fmt, b
     const int mon  = Tm.tm_mon + 1;
     const int year = Tm.tm_year + 1900;
     const int yr   = year % 100;
+    ImPlotTimeWriter w(buffer, size);
     if (use_iso_8601) {
         switch (fmt) {
-            case ImPlotDateFmt_DayMo:   return snprintf(buffer, size, "--%02d-%02d", mon, day);
-            case ImPlotDateFmt_DayMoYr: return snprintf(buffer, size, "%d-%02d-%02d", year, mon, day);
-            case ImPlotDateFmt_MoYr:    return snprintf(buffer, size, "%d-%02d", year, mon);
-            case ImPlotDateFmt_Mo:      return snprintf(buffer, size, "--%02d", mon);
-            case ImPlotDateFmt_Yr:      return snprintf(buffer, size, "%d", year);
+            case ImPlotDateFmt_DayMo:   return w.Str("--").Int(mon,2).Char('-').Int(day,2).End();
+            case ImPlotDateFmt_DayMoYr: return w.Int(year).Char('-').Int(mon,2).Char('-').Int(day,2).End();
+            case ImPlotDateFmt_MoYr:    return w.Int(year).Char('-').Int(mon,2).End();
+            case ImPlotDateFmt_Mo:      return w.Str("--").Int(mon,2).End();
+            case ImPlotDateFmt_Yr:      return w.Int(year).End();
             default:                    return 0;
         }
     }
     else {
         switch (fmt) {
-            case ImPlotDateFmt_DayMo:   return snprintf(buffer, size, "%d/%d", mon, day);
-            case ImPlotDateFmt_DayMoYr: return snprintf(buffer, size, "%d/%d/%02d", mon, day, yr);
-            case ImPlotDateFmt_MoYr:    return snprintf(buffer, size, "%s %d", MONTH_ABRVS[Tm.tm_mon], year);
-            case ImPlotDateFmt_Mo:      return snprintf(buffer, size, "%s", MONTH_ABRVS[Tm.tm_mon]);
-            case ImPlotDateFmt_Yr:      return snprintf(buffer, size, "%d", year);
+            case ImPlotDateFmt_DayMo:   return w.Int(mon).Char('/').Int(day).End();
+            case ImPlotDateFmt_DayMoYr: return w.Int(mon).Char('/').Int(day).Char('/').Int(yr,2).End();
+            case ImPlotDateFmt_MoYr:    return w.Str(MONTH_ABRVS[Tm.tm_mon]).Char(' ').Int(year).End();
+            case ImPlotDateFmt_Mo:      return w.Str(MONTH_ABRVS[Tm.tm_mon]).End();
+            case ImPlotDateFmt_Yr:      return w.Int(year).End();
             default:                    return 0;
         }
     }
@@ -1143,7 +1587,7 @@ void AddTicksTime(const ImPlotRange& range, float plot_width, ImPlotTickCollecti
     // maximum allowable density of labels
     const float max_density = 0.5f;
     // book keeping
-    const char* last_major  = NULL;
+    int last_major          = -1; // text offset, the buffer may grow
     if (unit0 != ImPlotTimeUnit_Yr) {
         // pixels per major (level 1) division
         const float pix_per_major_div = plot_width / (float)(range.Size() / TimeUnitSpans[unit1]);
@@ -1170,11 +1614,10 @@ void AddTicksTime(const ImPlotRange& range, float plot_width, ImPlotTickCollecti
                 // major level 1 tick
                 ImPlotTick tick_maj(t1.ToDouble(),true,true);
                 tick_maj.Level = 1;
-                LabelTickTime(tick_maj,ticks.TextBuffer,t1, last_major == NULL ? fmtf : fmt1);
-                const char* this_major = ticks.TextBuffer.Buf.Data + tick_maj.TextOffset;
-                if (last_major && TimeLabelSame(last_major,this_major))
+                LabelTickTime(tick_maj,ticks.TextBuffer,t1, last_major == -1 ? fmtf : fmt1);
+                if (last_major != -1 && TimeLabelSame(ticks.TextBuffer.Buf.Data + last_major, ticks.TextBuffer.Buf.Data + tick_maj.TextOffset))
                     tick_maj.ShowLabel = false;
-                last_major = this_major;
+                last_major = tick_maj.TextOffset;
                 ticks.Append(tick_maj);
             }
             // add minor ticks up until next major
@@ -1187,11 +1630,11 @@ void AddTicksTime(const ImPlotRange& range, float plot_width, ImPlotTickCollecti
                         tick.Level =  0;
                         LabelTickTime(tick,ticks.TextBuffer,t12,fmt0);
                         ticks.Append(tick);
-                        if (last_major == NULL && px_to_t2 >= fmt0_width && px_to_t2 >= (fmt1_width + fmtf_width) / 2) {
+                        if (last_major == -1 && px_to_t2 >= fmt0_width && px_to_t2 >= (fmt1_width + fmtf_width) / 2) {
                             ImPlotTick tick_maj(t12.ToDouble(),true,true);
                             tick_maj.Level = 1;
                             LabelTickTime(tick_maj,ticks.TextBuffer,t12,fmtf);
-                            last_major = ticks.TextBuffer.Buf.Data + tick_maj.TextOffset;
+                            last_major = tick_maj.TextOffset;
                             ticks.Append(tick_maj);
                         }
                     }
@@ -1225,6 +1668,53 @@ void AddTicksTime(const ImPlotRange& range, float plot_width, ImPlotTickCollecti
     }
 }
 
+// Default ticks of an axis through its ImPlotTickCache
+static void AddTicksCached(ImPlotAxis& axis, float pix) {
+    ImPlotContext& gp = *GImPlot;
+    ImPlotTickCache& cache = axis.TickCache;
+    const int scale = axis.IsTime() ? 3 : axis.IsLog() ? 2 : 1;
+    const int time_style = scale == 3 ? (gp.Style.UseLocalTime | gp.Style.UseISO8601 << 1 | gp.Style.Use24HourClock << 2) : 0;
+    ImPlotFormatter formatter = scale == 3 ? NULL : axis.Formatter ? axis.Formatter : DefaultFormatter;
+    void* data = scale == 3 ? NULL : (axis.Formatter && axis.FormatterData) ? axis.FormatterData : axis.HasFormatSpec ? (void*)axis.FormatSpec : (void*)IMPLOT_LABEL_FORMAT;
+    const bool format_spec = formatter == DefaultFormatter;
+
+    // same labels for the same values?
+    const bool same_labels = cache.Scale == scale && cache.TimeStyle == time_style && cache.Formatter == formatter && cache.FormatterData == data
+                          && (!format_spec || strcmp(cache.FormatSpec, (const char*)data) == 0)
+                          && cache.Font == ImGui::GetFont() && cache.FontSize == ImGui::GetFontSize();
+    if (same_labels && cache.Range.Min == axis.Range.Min && cache.Range.Max == axis.Range.Max && cache.Pixels == pix) {
+        cache.Hits++;
+        axis.Ticks.Append(cache.Ticks);
+        return;
+    }
+
+    // regenerate, time labels depend on their neighbors so only linear and log ticks reuse labels
+    cache.Misses++;
+    cache.Scratch.Reset();
+    cache.Scratch.Reuse = same_labels && scale != 3 ? &cache.Ticks : NULL;
+    if (scale == 3)
+        AddTicksTime(axis.Range, pix, cache.Scratch);
+    else if (scale == 2)
+        AddTicksLogarithmic(axis.Range, pix, axis.Vertical, cache.Scratch, formatter, data);
+    else
+        AddTicksDefault(axis.Range, pix, axis.Vertical, cache.Scratch, formatter, data);
+    cache.LabelsReused += cache.Scratch.ReuseCount;
+    cache.Scratch.Reuse = NULL;
+    cache.Ticks.Swap(cache.Scratch);
+
+    cache.Range = axis.Range;
+    cache.Pixels = pix;
+    cache.Scale = scale;
+    cache.TimeStyle = time_style;
+    cache.Formatter = formatter;
+    cache.FormatterData = data;
+    if (format_spec)
+        ImStrncpy(cache.FormatSpec, (const char*)data, sizeof(cache.FormatSpec));
+    cache.Font = ImGui::GetFont();
+    cache.FontSize = ImGui::GetFontSize();
+    axis.Ticks.Append(cache.Ticks);
+}
+
 //-----------------------------------------------------------------------------
 // Context Menu
 //-----------------------------------------------------------------------------
@@ -1379,6 +1869,7 @@ bool ShowLegendContextMenu(ImPlotLegend& legend, bool visible) {
         ret = true;
     if (legend.CanGoInside)
         ImGui::CheckboxFlags("Outside",(unsigned int*)&legend.Flags, ImPlotLegendFlags_Outside);
+    ImGui::CheckboxFlags("Sort",(unsigned int*)&legend.Flags, ImPlotLegendFlags_Sort);
     if (ImGui::RadioButton("H", ImHasFlag(legend.Flags, ImPlotLegendFlags_Horizontal)))
         legend.Flags |= ImPlotLegendFlags_Horizontal;
     ImGui::SameLine();
@@ -1883,7 +2374,10 @@ bool UpdateInput(ImPlotPlot& plot) {
 
     // SCROLL INPUT -----------------------------------------------------------
 
-    if (any_hov && IO.MouseWheel != 0 && ImHasFlag(IO.KeyMods, gp.InputMap.ZoomMod)) {
+    // a legend with more entries than fit scrolls instead (its rect is from last frame, the legend is rendered in EndPlot)
+    const bool legend_scroll = plot.Items.Legend.Scrollable && plot.Items.Legend.Rect.Contains(IO.MousePos);
+
+    if (any_hov && IO.MouseWheel != 0 && ImHasFlag(IO.KeyMods, gp.InputMap.ZoomMod) && !legend_scroll) {
 
         float zoom_rate = gp.InputMap.ZoomRate;
         if (IO.MouseWheel > 0)
@@ -2142,6 +2636,13 @@ void SetupMouseText(ImPlotLocation location, ImPlotMouseTextFlags flags) {
     GImPlot->CurrentPlot->MouseTextFlags = flags;
 }
 
+void SetupNearest(float max_dist, bool tooltip) {
+    IM_ASSERT_USER_ERROR(GImPlot->CurrentPlot != NULL && !GImPlot->CurrentPlot->SetupLocked,
+                         "Setup needs to be called after BeginPlot and before any setup locking functions (e.g. PlotX)!");
+    GImPlot->CurrentPlot->NearestDist    = ImMax(max_dist, 0.0f);
+    GImPlot->CurrentPlot->NearestTooltip = tooltip;
+}
+
 //-----------------------------------------------------------------------------
 // SetNext
 //-----------------------------------------------------------------------------
@@ -2206,13 +2707,16 @@ bool BeginPlot(const char* title_id, const ImVec2& size, ImPlotFlags flags) {
     // ID and age (TODO: keep track of plot age in frames)
     const ImGuiID ID         = Window->GetID(title_id);
     const bool just_created  = gp.Plots.GetByKey(ID) == NULL;
+    const ImGuiMemTag backup_mem_tag = ImGui::SetMemTag(ImGuiMemTag_Plot);
     gp.CurrentPlot           = gp.Plots.GetOrAddByKey(ID);
+    ImGui::SetMemTag(backup_mem_tag);
 
     ImPlotPlot &plot         = *gp.CurrentPlot;
     plot.ID                  = ID;
     plot.Items.ID            = ID - 1;
     plot.JustCreated         = just_created;
     plot.SetupLocked         = false;
+    plot.ResetNearest();
 
     // check flags
     if (plot.JustCreated)
@@ -2286,12 +2790,20 @@ bool BeginPlot(const char* title_id, const ImVec2& size, ImPlotFlags flags) {
     if (gp.CurrentItems == NULL)
         gp.CurrentItems = &plot.Items;
 
+    // start stats
+    if (gp.StatsEnabled) {
+        plot.Stats = ImPlotStats();
+        plot.Stats.Frame = ImGui::GetFrameCount();
+        gp.PlotStatsMark = GetStatsMark(Window->DrawList);
+    }
+
     return true;
 }
 
 void SetupFinish() {
     IM_ASSERT_USER_ERROR(GImPlot != NULL, "No current context. Did you call ImPlot::CreateContext() or ImPlot::SetCurrentContext()?");
     IM_ASSERT_USER_ERROR(GImPlot->CurrentPlot != NULL, "SetupFinish needs to be called after BeginPlot!");
+    const ImGuiMemTag backup_mem_tag = ImGui::SetMemTag(ImGuiMemTag_Plot);
 
     ImPlotContext& gp       = *GImPlot;
     ImGuiContext& G         = *GImGui;
@@ -2342,7 +2854,8 @@ void SetupFinish() {
     if (!ImHasFlag(plot.Flags, ImPlotFlags_NoLegend) && plot.Items.GetLegendCount() > 0 && ImHasFlag(plot.Items.Legend.Flags, ImPlotLegendFlags_Outside)) {
         ImPlotLegend& legend = plot.Items.Legend;
         const bool horz = ImHasFlag(legend.Flags, ImPlotLegendFlags_Horizontal);
-        const ImVec2 legend_size = CalcLegendSize(plot.Items, gp.Style.LegendInnerPadding, gp.Style.LegendSpacing, !horz);
+        const ImVec2 legend_size = ClampLegendSize(CalcLegendSize(plot.Items, gp.Style.LegendInnerPadding, gp.Style.LegendSpacing, !horz),
+                                                   plot.FrameRect, gp.Style.PlotPadding);
         const bool west = ImHasFlag(legend.Location, ImPlotLocation_West) && !ImHasFlag(legend.Location, ImPlotLocation_East);
         const bool east = ImHasFlag(legend.Location, ImPlotLocation_East) && !ImHasFlag(legend.Location, ImPlotLocation_West);
         const bool north = ImHasFlag(legend.Location, ImPlotLocation_North) && !ImHasFlag(legend.Location, ImPlotLocation_South);
@@ -2388,20 +2901,10 @@ void SetupFinish() {
     for (int i = 0; i < IMPLOT_NUM_Y_AXES; i++) {
         ImPlotAxis& axis = plot.YAxis(i);
         if (axis.WillRender() && axis.ShowDefaultTicks) {
-            if (axis.IsLog())
-                AddTicksLogarithmic(axis.Range,
-                                    plot_height,
-                                    true,
-                                    axis.Ticks,
-                                    axis.Formatter     ? axis.Formatter  : DefaultFormatter,
-                                    (axis.Formatter && axis.FormatterData) ? axis.FormatterData : axis.HasFormatSpec ? axis.FormatSpec : (void*)IMPLOT_LABEL_FORMAT);
-            else
-                AddTicksDefault(axis.Range,
-                                plot_height,
-                                true,
-                                axis.Ticks,
-                                axis.Formatter     ? axis.Formatter  : DefaultFormatter,
-                                (axis.Formatter && axis.FormatterData) ? axis.FormatterData : axis.HasFormatSpec ? axis.FormatSpec : (void*)IMPLOT_LABEL_FORMAT);
+            const double t0 = gp.StatsEnabled ? GetStatsTime() : 0;
+            AddTicksCached(axis, plot_height);
+            if (gp.StatsEnabled)
+                plot.Stats.TickTime += GetStatsTime() - t0;
         }
     }
 
@@ -2414,22 +2917,10 @@ void SetupFinish() {
     for (int i = 0; i < IMPLOT_NUM_X_AXES; i++) {
         ImPlotAxis& axis = plot.XAxis(i);
         if (axis.WillRender() && axis.ShowDefaultTicks) {
-            if (axis.IsTime())
-                AddTicksTime(axis.Range, plot_width, axis.Ticks);
-            else if (axis.IsLog())
-                AddTicksLogarithmic(axis.Range,
-                                    plot_width,
-                                    false,
-                                    axis.Ticks,
-                                    axis.Formatter     ? axis.Formatter  : DefaultFormatter,
-                                    (axis.Formatter && axis.FormatterData) ? axis.FormatterData : axis.HasFormatSpec ? axis.FormatSpec : (void*)IMPLOT_LABEL_FORMAT);
-            else
-                AddTicksDefault(axis.Range,
-                                plot_width,
-                                false,
-                                axis.Ticks,
-                                axis.Formatter     ? axis.Formatter  : DefaultFormatter,
-                                (axis.Formatter && axis.FormatterData) ? axis.FormatterData : axis.HasFormatSpec ? axis.FormatSpec : (void*)IMPLOT_LABEL_FORMAT);
+            const double t0 = gp.StatsEnabled ? GetStatsTime() : 0;
+            AddTicksCached(axis, plot_width);
+            if (gp.StatsEnabled)
+                plot.Stats.TickTime += GetStatsTime() - t0;
         }
     }
 
@@ -2601,6 +3092,7 @@ void SetupFinish() {
     plot.Items.Legend.Reset();
     // push ID to set item hashes
     ImGui::PushOverrideID(gp.CurrentItems->ID);
+    ImGui::SetMemTag(backup_mem_tag);
 }
 
 //-----------------------------------------------------------------------------
@@ -2610,6 +3102,7 @@ void SetupFinish() {
 void EndPlot() {
     IM_ASSERT_USER_ERROR(GImPlot != NULL, "No current context. Did you call ImPlot::CreateContext() or ImPlot::SetCurrentContext()?");
     IM_ASSERT_USER_ERROR(GImPlot->CurrentPlot != NULL, "Mismatched BeginPlot()/EndPlot()!");
+    const ImGuiMemTag backup_mem_tag = ImGui::SetMemTag(ImGuiMemTag_Plot);
 
     SetupLock();
 
@@ -2765,6 +3258,14 @@ void EndPlot() {
         DrawList.AddLine(v3, v4, col);
     }
 
+    // render nearest point highlight
+    const bool show_nearest = plot.NearestItem != 0 && plot.NearestTooltip;
+    if (show_nearest) {
+        const float radius = ImMax(gp.Style.MarkerSize, 2.0f) + 3.0f;
+        DrawList.AddCircleFilled(plot.NearestPos, 2.5f, plot.NearestColor);
+        DrawList.AddCircle(plot.NearestPos, radius, plot.NearestColor, 0, 2.0f);
+    }
+
     // render mouse pos
     if (!ImHasFlag(plot.Flags, ImPlotFlags_NoMouseText) && (plot.Hovered || ImHasFlag(plot.MouseTextFlags, ImPlotMouseTextFlags_ShowAlways))) {
 
@@ -2813,6 +3314,24 @@ void EndPlot() {
     }
     PopPlotClipRect();
 
+    // render nearest point tooltip
+    if (show_nearest) {
+        char x_buff[IMPLOT_LABEL_MAX_SIZE];
+        char y_buff[IMPLOT_LABEL_MAX_SIZE];
+        LabelAxisValue(plot.Axes[plot.NearestX], plot.NearestPoint.x, x_buff, sizeof(x_buff), false);
+        LabelAxisValue(plot.Axes[plot.NearestY], plot.NearestPoint.y, y_buff, sizeof(y_buff), false);
+        const char* label = gp.CurrentItems->GetItemLabel(plot.NearestItem);
+        ImGui::BeginTooltip();
+        ItemIcon(plot.NearestColor);
+        ImGui::SameLine();
+        if (*label != '\0')
+            ImGui::Text("%s [%d]", label, plot.NearestIdx);
+        else
+            ImGui::Text("[%d]", plot.NearestIdx);
+        ImGui::Text("%s, %s", x_buff, y_buff);
+        ImGui::EndTooltip();
+    }
+
     // axis side switch
     if (!plot.Held) {
         ImVec2 mouse_pos = ImGui::GetIO().MousePos;
@@ -2873,7 +3392,9 @@ void EndPlot() {
         ImPlotLegend& legend = plot.Items.Legend;
         const bool   legend_out  = ImHasFlag(legend.Flags, ImPlotLegendFlags_Outside);
         const bool   legend_horz = ImHasFlag(legend.Flags, ImPlotLegendFlags_Horizontal);
-        const ImVec2 legend_size = CalcLegendSize(plot.Items, gp.Style.LegendInnerPadding, gp.Style.LegendSpacing, !legend_horz);
+        const ImVec2 legend_size = ClampLegendSize(CalcLegendSize(plot.Items, gp.Style.LegendInnerPadding, gp.Style.LegendSpacing, !legend_horz),
+                                                   legend_out ? plot.FrameRect : plot.PlotRect,
+                                                   legend_out ? gp.Style.PlotPadding : gp.Style.LegendPadding);
         const ImVec2 legend_pos  = GetLocationPos(legend_out ? plot.FrameRect : plot.PlotRect,
                                                   legend_size,
                                                   legend.Location,
@@ -3051,6 +3572,13 @@ void EndPlot() {
         plot.Items.GetItemByIndex(i)->SeenThisFrame = false;
     }
 
+    // finish stats, then render their overlay so that it isn't counted
+    if (gp.StatsEnabled && plot.Stats.Frame == ImGui::GetFrameCount()) {
+        AddStatsSince(plot.Stats, gp.PlotStatsMark, &DrawList);
+        if (gp.StatsOverlay)
+            RenderStatsOverlay(plot, DrawList);
+    }
+
     // mark the plot as initialized, i.e. having made it through one frame completely
     plot.Initialized = true;
     // Pop ImGui::PushID at the end of BeginPlot
@@ -3063,6 +3591,7 @@ void EndPlot() {
         ImGui::PopID();
         SubplotNextCell();
     }
+    ImGui::SetMemTag(backup_mem_tag);
 }
 
 //-----------------------------------------------------------------------------
@@ -3215,7 +3744,8 @@ bool BeginSubplots(const char* title, int rows, int cols, const ImVec2& size, Im
     if (share_items && !ImHasFlag(subplot.Flags, ImPlotSubplotFlags_NoLegend) && subplot.Items.GetLegendCount() > 0) {
         ImPlotLegend& legend = subplot.Items.Legend;
         const bool horz = ImHasFlag(legend.Flags, ImPlotLegendFlags_Horizontal);
-        const ImVec2 legend_size = CalcLegendSize(subplot.Items, gp.Style.LegendInnerPadding, gp.Style.LegendSpacing, !horz);
+        const ImVec2 legend_size = ClampLegendSize(CalcLegendSize(subplot.Items, gp.Style.LegendInnerPadding, gp.Style.LegendSpacing, !horz),
+                                                   subplot.FrameRect, gp.Style.PlotPadding);
         const bool west = ImHasFlag(legend.Location, ImPlotLocation_West) && !ImHasFlag(legend.Location, ImPlotLocation_East);
         const bool east = ImHasFlag(legend.Location, ImPlotLocation_East) && !ImHasFlag(legend.Location, ImPlotLocation_West);
         const bool north = ImHasFlag(legend.Location, ImPlotLocation_North) && !ImHasFlag(legend.Location, ImPlotLocation_South);
@@ -3363,7 +3893,8 @@ void EndSubplots() {
     ImDrawList& DrawList = *ImGui::GetWindowDrawList();
     if (share_items && !ImHasFlag(subplot.Flags, ImPlotSubplotFlags_NoLegend) && subplot.Items.GetLegendCount() > 0) {
         const bool   legend_horz = ImHasFlag(subplot.Items.Legend.Flags, ImPlotLegendFlags_Horizontal);
-        const ImVec2 legend_size = CalcLegendSize(subplot.Items, gp.Style.LegendInnerPadding, gp.Style.LegendSpacing, !legend_horz);
+        const ImVec2 legend_size = ClampLegendSize(CalcLegendSize(subplot.Items, gp.Style.LegendInnerPadding, gp.Style.LegendSpacing, !legend_horz),
+                                                   subplot.FrameRect, gp.Style.PlotPadding);
         const ImVec2 legend_pos  = GetLocationPos(subplot.FrameRect, legend_size, subplot.Items.Legend.Location, gp.Style.PlotPadding);
         subplot.Items.Legend.Rect = ImRect(legend_pos, legend_pos + legend_size);
         subplot.Items.Legend.Hovered = subplot.FrameHovered && subplot.Items.Legend.Rect.Contains(ImGui::GetIO().MousePos);
@@ -3505,6 +4036,22 @@ bool IsPlotHovered() {
     return gp.CurrentPlot->Hovered;
 }
 
+bool GetNearestPoint(ImPlotPoint* point, int* index, const char** label) {
+    ImPlotContext& gp = *GImPlot;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != NULL, "GetNearestPoint() needs to be called between BeginPlot() and EndPlot()!");
+    SetupLock();
+    ImPlotPlot& plot = *gp.CurrentPlot;
+    if (plot.NearestItem == 0)
+        return false;
+    if (point != NULL)
+        *point = plot.NearestPoint;
+    if (index != NULL)
+        *index = plot.NearestIdx;
+    if (label != NULL)
+        *label = gp.CurrentItems->GetItemLabel(plot.NearestItem);
+    return true;
+}
+
 bool IsAxisHovered(ImAxis axis) {
     ImPlotContext& gp = *GImPlot;
     IM_ASSERT_USER_ERROR(gp.CurrentPlot != NULL, "IsPlotXAxisHovered() needs to be called between BeginPlot() and EndPlot()!");
@@ -3558,6 +4105,11 @@ void HideNextItem(bool hidden, ImPlotCond cond) {
     gp.NextItemData.HiddenCond = cond;
 }
 
+void SetNextDataVersion(int version) {
+    ImPlotContext& gp = *GImPlot;
+    gp.NextItemData.DataVersion = version;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] Plot Tools
 //-----------------------------------------------------------------------------
@@ -3980,6 +4532,7 @@ void ShowAltLegend(const char* title_id, bool vertical, const ImVec2 size, bool
     ImGui::RenderFrame(bb_frame.Min, bb_frame.Max, GetStyleColorU32(ImPlotCol_FrameBg), true, G.Style.FrameRounding);
     DrawList.PushClipRect(bb_frame.Min, bb_frame.Max, true);
     if (plot != NULL) {
+        legend_size = ClampLegendSize(legend_size, bb_frame, gp.Style.LegendPadding);
         const ImVec2 legend_pos  = GetLocationPos(bb_frame, legend_size, 0, gp.Style.LegendPadding);
         const ImRect legend_bb(legend_pos, legend_pos + legend_size);
         interactable = interactable && bb_frame.Contains(ImGui::GetIO().MousePos);
@@ -4896,6 +5449,14 @@ void ShowTicksMetrics(const ImPlotTickCollection& ticks) {
     ImGui::BulletText("MaxSize: [%f,%f]", ticks.MaxSize.x, ticks.MaxSize.y);
 }
 
+void ShowStatsMetrics(const ImPlotStats& stats) {
+    ImGui::BulletText("Frame: %d", stats.Frame);
+    ImGui::BulletText("Points: %d", stats.Points);
+    ImGui::BulletText("Prims: %d emitted, %d culled", stats.PrimsEmitted, stats.PrimsCulled);
+    ImGui::BulletText("Draw: %d vtx, %d idx, %d cmds", stats.Vertices, stats.Indices, stats.DrawCmds);
+    ImGui::BulletText("Time: fit %.3f ms, tess %.3f ms, ticks %.3f ms, total %.3f ms", stats.FitTime, stats.TessTime, stats.TickTime, stats.TotalTime);
+}
+
 void ShowAxisMetrics(const ImPlotPlot& plot, const ImPlotAxis& axis) {
     ImGui::BulletText("Label: %s", axis.LabelOffset == -1 ? "[none]" : plot.GetAxisLabel(axis));
     ImGui::BulletText("Flags: 0x%08X", axis.Flags);
@@ -4919,6 +5480,7 @@ void ShowAxisMetrics(const ImPlotPlot& plot, const ImPlotAxis& axis) {
 
     if (ImGui::TreeNode("Ticks")) {
         ShowTicksMetrics(axis.Ticks);
+        ImGui::BulletText("Cache: %d hits, %d misses, %d labels reused", axis.TickCache.Hits, axis.TickCache.Misses, axis.TickCache.LabelsReused);
         ImGui::TreePop();
     }
 }
@@ -4956,6 +5518,14 @@ void ShowMetricsWindow(bool* p_popen) {
         ImGui::Checkbox("Show Axis Rects",  &show_axis_rects);
         ImGui::Checkbox("Show Subplot Frame Rects",  &show_subplot_frame_rects);
         ImGui::Checkbox("Show Subplot Grid Rects",  &show_subplot_grid_rects);
+        bool stats = gp.StatsEnabled, stats_overlay = gp.StatsOverlay;
+        if (ImGui::Checkbox("Collect Stats", &stats))
+            SetStatsEnabled(stats, gp.StatsOverlay);
+        if (ImGui::Checkbox("Show Stats Overlay", &stats_overlay))
+            SetStatsEnabled(gp.StatsEnabled || stats_overlay, stats_overlay);
+        ImGui::SameLine();
+        if (ImGui::Button("Save Stats CSV"))
+            SaveStatsToDisk("implot_stats.csv");
         ImGui::TreePop();
     }
     const int n_plots = gp.Plots.GetBufSize();
@@ -5006,6 +5576,10 @@ void ShowMetricsWindow(bool* p_popen) {
                             ImGui::BulletText("NameOffset: %d",item->NameOffset);
                             ImGui::BulletText("Name: %s", item->NameOffset != -1 ? plot.Items.Legend.Labels.Buf.Data + item->NameOffset : "N/A");
                             ImGui::BulletText("Hovered: %s",item->LegendHovered ? "true" : "false");
+                            if (gp.StatsEnabled && ImGui::TreeNode("Stats")) {
+                                ShowStatsMetrics(item->Stats);
+                                ImGui::TreePop();
+                            }
                             ImGui::TreePop();
                         }
                         ImGui::PopID();
@@ -5036,6 +5610,10 @@ void ShowMetricsWindow(bool* p_popen) {
                 ImGui::BulletText("Held: %s", plot.Held ? "true" : "false");
                 ImGui::BulletText("LegendHovered: %s", plot.Items.Legend.Hovered ? "true" : "false");
                 ImGui::BulletText("ContextLocked: %s", plot.ContextLocked ? "true" : "false");
+                if (gp.StatsEnabled && ImGui::TreeNode("Stats")) {
+                    ShowStatsMetrics(plot.Stats);
+                    ImGui::TreePop();
+                }
                 ImGui::TreePop();
             }
             ImGui::PopID();
@@ -5064,6 +5642,10 @@ void ShowMetricsWindow(bool* p_popen) {
                             ImGui::BulletText("NameOffset: %d",item->NameOffset);
                             ImGui::BulletText("Name: %s", item->NameOffset != -1 ? plot.Items.Legend.Labels.Buf.Data + item->NameOffset : "N/A");
                             ImGui::BulletText("Hovered: %s",item->LegendHovered ? "true" : "false");
+                            if (gp.StatsEnabled && ImGui::TreeNode("Stats")) {
+                                ShowStatsMetrics(item->Stats);
+                                ImGui::TreePop();
+                            }
                             ImGui::TreePop();
                         }
                         ImGui::PopID();
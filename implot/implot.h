@@ -167,6 +167,7 @@ enum ImPlotLegendFlags_ {
     ImPlotLegendFlags_NoMenus         = 1 << 3, // the user will not be able to open context menus with right-click
     ImPlotLegendFlags_Outside         = 1 << 4, // legend will be rendered outside of the plot area
     ImPlotLegendFlags_Horizontal      = 1 << 5, // legend entries will be displayed horizontally
+    ImPlotLegendFlags_Sort            = 1 << 6, // legend entries will be displayed in alphabetical order
 };
 
 // Options for mouse hover text (see SetupMouseText)
@@ -350,6 +351,42 @@ struct ImPlotRect {
     ImPlotPoint Max() const                                            { return ImPlotPoint(X.Max, Y.Max);                             }
 };
 
+// Column of data kept as a list of fixed size blocks (e.g. Arrow chunks) and plotted without copying it to a contiguous
+// array. Element i is element i % BlockSize of Blocks[i / BlockSize]. Elements cleared in the optional validity bitmaps
+// (bit i % 8 of byte i / 8 of a block's bitmap, set means valid) are nulls, and lines break around them. Elements plot as
+// Offset + (element - Origin) * Scale, with Origin subtracted in 64-bit integer math for integer types so that int64
+// nanosecond timestamps keep full precision (e.g. Origin = the first timestamp and Scale = 1e-9 for seconds since it).
+struct ImPlotColumn {
+    ImGuiDataType      Type;      // element type, ImGuiDataType_S8 to ImGuiDataType_Double
+    const void* const* Blocks;    // blocks of BlockSize elements, the last may be partial
+    const ImU8* const* Validity;  // validity bitmap of each block, NULL (or NULL entries) if all elements are valid
+    int                BlockSize; // elements per block
+    int                Count;     // total number of elements
+    ImS64              Origin;    // subtracted from elements
+    double             Scale;     // then multiplies them
+    double             Offset;    // then is added
+    ImPlotColumn(ImGuiDataType type, const void* const* blocks, int block_size, int count, const ImU8* const* validity = NULL) {
+        Type = type; Blocks = blocks; Validity = validity; BlockSize = block_size; Count = count; Origin = 0; Scale = 1; Offset = 0;
+    }
+};
+
+// Performance counters of a plot or of one of its items for the last frame it was submitted in (see SetStatsEnabled).
+// Item times are inclusive of their fit and tessellation, plot times of everything between BeginPlot and EndPlot.
+struct ImPlotStats {
+    int    Frame;        // ImGui frame the counters belong to
+    int    Points;       // data points submitted
+    int    PrimsEmitted; // line segments, markers, rects and quads emitted by the primitive renderers
+    int    PrimsCulled;  // primitives skipped because they were outside of the plot area
+    int    Vertices;     // vertices added to the draw list
+    int    Indices;      // indices added to the draw list
+    int    DrawCmds;     // draw commands added to the draw list
+    double FitTime;      // ms spent extending axes to fit data
+    double TessTime;     // ms spent tessellating, i.e. item time less fit time
+    double TickTime;     // ms spent generating and labeling ticks (plots only)
+    double TotalTime;    // ms from BeginPlot to EndPlot, or from the start to the end of an item
+    ImPlotStats() { Frame = Points = PrimsEmitted = PrimsCulled = Vertices = Indices = DrawCmds = 0; FitTime = TessTime = TickTime = TotalTime = 0; }
+};
+
 // Plot style structure
 struct ImPlotStyle {
     // item styling variables
@@ -414,7 +451,8 @@ struct ImPlotInputMap {
 // [SECTION] Callbacks
 //-----------------------------------------------------------------------------
 
-// Callback signature for axis tick label formatter.
+// Callback signature for axis tick label formatter. Labels are cached across frames and only reformatted when the axis
+// changes, so the label must only depend on #value and #user_data (not on time, global state or locale).
 typedef void (*ImPlotFormatter)(double value, char* buff, int size, void* user_data);
 
 // Callback signature for data getter.
@@ -567,6 +605,7 @@ IMPLOT_API void SetupAxisLinks(ImAxis axis, double* link_min, double* link_max);
 // Sets the format of numeric axis labels via formater specifier (default="%g"). Formated values will be double (i.e. use %f).
 IMPLOT_API void SetupAxisFormat(ImAxis axis, const char* fmt);
 // Sets the format of numeric axis labels via formatter callback. Given #value, write a label into #buff. Optionally pass user data.
+// Labels are cached: the formatter must be a pure function of #value and #data. To change labels for the same values, pass a different #data pointer.
 IMPLOT_API void SetupAxisFormat(ImAxis axis, ImPlotFormatter formatter, void* data = NULL);
 // Sets an axis' ticks and optionally the labels. To keep the default ticks, set #keep_default=true.
 IMPLOT_API void SetupAxisTicks(ImAxis axis, const double* values, int n_ticks, const char* const labels[] = NULL, bool keep_default = false);
@@ -582,6 +621,9 @@ IMPLOT_API void SetupAxesLimits(double x_min, double x_max, double y_min, double
 IMPLOT_API void SetupLegend(ImPlotLocation location, ImPlotLegendFlags flags = ImPlotLegendFlags_None);
 // Set the location of the current plot's mouse position text (default = South|East).
 IMPLOT_API void SetupMouseText(ImPlotLocation location, ImPlotMouseTextFlags flags = ImPlotMouseTextFlags_None);
+// Enables nearest point queries for the line and scatter items of the current plot (see GetNearestPoint). Points further
+// than #max_dist pixels from the mouse are ignored. If #tooltip, the point is highlighted and its value shown in a tooltip.
+IMPLOT_API void SetupNearest(float max_dist = 16, bool tooltip = true);
 
 // Explicitly finalize plot setup. Once you call this, you cannot make anymore Setup calls for the current plot!
 // Note that calling this function is OPTIONAL; it will be called by the first subsequent setup-locking API call.
@@ -671,6 +713,14 @@ IMPLOT_API void SetNextAxesToFit();
 //        ImPlot::EndPlot();
 //    }
 //
+// 3. If your data is stored in chunks (e.g. Arrow arrays), describe each column with an ImPlotColumn and pass
+//    them to the PlotLine/PlotScatter/PlotStairs overloads that take columns. Blocks are read in place.
+//
+//    ImPlotColumn ts(ImGuiDataType_S64, (const void* const*)ts_blocks, 8192, count);
+//    ts.Origin = first_ts; ts.Scale = 1e-9; // int64 ns -> seconds since first_ts
+//    ImPlotColumn ys(ImGuiDataType_Float, (const void* const*)y_blocks, 8192, count, y_validity);
+//    ImPlot::PlotLine("column", ts, ys);
+//
 // NB: All types are converted to double before plotting. You may lose information
 // if you try plotting extremely large 64-bit integral types. Proceed with caution!
 
@@ -678,16 +728,22 @@ IMPLOT_API void SetNextAxesToFit();
 template <typename T> IMPLOT_API void PlotLine(const char* label_id, const T* values, int count, double xscale=1, double x0=0, int offset=0, int stride=sizeof(T));
 template <typename T> IMPLOT_API void PlotLine(const char* label_id, const T* xs, const T* ys, int count, int offset=0, int stride=sizeof(T));
                       IMPLOT_API void PlotLineG(const char* label_id, ImPlotGetter getter, void* data, int count);
+                      IMPLOT_API void PlotLine(const char* label_id, const ImPlotColumn& ys, double xscale=1, double x0=0);
+                      IMPLOT_API void PlotLine(const char* label_id, const ImPlotColumn& xs, const ImPlotColumn& ys);
 
 // Plots a standard 2D scatter plot. Default marker is ImPlotMarker_Circle.
 template <typename T> IMPLOT_API  void PlotScatter(const char* label_id, const T* values, int count, double xscale=1, double x0=0, int offset=0, int stride=sizeof(T));
 template <typename T> IMPLOT_API  void PlotScatter(const char* label_id, const T* xs, const T* ys, int count, int offset=0, int stride=sizeof(T));
                       IMPLOT_API  void PlotScatterG(const char* label_id, ImPlotGetter getter, void* data, int count);
+                      IMPLOT_API  void PlotScatter(const char* label_id, const ImPlotColumn& ys, double xscale=1, double x0=0);
+                      IMPLOT_API  void PlotScatter(const char* label_id, const ImPlotColumn& xs, const ImPlotColumn& ys);
 
 // Plots a a stairstep graph. The y value is continued constantly from every x position, i.e. the interval [x[i], x[i+1]) has the value y[i].
 template <typename T> IMPLOT_API void PlotStairs(const char* label_id, const T* values, int count, double xscale=1, double x0=0, int offset=0, int stride=sizeof(T));
 template <typename T> IMPLOT_API void PlotStairs(const char* label_id, const T* xs, const T* ys, int count, int offset=0, int stride=sizeof(T));
                       IMPLOT_API void PlotStairsG(const char* label_id, ImPlotGetter getter, void* data, int count);
+                      IMPLOT_API void PlotStairs(const char* label_id, const ImPlotColumn& ys, double xscale=1, double x0=0);
+                      IMPLOT_API void PlotStairs(const char* label_id, const ImPlotColumn& xs, const ImPlotColumn& ys);
 
 // Plots a shaded (filled) region between two lines, or a line and a horizontal reference. Set y_ref to +/-INFINITY for infinite fill extents.
 template <typename T> IMPLOT_API void PlotShaded(const char* label_id, const T* values, int count, double y_ref=0, double xscale=1, double x0=0, int offset=0, int stride=sizeof(T));
@@ -810,6 +866,9 @@ IMPLOT_API ImPlotRect GetPlotLimits(ImAxis x_axis = IMPLOT_AUTO, ImAxis y_axis =
 
 // Returns true if the plot area in the current plot is hovered.
 IMPLOT_API bool IsPlotHovered();
+// Returns true if a line or scatter point is within SetupNearest's distance of the mouse, and optionally its value, index
+// and item label. Only items plotted so far are considered, so call this after your PlotX calls and before EndPlot.
+IMPLOT_API bool GetNearestPoint(ImPlotPoint* point = NULL, int* index = NULL, const char** label = NULL);
 // Returns true if the axis label area in the current plot is hovered.
 IMPLOT_API bool IsAxisHovered(ImAxis axis);
 // Returns true if the bounding frame of a subplot is hovered.
@@ -826,6 +885,10 @@ IMPLOT_API void CancelPlotSelection();
 // Use ImPlotCond_Always if you need to forcefully set this every frame.
 IMPLOT_API void HideNextItem(bool hidden = true, ImPlotCond cond = ImPlotCond_Once);
 
+// Sets the data version of the next plot item. Nearest point indices (see SetupNearest) are extended when points are appended
+// and rebuilt when the first or previously last point, the axes or this version change, so bump it if you modify data in place.
+IMPLOT_API void SetNextDataVersion(int version);
+
 // Use the following around calls to Begin/EndPlot to align l/r/t/b padding.
 // Consider using Begin/EndSubplots first. They are more feature rich and
 // accomplish the same behaviour by default. The functions below offer lower
@@ -950,6 +1013,11 @@ IMPLOT_API void SetNextFillStyle(const ImVec4& col = IMPLOT_AUTO_COL, float alph
 IMPLOT_API void SetNextMarkerStyle(ImPlotMarker marker = IMPLOT_AUTO, float size = IMPLOT_AUTO, const ImVec4& fill = IMPLOT_AUTO_COL, float weight = IMPLOT_AUTO, const ImVec4& outline = IMPLOT_AUTO_COL);
 // Set the error bar style for the next item only.
 IMPLOT_API void SetNextErrorBarStyle(const ImVec4& col = IMPLOT_AUTO_COL, float size = IMPLOT_AUTO, float weight = IMPLOT_AUTO);
+// Color the next item per point from the current colormap, #values are mapped from [scale_min,scale_max] like PlotHeatmap.
+// Applies to markers and line segments of PlotLine/PlotScatter and to PlotBars/PlotBarsH, #count must cover the item's points.
+template <typename T> IMPLOT_API void SetNextColormapValues(const T* values, int count, double scale_min, double scale_max, int offset=0, int stride=sizeof(T));
+// Size the next item's markers per point (radius in pixels). #count must cover the item's points.
+template <typename T> IMPLOT_API void SetNextMarkerSizes(const T* sizes, int count, int offset=0, int stride=sizeof(T));
 
 // Gets the last item primary color (i.e. its legend icon color)
 IMPLOT_API ImVec4 GetLastItemColor();
@@ -1025,6 +1093,10 @@ IMPLOT_API bool ColormapButton(const char* label, const ImVec2& size = ImVec2(0,
 // need this function, but it is available for applications that require runtime colormap swaps (e.g. Heatmaps demo).
 IMPLOT_API void BustColorCache(const char* plot_title_id = NULL);
 
+// Time axes with ImPlotStyle::UseLocalTime cache the local UTC offsets and DST transitions of the years they show.
+// If your application changes the process time zone at runtime (e.g. TZ + tzset()), call this to rebuild them.
+IMPLOT_API void BustTimeZoneCache();
+
 //-----------------------------------------------------------------------------
 // [SECTION] Input Mapping
 //-----------------------------------------------------------------------------
@@ -1053,6 +1125,26 @@ IMPLOT_API void PushPlotClipRect(float expand=0);
 // Pop plot clip rect. Call between Begin/EndPlot.
 IMPLOT_API void PopPlotClipRect();
 
+// Sets how many threads tessellate large line, stairs, shaded, stem, error bar and heatmap items, including the calling
+// thread. 1 = serial (default), 0 = one per hardware thread. Draw commands, vertices and indices come out in the serial
+// order. Getter callbacks (e.g. PlotLineG) are then called from worker threads and must be thread safe.
+IMPLOT_API void SetThreadsCount(int threads_count);
+IMPLOT_API int  GetThreadsCount();
+
+// Enables collection of ImPlotStats for every plot and item, off by default. The cost is a few clock reads per item.
+// If #overlay is true, the stats of each plot are also drawn in a corner of its plot area.
+IMPLOT_API void SetStatsEnabled(bool enabled, bool overlay = false);
+IMPLOT_API bool GetStatsEnabled();
+// Gets the stats of the plot #plot_title_id, in the same ImGui ID scope as the plot, or NULL if there is no such plot.
+// Call after EndPlot. The stats are those of the last frame the plot was submitted in (see ImPlotStats::Frame).
+IMPLOT_API const ImPlotStats* GetPlotStats(const char* plot_title_id);
+// Gets the stats of the last item submitted to the current plot, or NULL. Call after the item's PlotX function and before EndPlot.
+IMPLOT_API const ImPlotStats* GetLastItemStats();
+// Writes the stats of every plot and item to CSV, one row per plot followed by one row per item. The memory is owned
+// by ImPlot and valid until the next call.
+IMPLOT_API const char* SaveStatsToMemory(size_t* out_size = NULL);
+IMPLOT_API bool SaveStatsToDisk(const char* filename);
+
 // Shows ImPlot style selector dropdown menu.
 IMPLOT_API bool ShowStyleSelector(const char* label);
 // Shows ImPlot colormap selector dropdown menu.
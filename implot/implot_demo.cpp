@@ -415,6 +415,25 @@ void ShowDemo_ScatterPlots() {
         ImPlot::PopStyleVar();
         ImPlot::EndPlot();
     }
+
+    // color and size points by a third variable
+    static float xs3[1000], ys3[1000], zs3[1000], sz3[1000];
+    for (int i = 0; i < 1000; ++i) {
+        xs3[i] = (float)rand() / (float)RAND_MAX;
+        ys3[i] = (float)rand() / (float)RAND_MAX;
+        zs3[i] = sinf(6 * xs3[i]) * cosf(6 * ys3[i]);
+        sz3[i] = 2 + 3 * fabsf(zs3[i]);
+    }
+    ImPlot::PushColormap(ImPlotColormap_Viridis);
+    ImPlot::ColormapScale("##ScatterScale", -1, 1, ImVec2(60,225));
+    ImGui::SameLine();
+    if (ImPlot::BeginPlot("Colored Scatter Plot", ImVec2(-1,225))) {
+        ImPlot::SetNextColormapValues(zs3, 1000, -1, 1);
+        ImPlot::SetNextMarkerSizes(sz3, 1000);
+        ImPlot::PlotScatter("Data 3", xs3, ys3, 1000);
+        ImPlot::EndPlot();
+    }
+    ImPlot::PopColormap();
 }
 
 //-----------------------------------------------------------------------------
@@ -1165,13 +1184,14 @@ void ShowDemo_SubplotAxisLinking() {
 
 void ShowDemo_LegendOptions() {
     static ImPlotLocation loc = ImPlotLocation_East;
-    static bool h = false; static bool o = true;
+    static bool h = false; static bool o = true; static bool srt = false;
     ImGui::CheckboxFlags("North", (unsigned int*)&loc, ImPlotLocation_North); ImGui::SameLine();
     ImGui::CheckboxFlags("South", (unsigned int*)&loc, ImPlotLocation_South); ImGui::SameLine();
     ImGui::CheckboxFlags("West",  (unsigned int*)&loc, ImPlotLocation_West);  ImGui::SameLine();
     ImGui::CheckboxFlags("East",  (unsigned int*)&loc, ImPlotLocation_East);  ImGui::SameLine();
     ImGui::Checkbox("Horizontal##2", &h); ImGui::SameLine();
-    ImGui::Checkbox("Outside", &o);
+    ImGui::Checkbox("Outside", &o); ImGui::SameLine();
+    ImGui::Checkbox("Sort", &srt);
 
     ImGui::SliderFloat2("LegendPadding", (float*)&GetStyle().LegendPadding, 0.0f, 20.0f, "%.0f");
     ImGui::SliderFloat2("LegendInnerPadding", (float*)&GetStyle().LegendInnerPadding, 0.0f, 10.0f, "%.0f");
@@ -1181,6 +1201,7 @@ void ShowDemo_LegendOptions() {
         ImPlotLegendFlags flags = ImPlotLegendFlags_None;
         if (h) flags |= ImPlotLegendFlags_Horizontal;
         if (o) flags |= ImPlotLegendFlags_Outside;
+        if (srt) flags |= ImPlotLegendFlags_Sort;
         ImPlot::SetupLegend(loc, flags);
         static MyImPlot::WaveData data1(0.001, 0.2, 2, 0.75);
         static MyImPlot::WaveData data2(0.001, 0.2, 4, 0.25);
@@ -1376,6 +1397,43 @@ void ShowDemo_Querying() {
     }
 }
 
+void ShowDemo_NearestPoint() {
+    static const int count = 1000000;
+    static ImVector<float> xs1, ys1, xs2, ys2;
+    if (xs1.empty()) {
+        xs1.resize(count); ys1.resize(count); xs2.resize(count); ys2.resize(count);
+        for (int i = 0; i < count; ++i) {
+            xs1[i] = i * 10.0f / count;
+            ys1[i] = 0.5f + 0.4f * sinf(xs1[i] * 3) + 0.05f * (float)RandomGauss();
+            xs2[i] = (float)RandomRange(0.0, 10.0);
+            ys2[i] = (float)RandomGauss() * 0.15f + 0.5f;
+        }
+    }
+    static float max_dist = 16;
+    static bool tooltip = true;
+    ImGui::BulletText("Hover a plot with %d line and %d scatter points to find the point nearest to the mouse.", count, count);
+    ImGui::BulletText("Sorted data is binary searched, other data is bucketed into a screen space grid.");
+    ImGui::SliderFloat("Max Distance", &max_dist, 1, 64, "%.0f px");
+    ImGui::SameLine();
+    ImGui::Checkbox("Tooltip", &tooltip);
+    static ImPlotPoint point;
+    static int index = -1;
+    static const char* label = "";
+    if (ImPlot::BeginPlot("##Nearest")) {
+        ImPlot::SetupNearest(max_dist, tooltip);
+        ImPlot::PlotLine("Line", xs1.Data, ys1.Data, count);
+        ImPlot::SetNextMarkerStyle(ImPlotMarker_Circle, 1, IMPLOT_AUTO_COL, IMPLOT_AUTO, ImVec4(0,0,0,0));
+        ImPlot::PlotScatter("Scatter", xs2.Data, ys2.Data, count);
+        if (!ImPlot::GetNearestPoint(&point, &index, &label))
+            index = -1;
+        ImPlot::EndPlot();
+    }
+    if (index != -1)
+        ImGui::Text("Nearest: %s [%d] (%.3f, %.3f)", label, index, point.x, point.y);
+    else
+        ImGui::TextUnformatted("Nearest: none");
+}
+
 void ShowDemo_Annotations() {
     static bool clamp = false;
     ImGui::Checkbox("Clamp",&clamp);
@@ -1671,6 +1729,7 @@ void ShowDemo_CustomDataAndGetters() {
         ImGui::BulletText("You can optionally pass user data to be given to your getter function.");
         ImGui::BulletText("C++ lambdas can be passed as function pointers as well!");
     ImGui::Unindent();
+    ImGui::BulletText("Data stored in chunks can be plotted in place with ImPlotColumn.");
 
     MyImPlot::Vector2f vec2_data[2] = { MyImPlot::Vector2f(0,0), MyImPlot::Vector2f(1,1) };
 
@@ -1695,6 +1754,28 @@ void ShowDemo_CustomDataAndGetters() {
         // auto lamda = [](void* data, int idx) { ... return ImPlotPoint(x,y); };
         // ImPlot::PlotLine("My Lambda", lambda, data, 1000);
 
+        // chunked columns: int64 nanosecond timestamps and float values in blocks of 256, with nulls every 100 values
+        static ImS64 ts[4][256];
+        static float vs[4][256];
+        static ImU8  valid[4][32];
+        for (int b = 0; b < 4; ++b) {
+            for (int i = 0; i < 256; ++i) {
+                const int n = b * 256 + i;
+                ts[b][i] = 1600000000000000000LL + (ImS64)n * 1000000;
+                vs[b][i] = 0.25f + 0.1f * sinf(n * 0.02f);
+                if (n % 100 < 95)
+                    valid[b][i / 8] |= (ImU8)(1 << (i % 8));
+            }
+        }
+        const void* t_blocks[4] = { ts[0], ts[1], ts[2], ts[3] };
+        const void* v_blocks[4] = { vs[0], vs[1], vs[2], vs[3] };
+        const ImU8* v_valid[4]  = { valid[0], valid[1], valid[2], valid[3] };
+        ImPlotColumn xs(ImGuiDataType_S64, t_blocks, 256, 1000);
+        xs.Origin = ts[0][0];
+        xs.Scale  = 1e-9; // seconds since the first timestamp
+        ImPlotColumn ys(ImGuiDataType_Float, v_blocks, 256, 1000, v_valid);
+        ImPlot::PlotLine("Columns", xs, ys);
+
         ImPlot::EndPlot();
     }
 }
@@ -2010,6 +2091,8 @@ void ShowDemoWindow(bool* p_open) {
                 ShowDemo_DragRects();
             if (ImGui::CollapsingHeader("Querying"))
                 ShowDemo_Querying();
+            if (ImGui::CollapsingHeader("Nearest Point"))
+                ShowDemo_NearestPoint();
             if (ImGui::CollapsingHeader("Annotations"))
                 ShowDemo_Annotations();
             if (ImGui::CollapsingHeader("Tags"))
@@ -65,6 +65,11 @@
 #define IMPLOT_LABEL_MAX_SIZE 32
 // Plot values less than or equal to 0 will be replaced with this on log scale axes
 #define IMPLOT_LOG_ZERO DBL_MIN
+// Primitives per job when items are tessellated on the worker pool (see SetThreadsCount), must be a multiple of 32
+#define IMPLOT_JOB_PRIMS 16384
+// Most vertices RenderPrimitives reserves at once. Larger items grow the draw list as they emit, so mostly culled ones
+// don't hold capacity for geometry they never draw
+#define IMPLOT_RESERVE_VTX (1 << 22)
 
 //-----------------------------------------------------------------------------
 // [SECTION] Macros
@@ -90,6 +95,10 @@ struct ImPlotItem;
 struct ImPlotLegend;
 struct ImPlotPlot;
 struct ImPlotNextPlotData;
+struct ImPlotWorkerPool;
+
+// Job callback for the worker pool, see RunJobs
+typedef void (*ImPlotJobFunc)(void* user_data, int job);
 
 //-----------------------------------------------------------------------------
 // [SECTION] Context Pointer
@@ -120,12 +129,16 @@ template <typename T>
 static inline T ImRemap01(T x, T x0, T x1) { return (x - x0) / (x1 - x0); }
 // Returns always positive modulo (assumes r != 0)
 static inline int ImPosMod(int l, int r) { return (l % r + r) % r; }
-// Returns true if val is NAN or INFINITY
-static inline bool ImNanOrInf(double val) { return val == HUGE_VAL || val == -HUGE_VAL || isnan(val); }
+// Returns true if val is NAN or INFINITY. Tests the exponent bits, so non-finite inputs are detected without relying on
+// IEEE comparison semantics or isnan()
+static inline bool ImNanOrInf(double val) { ImU64 b; memcpy(&b, &val, sizeof(b)); return (b & 0x7FF0000000000000ull) == 0x7FF0000000000000ull; }
+static inline bool ImNanOrInf(float val)  { ImU32 b; memcpy(&b, &val, sizeof(b)); return (b & 0x7F800000u) == 0x7F800000u; }
+// Returns true if val is NAN (bit test, as above)
+static inline bool ImNan(double val) { ImU64 b; memcpy(&b, &val, sizeof(b)); return (b & 0x7FFFFFFFFFFFFFFFull) > 0x7FF0000000000000ull; }
 // Turns NANs to 0s
-static inline double ImConstrainNan(double val) { return isnan(val) ? 0 : val; }
+static inline double ImConstrainNan(double val) { return ImNan(val) ? 0 : val; }
 // Turns infinity to floating point maximums
-static inline double ImConstrainInf(double val) { return val == HUGE_VAL ?  DBL_MAX : val == -HUGE_VAL ? - DBL_MAX : val; }
+static inline double ImConstrainInf(double val) { return ImNanOrInf(val) && !ImNan(val) ? (val < 0 ? -DBL_MAX : DBL_MAX) : val; }
 // Turns numbers less than or equal to 0 to 0.001 (sort of arbitrary, is there a better way?)
 static inline double ImConstrainLog(double val) { return val <= 0 ? 0.001f : val; }
 // Turns numbers less than 0 to zero
@@ -309,6 +322,13 @@ static inline bool operator<=(const ImPlotTime& lhs, const ImPlotTime& rhs)
 static inline bool operator>=(const ImPlotTime& lhs, const ImPlotTime& rhs)
 { return lhs > rhs || lhs == rhs; }
 
+// Span of time with a constant local UTC offset
+struct ImPlotTimeZoneSpan {
+    time_t Start, End; // UTC seconds, [Start, End)
+    int    Offset;     // local = UTC + Offset seconds
+    bool   Dst;
+};
+
 // Colormap data storage
 struct ImPlotColormapData {
     ImVector<ImU32> Keys;
@@ -545,8 +565,11 @@ struct ImPlotTickCollection {
     ImVec2               MaxSize;
     ImVec2               LateSize;
     int                  Size;
+    const ImPlotTickCollection* Reuse; // previous ticks (ascending) whose labels are reused for equal values, same formatter + font
+    int                  ReuseIdx;
+    int                  ReuseCount;
 
-    ImPlotTickCollection() { Reset(); }
+    ImPlotTickCollection() { LateSize = ImVec2(0,0); Reset(); }
 
     const ImPlotTick& Append(const ImPlotTick& tick) {
         if (tick.ShowLabel) {
@@ -561,15 +584,52 @@ struct ImPlotTickCollection {
     const ImPlotTick& Append(double value, bool major, bool show_label, ImPlotFormatter formatter, void* data) {
         ImPlotTick tick(value, major, show_label);
         if (show_label && formatter != NULL) {
-            char buff[IMPLOT_LABEL_MAX_SIZE];
             tick.TextOffset = TextBuffer.size();
-            formatter(tick.PlotPos, buff, sizeof(buff), data);
-            TextBuffer.append(buff, buff + strlen(buff) + 1);
-            tick.LabelSize = ImGui::CalcTextSize(TextBuffer.Buf.Data + tick.TextOffset);
+            if (const ImPlotTick* reused = FindReusable(value)) {
+                const char* text = Reuse->TextBuffer.Buf.Data + reused->TextOffset;
+                TextBuffer.append(text, text + strlen(text) + 1);
+                tick.LabelSize = reused->LabelSize;
+                ReuseCount++;
+            }
+            else {
+                char buff[IMPLOT_LABEL_MAX_SIZE];
+                formatter(tick.PlotPos, buff, sizeof(buff), data);
+                TextBuffer.append(buff, buff + strlen(buff) + 1);
+                tick.LabelSize = ImGui::CalcTextSize(TextBuffer.Buf.Data + tick.TextOffset);
+            }
         }
         return Append(tick);
     }
 
+    // Appends all ticks of another collection, MaxSize as if they were appended here
+    void Append(const ImPlotTickCollection& other) {
+        const int text_offset = TextBuffer.size();
+        if (other.TextBuffer.size() > 0)
+            TextBuffer.append(other.TextBuffer.Buf.Data, other.TextBuffer.Buf.Data + other.TextBuffer.size());
+        for (int i = 0; i < other.Size; i++) {
+            Ticks.push_back(other.Ticks[i]);
+            if (Ticks.back().TextOffset != -1)
+                Ticks.back().TextOffset += text_offset;
+        }
+        Size += other.Size;
+        OverrideSize(other.MaxSize);
+    }
+
+    // Walks the ascending previous ticks along with ours, values equal to ~1e-12 relative are the same label
+    const ImPlotTick* FindReusable(double value) {
+        if (Reuse == NULL)
+            return NULL;
+        while (ReuseIdx < Reuse->Size) {
+            const ImPlotTick& prev = Reuse->Ticks[ReuseIdx];
+            const double tol = ImMax(ImAbs(prev.PlotPos), ImAbs(value)) * 1e-12;
+            if (prev.PlotPos < value - tol)
+                ReuseIdx++;
+            else
+                return (prev.PlotPos <= value + tol && prev.TextOffset != -1) ? &prev : NULL;
+        }
+        return NULL;
+    }
+
     const char* GetText(int idx) const {
         return TextBuffer.Buf.Data + Ticks[idx].TextOffset;
     }
@@ -590,9 +650,39 @@ struct ImPlotTickCollection {
         MaxSize = LateSize;
         LateSize = ImVec2(0,0);
         Size = 0;
+        Reuse = NULL;
+        ReuseIdx = ReuseCount = 0;
+    }
+
+    void Swap(ImPlotTickCollection& other) {
+        Ticks.swap(other.Ticks);
+        TextBuffer.Buf.swap(other.TextBuffer.Buf);
+        ImSwap(MaxSize, other.MaxSize);
+        ImSwap(LateSize, other.LateSize);
+        ImSwap(Size, other.Size);
     }
 };
 
+// Frame to frame cache of an axis' default ticks. An unchanged axis (range, pixels, scale, formatter, font) copies
+// the last generation, otherwise ticks are regenerated reusing the labels of ticks whose value did not change (pans).
+// Formatters must only depend on the value and their user data for this to hold (see SetupAxisFormat).
+struct ImPlotTickCache {
+    ImPlotTickCollection Ticks;
+    ImPlotTickCollection Scratch;
+    ImPlotRange          Range;
+    float                Pixels;
+    int                  Scale;          // 0 none, 1 linear, 2 log, 3 time
+    int                  TimeStyle;      // UseLocalTime | UseISO8601 << 1 | Use24HourClock << 2
+    ImPlotFormatter      Formatter;
+    void*                FormatterData;
+    char                 FormatSpec[16]; // DefaultFormatter data, compared by value
+    ImFont*              Font;
+    float                FontSize;
+    int                  Hits, Misses, LabelsReused;
+
+    ImPlotTickCache() { Scale = 0; Hits = Misses = LabelsReused = 0; }
+};
+
 // Axis state information that must persist after EndPlot
 struct ImPlotAxis
 {
@@ -601,6 +691,7 @@ struct ImPlotAxis
     ImPlotAxisFlags      PreviousFlags;
     ImPlotCond           RangeCond;
     ImPlotTickCollection Ticks;
+    ImPlotTickCache      TickCache;
     ImPlotRange          Range;
     ImPlotRange          FitExtents;
     ImPlotAxis*          OrthoAxis;
@@ -846,16 +937,37 @@ struct ImPlotAlignmentData {
     void Reset() { PadA = PadB = PadAMax = PadBMax = 0; }
 };
 
+// Nearest point index of a line or scatter item (see SetupNearest)
+struct ImPlotNearestIndex
+{
+    ImGuiID       DataKey;    // data version and first point the index was made for
+    int           Count;      // points indexed so far, data only appended to past them keeps the index
+    ImPlotPoint   Last;       // point Count-1, which appending leaves alone
+    bool          Inc, Dec;   // x never decreases / never increases over the first Count points
+    bool          Sorted;     // x is monotonic, queries binary search the data unless it is too dense near the mouse
+    ImGuiID       GridKey;    // axes and plot rect the grid was built for, 0 once the data changed
+    ImGuiID       PendingKey; // grid key seen last frame, the grid is rebuilt once a new key repeats
+    int           GridCount;  // points bucketed in the grid, points appended since are tested one by one
+    ImRect        Rect;       // grid area, the plot rect grown by the search distance
+    int           Cols, Rows;
+    ImVector<int> CellStart;  // Cols*Rows+1 offsets into Indices
+    ImVector<int> Indices;    // point indices bucketed by cell
+
+    ImPlotNearestIndex() { DataKey = GridKey = PendingKey = 0; Count = GridCount = 0; Inc = Dec = Sorted = false; Cols = Rows = 0; }
+};
+
 // State information for Plot items
 struct ImPlotItem
 {
-    ImGuiID      ID;
-    ImU32        Color;
-    ImRect       LegendHoverRect;
-    int          NameOffset;
-    bool         Show;
-    bool         LegendHovered;
-    bool         SeenThisFrame;
+    ImGuiID            ID;
+    ImU32              Color;
+    ImRect             LegendHoverRect;
+    int                NameOffset;
+    bool               Show;
+    bool               LegendHovered;
+    bool               SeenThisFrame;
+    ImPlotNearestIndex Nearest;
+    ImPlotStats        Stats;
 
     ImPlotItem() {
         ID            = 0;
@@ -878,15 +990,25 @@ struct ImPlotLegend
     ImVector<int>     Indices;
     ImGuiTextBuffer   Labels;
     ImRect            Rect;
+    float             Scroll;     // entries scrolled out of Rect, in pixels along the legend direction
     bool              Hovered;
     bool              Held;
     bool              CanGoInside;
+    bool              Scrollable; // entries did not fit in Rect
+    // layout cache, kept across frames until the legend entries, labels, sorting or font change (see UpdateLegendLayout)
+    ImGuiID           LayoutKey;
+    ImVector<int>     Order;      // legend index of each displayed entry
+    ImVector<float>   Widths;     // label width of each displayed entry
+    ImVector<float>   Offsets;    // start of each displayed entry along the legend direction, spacing included, then the end
+    float             MaxLabelWidth;
 
     ImPlotLegend() {
         Flags        = PreviousFlags = ImPlotLegendFlags_None;
         CanGoInside  = true;
-        Hovered      = Held = false;
+        Hovered      = Held = Scrollable = false;
         Location     = ImPlotLocation_NorthWest;
+        Scroll       = MaxLabelWidth = 0;
+        LayoutKey    = 0;
     }
 
     void Reset() { Indices.shrink(0); Labels.Buf.shrink(0); }
@@ -912,6 +1034,7 @@ struct ImPlotItemGroup
     int         GetLegendCount() const           { return Legend.Indices.size();                                 }
     ImPlotItem* GetLegendItem(int i)             { return ItemPool.GetByIndex(Legend.Indices[i]);                }
     const char* GetLegendLabel(int i)            { return Legend.Labels.Buf.Data + GetLegendItem(i)->NameOffset; }
+    const char* GetItemLabel(ImGuiID id)         { ImPlotItem* item = GetItem(id); return item != NULL && item->NameOffset != -1 ? Legend.Labels.Buf.Data + item->NameOffset : ""; }
     void        Reset()                          { ItemPool.Clear(); Legend.Reset(); ColormapIdx = 0;            }
 };
 
@@ -944,6 +1067,16 @@ struct ImPlotPlot
     bool                 Selecting;
     bool                 Selected;
     bool                 ContextLocked;
+    float                NearestDist;    // SetupNearest max distance in pixels, 0 when queries are off
+    bool                 NearestTooltip;
+    ImGuiID              NearestItem;    // item holding the nearest point this frame, 0 if none
+    int                  NearestIdx;
+    ImPlotPoint          NearestPoint;
+    ImVec2               NearestPos;
+    float                NearestDist2;
+    ImU32                NearestColor;
+    ImAxis               NearestX, NearestY;
+    ImPlotStats          Stats;
 
     ImPlotPlot() {
         Flags             = PreviousFlags = ImPlotFlags_None;
@@ -960,6 +1093,18 @@ struct ImPlotPlot
         JustCreated       = true;
         Initialized = SetupLocked = FitThisFrame = false;
         Hovered = Held = Selected = Selecting = ContextLocked = false;
+        ResetNearest();
+    }
+
+    inline void ResetNearest() {
+        NearestDist    = 0;
+        NearestTooltip = false;
+        NearestItem    = 0;
+        NearestIdx     = -1;
+        NearestDist2   = 0;
+        NearestColor   = 0;
+        NearestX       = ImAxis_X1;
+        NearestY       = ImAxis_Y1;
     }
 
     inline bool IsInputLocked() const {
@@ -1093,6 +1238,9 @@ struct ImPlotNextItemData {
     bool         HasHidden;
     bool         Hidden;
     ImPlotCond   HiddenCond;
+    int          DataVersion;
+    ImVector<ImU32> PointColors; // per point colors sampled from the colormap, see SetNextColormapValues
+    ImVector<float> PointSizes;  // per point marker sizes, see SetNextMarkerSizes
     ImPlotNextItemData() { Reset(); }
     void Reset() {
         for (int i = 0; i < 5; ++i)
@@ -1100,9 +1248,21 @@ struct ImPlotNextItemData {
         LineWeight    = MarkerSize = MarkerWeight = FillAlpha = ErrorBarSize = ErrorBarWeight = DigitalBitHeight = DigitalBitGap = IMPLOT_AUTO;
         Marker        = IMPLOT_AUTO;
         HasHidden     = Hidden = false;
+        DataVersion   = 0;
+        PointColors.resize(0);
+        PointSizes.resize(0);
     }
 };
 
+// Start of a stats measurement: time and draw list sizes
+struct ImPlotStatsMark {
+    double Time;
+    int    VtxCount;
+    int    IdxCount;
+    int    CmdCount;
+    ImPlotStatsMark() { Time = 0; VtxCount = IdxCount = CmdCount = 0; }
+};
+
 // Holds state information that must persist between calls to BeginPlot()/EndPlot()
 struct ImPlotContext {
     // Plot States
@@ -1133,10 +1293,25 @@ struct ImPlotContext {
 
     // Time
     tm Tm;
+    ImVector<ImPlotTimeZoneSpan> TimeZoneSpans;   // local UTC offsets, filled a year at a time from libc (see GetLocTime)
+    int                          TimeZoneSpanIdx;
 
     // Temp data for general use
     ImVector<double>   TempDouble1, TempDouble2;
     ImVector<int>      TempInt1;
+    ImVector<ImVec2>   TempPixels;
+
+    // Parallel tessellation (see SetThreadsCount)
+    ImPlotWorkerPool*     Workers;
+    ImVector<ImDrawList*> JobDrawLists;    // per job scratch geometry
+    ImVector<ImU32>       JobEmitted;      // one bit per primitive, set if it wasn't culled
+
+    // Stats (see SetStatsEnabled)
+    bool               StatsEnabled;
+    bool               StatsOverlay;
+    ImPlotStatsMark    PlotStatsMark;   // taken in BeginPlot
+    ImPlotStatsMark    ItemStatsMark;   // taken in BeginItem
+    ImGuiTextBuffer    StatsCSV;
 
     // Misc
     int                DigitalPlotItemCnt;
@@ -1172,6 +1347,8 @@ IMPLOT_API void ResetCtxForNextPlot(ImPlotContext* ctx);
 IMPLOT_API void ResetCtxForNextAlignedPlots(ImPlotContext* ctx);
 // Resets an ImPlot context for the next call to BeginSubplot
 IMPLOT_API void ResetCtxForNextSubplot(ImPlotContext* ctx);
+// Runs #func for every job in [0,#jobs_count) on the worker pool, the calling thread takes jobs too. Returns once all are done.
+IMPLOT_API void RunJobs(int jobs_count, ImPlotJobFunc func, void* user_data);
 
 //-----------------------------------------------------------------------------
 // [SECTION] Input Utils
@@ -1291,6 +1468,51 @@ static inline bool FitThisFrame() {
     return GImPlot->CurrentPlot->FitThisFrame;
 }
 
+//-----------------------------------------------------------------------------
+// [SECTION] Stats Utils
+//-----------------------------------------------------------------------------
+
+// Returns a monotonic time in milliseconds.
+IMPLOT_API double GetStatsTime();
+// Starts a stats measurement on a draw list.
+IMPLOT_API ImPlotStatsMark GetStatsMark(const ImDrawList* draw_list);
+// Adds the draw list growth and time elapsed since #mark to #stats.
+IMPLOT_API void AddStatsSince(ImPlotStats& stats, const ImPlotStatsMark& mark, const ImDrawList* draw_list);
+
+// Counts data points submitted by the current item.
+static inline void AddItemPoints(int count) {
+    ImPlotContext& gp = *GImPlot;
+    if (gp.StatsEnabled && gp.CurrentItem != NULL) {
+        gp.CurrentItem->Stats.Points += count;
+        gp.CurrentPlot->Stats.Points += count;
+    }
+}
+
+// Counts primitives emitted and culled by the current item.
+static inline void AddItemPrims(int emitted, int culled) {
+    ImPlotContext& gp = *GImPlot;
+    if (gp.StatsEnabled && gp.CurrentItem != NULL) {
+        gp.CurrentItem->Stats.PrimsEmitted += emitted;
+        gp.CurrentItem->Stats.PrimsCulled  += culled;
+        gp.CurrentPlot->Stats.PrimsEmitted += emitted;
+        gp.CurrentPlot->Stats.PrimsCulled  += culled;
+    }
+}
+
+// Times the scope it lives in as fit time of the current item and plot. Declare inside if (FitThisFrame()) blocks.
+struct ImPlotFitTimer {
+    double Start;
+    ImPlotFitTimer() { Start = GImPlot->StatsEnabled ? GetStatsTime() : -1; }
+    ~ImPlotFitTimer() {
+        ImPlotContext& gp = *GImPlot;
+        if (Start < 0 || !gp.StatsEnabled || gp.CurrentItem == NULL)
+            return;
+        const double ms = GetStatsTime() - Start;
+        gp.CurrentItem->Stats.FitTime += ms;
+        gp.CurrentPlot->Stats.FitTime += ms;
+    }
+};
+
 // Extends the current plot's axes so that it encompasses a vertical line at x
 static inline void FitPointX(double x) {
     ImPlotPlot& plot   = *GetCurrentPlot();
@@ -1327,8 +1549,14 @@ IMPLOT_API void ShowAxisContextMenu(ImPlotAxis& axis, ImPlotAxis* equal_axis, bo
 
 // Gets the position of an inner rect that is located inside of an outer rect according to an ImPlotLocation and padding amount.
 IMPLOT_API ImVec2 GetLocationPos(const ImRect& outer_rect, const ImVec2& inner_size, ImPlotLocation location, const ImVec2& pad = ImVec2(0,0));
+// Rebuilds the cached entry order, label widths and offsets of a legend if its entries, labels or layout changed
+IMPLOT_API void UpdateLegendLayout(ImPlotItemGroup& items, const ImVec2& spacing, bool vertical);
 // Calculates the bounding box size of a legend
 IMPLOT_API ImVec2 CalcLegendSize(ImPlotItemGroup& items, const ImVec2& pad, const ImVec2& spacing, bool vertical);
+// Clamps a legend size to fit inside of an outer rect with padding, the entries that do not fit are scrolled
+static inline ImVec2 ClampLegendSize(const ImVec2& legend_size, const ImRect& outer_rect, const ImVec2& pad) {
+    return ImMin(legend_size, ImVec2(ImMax(outer_rect.GetWidth() - pad.x * 2, 0.0f), ImMax(outer_rect.GetHeight() - pad.y * 2, 0.0f)));
+}
 // Renders legend entries into a bounding box
 IMPLOT_API bool ShowLegendEntries(ImPlotItemGroup& items, const ImRect& legend_bb, bool interactable, const ImVec2& pad, const ImVec2& spacing, bool vertical, ImDrawList& DrawList);
 // Shows an alternate legend for the plot identified by #title_id, outside of the plot frame (can be called before or after of Begin/EndPlot but must occur in the same ImGui window!).
@@ -1479,14 +1707,14 @@ static inline int GetDaysInMonth(int year, int month) {
     return  days[month] + (int)(month == 1 && IsLeapYear(year));
 }
 
-// Make a UNIX timestamp from a tm struct expressed in UTC time (i.e. GMT timezone).
+// Make a UNIX timestamp from a tm struct expressed in UTC time (i.e. GMT timezone). Out of range fields are normalized like timegm.
 IMPLOT_API ImPlotTime MkGmtTime(struct tm *ptm);
 // Make a tm struct expressed in UTC time (i.e. GMT timezone) from a UNIX timestamp.
 IMPLOT_API tm* GetGmtTime(const ImPlotTime& t, tm* ptm);
 
-// Make a UNIX timestamp from a tm struct expressed in local time.
+// Make a UNIX timestamp from a tm struct expressed in local time. Needs a current ImPlotContext, which caches the UTC offsets.
 IMPLOT_API ImPlotTime MkLocTime(struct tm *ptm);
-// Make a tm struct expressed in local time from a UNIX timestamp.
+// Make a tm struct expressed in local time from a UNIX timestamp. Needs a current ImPlotContext, which caches the UTC offsets.
 IMPLOT_API tm* GetLocTime(const ImPlotTime& t, tm* ptm);
 
 // NB: The following functions only work if there is a current ImPlotContext because the
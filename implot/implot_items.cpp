@@ -50,6 +50,16 @@
     #define IMPLOT_INLINE inline
 #endif
 
+#ifdef _MSC_VER
+    #define IMPLOT_NOINLINE __declspec(noinline)
+#elif defined(__clang__)
+    #define IMPLOT_NOINLINE __attribute__((__noinline__))
+#elif defined(__GNUC__)
+    #define IMPLOT_NOINLINE __attribute__((__noinline__, __noclone__))
+#else
+    #define IMPLOT_NOINLINE
+#endif
+
 #if defined __SSE__ || defined __x86_64__ || defined _M_X64
 #ifndef IMGUI_ENABLE_SSE
 #include <immintrin.h>
@@ -197,6 +207,14 @@ bool BeginItem(const char* label_id, ImPlotCol recolor_from) {
     // set current item
     gp.CurrentItem = item;
     ImPlotNextItemData& s = gp.NextItemData;
+    // start stats, items submitted more than once a frame accumulate
+    if (gp.StatsEnabled) {
+        if (item->Stats.Frame != ImGui::GetFrameCount()) {
+            item->Stats = ImPlotStats();
+            item->Stats.Frame = ImGui::GetFrameCount();
+        }
+        gp.ItemStatsMark = GetStatsMark(GetPlotDrawList());
+    }
     // set/override item color
     if (recolor_from != -1) {
         if (!IsColorAuto(s.Colors[recolor_from]))
@@ -247,6 +265,8 @@ bool BeginItem(const char* label_id, ImPlotCol recolor_from) {
             if (!ImHasFlag(gp.CurrentItems->Legend.Flags, ImPlotLegendFlags_NoHighlightItem)) {
                 s.LineWeight   *= ITEM_HIGHLIGHT_LINE_SCALE;
                 s.MarkerSize   *= ITEM_HIGHLIGHT_MARK_SCALE;
+                for (int i = 0; i < s.PointSizes.Size; ++i)
+                    s.PointSizes.Data[i] *= ITEM_HIGHLIGHT_MARK_SCALE;
                 s.MarkerWeight *= ITEM_HIGHLIGHT_LINE_SCALE;
                 // TODO: how to highlight fills?
             }
@@ -273,6 +293,14 @@ void EndItem() {
     ImPlotContext& gp = *GImPlot;
     // pop rendering clip rect
     PopPlotClipRect();
+    // finish stats, tessellation is whatever time the item didn't spend fitting
+    ImPlotItem* item = gp.CurrentItem;
+    if (gp.StatsEnabled && item->Stats.Frame == ImGui::GetFrameCount()) {
+        const double tess_time = item->Stats.TessTime;
+        AddStatsSince(item->Stats, gp.ItemStatsMark, GetPlotDrawList());
+        item->Stats.TessTime = item->Stats.TotalTime - item->Stats.FitTime;
+        gp.CurrentPlot->Stats.TessTime += item->Stats.TessTime - tess_time;
+    }
     // reset next item data
     gp.NextItemData.Reset();
     // set current item
@@ -297,6 +325,80 @@ IMPLOT_INLINE T IndexData(const T* data, int idx, int count, int offset, int str
     }
 }
 
+//-----------------------------------------------------------------------------
+// PER POINT STYLE
+//-----------------------------------------------------------------------------
+
+// Maps values to colormap table entries with the index math of LerpTable. The tables hold the ImMixU32 blend between
+// keys already, so sampling is a remap, a clamp and a lookup the compiler can vectorize over the whole array.
+struct ColormapSampler {
+    ColormapSampler(ImPlotColormap cmap, double scale_min, double scale_max) :
+        Table(GImPlot->ColormapData.GetTable(cmap)),
+        Size(GImPlot->ColormapData.GetTableSize(cmap)),
+        Scale(GImPlot->ColormapData.IsQual(cmap) ? (float)Size : (float)(Size - 1)),
+        Bias(GImPlot->ColormapData.IsQual(cmap) ? 0.0f : 0.5f),
+        Min(scale_min),
+        Range(scale_max - scale_min)
+    { }
+    IMPLOT_INLINE ImU32 operator()(double value) const {
+        const double d = (value - Min) / Range;
+        float t = ImNan(d) ? 0.0f : (float)d; // NaN maps to 0, tested explicitly instead of relying on NaN failing the compares below
+        t = t > 0 ? (t < 1 ? t : 1) : 0;
+        return Table[ImMin((int)(t * Scale + Bias), Size - 1)];
+    }
+    const ImU32* Table;
+    const int Size;
+    const float Scale, Bias;
+    const double Min, Range;
+};
+
+template <typename T>
+void SetNextColormapValues(const T* values, int count, double scale_min, double scale_max, int offset, int stride) {
+    ImPlotContext& gp = *GImPlot;
+    ImVector<ImU32>& colors = gp.NextItemData.PointColors;
+    colors.resize(ImMax(count, 0));
+    const ColormapSampler sampler(gp.Style.Colormap, scale_min, scale_max);
+    if (offset == 0 && stride == sizeof(T)) {
+        for (int i = 0; i < count; ++i)
+            colors.Data[i] = sampler((double)values[i]);
+    }
+    else {
+        for (int i = 0; i < count; ++i)
+            colors.Data[i] = sampler((double)IndexData(values, i, count, offset, stride));
+    }
+}
+
+template IMPLOT_API void SetNextColormapValues<ImS8>(const ImS8* values, int count, double scale_min, double scale_max, int offset, int stride);
+template IMPLOT_API void SetNextColormapValues<ImU8>(const ImU8* values, int count, double scale_min, double scale_max, int offset, int stride);
+template IMPLOT_API void SetNextColormapValues<ImS16>(const ImS16* values, int count, double scale_min, double scale_max, int offset, int stride);
+template IMPLOT_API void SetNextColormapValues<ImU16>(const ImU16* values, int count, double scale_min, double scale_max, int offset, int stride);
+template IMPLOT_API void SetNextColormapValues<ImS32>(const ImS32* values, int count, double scale_min, double scale_max, int offset, int stride);
+template IMPLOT_API void SetNextColormapValues<ImU32>(const ImU32* values, int count, double scale_min, double scale_max, int offset, int stride);
+template IMPLOT_API void SetNextColormapValues<ImS64>(const ImS64* values, int count, double scale_min, double scale_max, int offset, int stride);
+template IMPLOT_API void SetNextColormapValues<ImU64>(const ImU64* values, int count, double scale_min, double scale_max, int offset, int stride);
+template IMPLOT_API void SetNextColormapValues<float>(const float* values, int count, double scale_min, double scale_max, int offset, int stride);
+template IMPLOT_API void SetNextColormapValues<double>(const double* values, int count, double scale_min, double scale_max, int offset, int stride);
+
+template <typename T>
+void SetNextMarkerSizes(const T* sizes, int count, int offset, int stride) {
+    ImPlotContext& gp = *GImPlot;
+    ImVector<float>& out = gp.NextItemData.PointSizes;
+    out.resize(ImMax(count, 0));
+    for (int i = 0; i < count; ++i)
+        out.Data[i] = (float)IndexData(sizes, i, count, offset, stride);
+}
+
+template IMPLOT_API void SetNextMarkerSizes<ImS8>(const ImS8* sizes, int count, int offset, int stride);
+template IMPLOT_API void SetNextMarkerSizes<ImU8>(const ImU8* sizes, int count, int offset, int stride);
+template IMPLOT_API void SetNextMarkerSizes<ImS16>(const ImS16* sizes, int count, int offset, int stride);
+template IMPLOT_API void SetNextMarkerSizes<ImU16>(const ImU16* sizes, int count, int offset, int stride);
+template IMPLOT_API void SetNextMarkerSizes<ImS32>(const ImS32* sizes, int count, int offset, int stride);
+template IMPLOT_API void SetNextMarkerSizes<ImU32>(const ImU32* sizes, int count, int offset, int stride);
+template IMPLOT_API void SetNextMarkerSizes<ImS64>(const ImS64* sizes, int count, int offset, int stride);
+template IMPLOT_API void SetNextMarkerSizes<ImU64>(const ImU64* sizes, int count, int offset, int stride);
+template IMPLOT_API void SetNextMarkerSizes<float>(const float* sizes, int count, int offset, int stride);
+template IMPLOT_API void SetNextMarkerSizes<double>(const double* sizes, int count, int offset, int stride);
+
 //-----------------------------------------------------------------------------
 // GETTERS
 //-----------------------------------------------------------------------------
@@ -418,6 +520,87 @@ struct GetterFuncPtr {
     const int Count;
 };
 
+// Returns log2(v) if v is a power of two, -1 otherwise
+static inline int PowerOfTwoShift(int v) {
+    if (v <= 0 || (v & (v - 1)) != 0)
+        return -1;
+    int shift = 0;
+    while ((1 << shift) < v)
+        ++shift;
+    return shift;
+}
+
+/// Reads ImPlotColumn elements in place as doubles, nulls as NaN (segments and markers touching NaN are culled)
+struct ColumnReader {
+    ColumnReader(const ImPlotColumn& column) :
+        Column(column),
+        Shift(PowerOfTwoShift(column.BlockSize))
+    { }
+    template <typename I> IMPLOT_INLINE double operator()(I idx) const {
+        // power of two block sizes (the usual chunk sizes) avoid a division per element
+        const int blk = Shift >= 0 ? (int)idx >> Shift : (int)idx / Column.BlockSize;
+        const int k   = (int)idx - blk * Column.BlockSize;
+        const ImU8* valid = Column.Validity != NULL ? Column.Validity[blk] : NULL;
+        if (valid != NULL && (valid[k >> 3] & (1 << (k & 7))) == 0)
+            return NAN;
+        const void* block = Column.Blocks[blk];
+        double v;
+        switch (Column.Type) {
+            case ImGuiDataType_S8:     v = (double)(((const ImS8*)block)[k]  - Column.Origin); break;
+            case ImGuiDataType_U8:     v = (double)(((const ImU8*)block)[k]  - Column.Origin); break;
+            case ImGuiDataType_S16:    v = (double)(((const ImS16*)block)[k] - Column.Origin); break;
+            case ImGuiDataType_U16:    v = (double)(((const ImU16*)block)[k] - Column.Origin); break;
+            case ImGuiDataType_S32:    v = (double)(((const ImS32*)block)[k] - Column.Origin); break;
+            case ImGuiDataType_U32:    v = (double)(((const ImU32*)block)[k] - Column.Origin); break;
+            // differences in unsigned math, so neither the subtraction nor the conversion of a timestamp loses precision
+            case ImGuiDataType_S64:    v = (double)(ImS64)((ImU64)((const ImS64*)block)[k] - (ImU64)Column.Origin); break;
+            case ImGuiDataType_U64: {
+                const ImU64 u = ((const ImU64*)block)[k], o = (ImU64)Column.Origin;
+                v = u >= o ? (double)(u - o) : -(double)(o - u);
+                break;
+            }
+            case ImGuiDataType_Float:  v = (double)((const float*)block)[k] - (double)Column.Origin; break;
+            case ImGuiDataType_Double: v = ((const double*)block)[k] - (double)Column.Origin; break;
+            default:                   v = 0; break;
+        }
+        return Column.Offset + v * Column.Scale;
+    }
+    const ImPlotColumn& Column;
+    const int Shift;
+};
+
+/// Interprets an ImPlotColumn of Y values as ImPlotPoints where the X value is the index
+struct GetterColumnY {
+    GetterColumnY(const ImPlotColumn& ys, double xscale, double x0) :
+        Ys(ys),
+        XScale(xscale),
+        X0(x0),
+        Count(ys.Count)
+    { }
+    template <typename I> IMPLOT_INLINE ImPlotPoint operator()(I idx) const {
+        return ImPlotPoint(X0 + XScale * idx, Ys(idx));
+    }
+    const ColumnReader Ys;
+    const double XScale;
+    const double X0;
+    const int Count;
+};
+
+/// Interprets ImPlotColumns of X and Y values as ImPlotPoints
+struct GetterColumnXY {
+    GetterColumnXY(const ImPlotColumn& xs, const ImPlotColumn& ys) :
+        Xs(xs),
+        Ys(ys),
+        Count(ImMin(xs.Count, ys.Count))
+    { }
+    template <typename I> IMPLOT_INLINE ImPlotPoint operator()(I idx) const {
+        return ImPlotPoint(Xs(idx), Ys(idx));
+    }
+    const ColumnReader Xs;
+    const ColumnReader Ys;
+    const int Count;
+};
+
 template <typename T>
 struct GetterBarV {
     const T* Ys; double XShift; int Count; int Offset; int Stride;
@@ -524,28 +707,48 @@ typedef TransformerXY<TransformerLog,TransformerLog> TransformerLogLog;
 // PRIMITIVE RENDERERS
 //-----------------------------------------------------------------------------
 
-IMPLOT_INLINE void PrimLine(const ImVec2& P1, const ImVec2& P2, float half_weight, ImU32 col, ImDrawList& DrawList, ImVec2 uv) {
+// True if a pixel is NaN or infinite (e.g. an ImPlotColumn null). A bit test, culling doesn't rely on NaN failing comparisons.
+IMPLOT_INLINE bool PixelNanOrInf(const ImVec2& P) {
+    return ImNanOrInf(P.x) || ImNanOrInf(P.y);
+}
+
+// Culling bounds of a segment. A segment touching a NaN/Inf endpoint gets inverted bounds that overlap nothing, so line
+// strips break at gaps instead of emitting NaN vertices.
+IMPLOT_INLINE ImRect SegmentBounds(const ImVec2& P1, const ImVec2& P2) {
+    if (PixelNanOrInf(P1) || PixelNanOrInf(P2))
+        return ImRect(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+    return ImRect(ImMin(P1, P2), ImMax(P1, P2));
+}
+
+// Compact vertices (IMGUI_USE_COMPACT_DRAWVERT) clamp each coordinate to IMGUI_COMPACT_DRAWVERT_POS_MAX around the draw
+// list VtxOrigin, which would change the slope of a segment with a far endpoint (e.g. zoomed in lines). Clips such segments
+// to that range, less #margin for the line width. Segments missing it entirely collapse to a point. No-op otherwise.
+IMPLOT_INLINE void ClipSegmentToVtxRange(const ImDrawList& DrawList, ImVec2& P1, ImVec2& P2, float margin) {
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    const float range = IMGUI_COMPACT_DRAWVERT_POS_MAX - margin;
+    const ImVec2 r_min(DrawList.VtxOrigin.x - range, DrawList.VtxOrigin.y - range);
+    const ImVec2 r_max(DrawList.VtxOrigin.x + range, DrawList.VtxOrigin.y + range);
+    if (P1.x >= r_min.x && P1.y >= r_min.y && P1.x <= r_max.x && P1.y <= r_max.y &&
+        P2.x >= r_min.x && P2.y >= r_min.y && P2.x <= r_max.x && P2.y <= r_max.y)
+        return;
+    if (!ImLineClipToRect(P1, P2, r_min, r_max))
+        P1 = P2 = ImClamp(P1, r_min, r_max);
+#else
+    IM_UNUSED(DrawList); IM_UNUSED(P1); IM_UNUSED(P2); IM_UNUSED(margin);
+#endif
+}
+
+IMPLOT_INLINE void PrimLine(ImVec2 P1, ImVec2 P2, float half_weight, ImU32 col, ImDrawList& DrawList, ImVec2 uv) {
+    ClipSegmentToVtxRange(DrawList, P1, P2, half_weight + 1);
     float dx = P2.x - P1.x;
     float dy = P2.y - P1.y;
     IMPLOT_NORMALIZE2F_OVER_ZERO(dx, dy);
     dx *= half_weight;
     dy *= half_weight;
-    DrawList._VtxWritePtr[0].pos.x = P1.x + dy;
-    DrawList._VtxWritePtr[0].pos.y = P1.y - dx;
-    DrawList._VtxWritePtr[0].uv    = uv;
-    DrawList._VtxWritePtr[0].col   = col;
-    DrawList._VtxWritePtr[1].pos.x = P2.x + dy;
-    DrawList._VtxWritePtr[1].pos.y = P2.y - dx;
-    DrawList._VtxWritePtr[1].uv    = uv;
-    DrawList._VtxWritePtr[1].col   = col;
-    DrawList._VtxWritePtr[2].pos.x = P2.x - dy;
-    DrawList._VtxWritePtr[2].pos.y = P2.y + dx;
-    DrawList._VtxWritePtr[2].uv    = uv;
-    DrawList._VtxWritePtr[2].col   = col;
-    DrawList._VtxWritePtr[3].pos.x = P1.x - dy;
-    DrawList._VtxWritePtr[3].pos.y = P1.y + dx;
-    DrawList._VtxWritePtr[3].uv    = uv;
-    DrawList._VtxWritePtr[3].col   = col;
+    DrawList.SetVtx(&DrawList._VtxWritePtr[0], ImVec2(P1.x + dy, P1.y - dx), uv, col);
+    DrawList.SetVtx(&DrawList._VtxWritePtr[1], ImVec2(P2.x + dy, P2.y - dx), uv, col);
+    DrawList.SetVtx(&DrawList._VtxWritePtr[2], ImVec2(P2.x - dy, P2.y + dx), uv, col);
+    DrawList.SetVtx(&DrawList._VtxWritePtr[3], ImVec2(P1.x - dy, P1.y + dx), uv, col);
     DrawList._VtxWritePtr += 4;
     DrawList._IdxWritePtr[0] = (ImDrawIdx)(DrawList._VtxCurrentIdx);
     DrawList._IdxWritePtr[1] = (ImDrawIdx)(DrawList._VtxCurrentIdx + 1);
@@ -558,20 +761,10 @@ IMPLOT_INLINE void PrimLine(const ImVec2& P1, const ImVec2& P2, float half_weigh
 }
 
 IMPLOT_INLINE void PrimRectFilled(const ImVec2& Pmin, const ImVec2& Pmax, ImU32 col, ImDrawList& DrawList, ImVec2 uv) {
-    DrawList._VtxWritePtr[0].pos   = Pmin;
-    DrawList._VtxWritePtr[0].uv    = uv;
-    DrawList._VtxWritePtr[0].col   = col;
-    DrawList._VtxWritePtr[1].pos   = Pmax;
-    DrawList._VtxWritePtr[1].uv    = uv;
-    DrawList._VtxWritePtr[1].col   = col;
-    DrawList._VtxWritePtr[2].pos.x = Pmin.x;
-    DrawList._VtxWritePtr[2].pos.y = Pmax.y;
-    DrawList._VtxWritePtr[2].uv    = uv;
-    DrawList._VtxWritePtr[2].col   = col;
-    DrawList._VtxWritePtr[3].pos.x = Pmax.x;
-    DrawList._VtxWritePtr[3].pos.y = Pmin.y;
-    DrawList._VtxWritePtr[3].uv    = uv;
-    DrawList._VtxWritePtr[3].col   = col;
+    DrawList.SetVtx(&DrawList._VtxWritePtr[0], Pmin, uv, col);
+    DrawList.SetVtx(&DrawList._VtxWritePtr[1], Pmax, uv, col);
+    DrawList.SetVtx(&DrawList._VtxWritePtr[2], ImVec2(Pmin.x, Pmax.y), uv, col);
+    DrawList.SetVtx(&DrawList._VtxWritePtr[3], ImVec2(Pmax.x, Pmin.y), uv, col);
     DrawList._VtxWritePtr += 4;
     DrawList._IdxWritePtr[0] = (ImDrawIdx)(DrawList._VtxCurrentIdx);
     DrawList._IdxWritePtr[1] = (ImDrawIdx)(DrawList._VtxCurrentIdx + 1);
@@ -583,6 +776,162 @@ IMPLOT_INLINE void PrimRectFilled(const ImVec2& Pmin, const ImVec2& Pmax, ImU32
     DrawList._VtxCurrentIdx += 4;
 }
 
+// Anti-aliased line primitives. Each emits the geometry ImDrawList::AddLine generates for one segment (the open two
+// point case of ImDrawList::AddPolyline), so segments batched through RenderPrimitives look the same as AddLine calls.
+
+enum LineAAMode {
+    LineAAMode_None,  // plot or draw list isn't anti-aliasing lines
+    LineAAMode_Tex,   // integer weights, baked line texture from the font atlas
+    LineAAMode_Thin,  // weights up to one fringe, no opaque core
+    LineAAMode_Thick  // opaque core plus fringes
+};
+
+// Returns the ImDrawList::AddPolyline path a line of #weight takes when the current plot anti-aliases lines
+IMPLOT_INLINE LineAAMode GetLineAAMode(const ImDrawList& DrawList, float weight) {
+    ImPlotContext& gp = *GImPlot;
+    if (!ImHasFlag(gp.CurrentPlot->Flags, ImPlotFlags_AntiAliased) && !gp.Style.AntiAliasedLines)
+        return LineAAMode_None;
+    if (!(DrawList.Flags & ImDrawListFlags_AntiAliasedLines))
+        return LineAAMode_None;
+    const bool thick = weight > DrawList._FringeScale;
+    weight = ImMax(weight, 1.0f);
+    const int integer_weight = (int)weight;
+    if ((DrawList.Flags & ImDrawListFlags_AntiAliasedLinesUseTex) && integer_weight < IM_DRAWLIST_TEX_LINES_WIDTH_MAX && weight - integer_weight <= 0.00001f && DrawList._FringeScale == 1.0f)
+        return LineAAMode_Tex;
+    return thick ? LineAAMode_Thick : LineAAMode_Thin;
+}
+
+// Segment normals as AddPolyline computes them: N1 at the start, N2 averaged and fixed up at the end
+IMPLOT_INLINE void LineAANormals(const ImVec2& P1, const ImVec2& P2, ImVec2& N1, ImVec2& N2) {
+    float dx = P2.x - P1.x;
+    float dy = P2.y - P1.y;
+    float d2 = dx * dx + dy * dy;
+    if (d2 > 0.0f) {
+        const float inv_len = ImRsqrt(d2);
+        dx *= inv_len;
+        dy *= inv_len;
+    }
+    N1 = ImVec2(dy, -dx);
+    N2 = N1;
+    d2 = N2.x * N2.x + N2.y * N2.y;
+    if (d2 > 0.000001f) {
+        const float inv_len2 = ImMin(1.0f / d2, 100.0f);
+        N2.x *= inv_len2;
+        N2.y *= inv_len2;
+    }
+}
+
+struct PrimLineAATex {
+    PrimLineAATex(const ImDrawList& DrawList, float weight, ImU32 col) : Col(col) {
+        weight = ImMax(weight, 1.0f);
+        const ImVec4 uvs = DrawList._Data->TexUvLines[(int)weight];
+        UV1 = ImVec2(uvs.x, uvs.y);
+        UV2 = ImVec2(uvs.z, uvs.w);
+        HalfSize = weight * 0.5f + 1;
+    }
+    IMPLOT_INLINE void operator()(ImDrawList& DrawList, ImVec2 P1, ImVec2 P2) const {
+        P1 += ImVec2(0.5f, 0.5f);
+        P2 += ImVec2(0.5f, 0.5f);
+        ClipSegmentToVtxRange(DrawList, P1, P2, HalfSize + 1);
+        ImVec2 N1, N2;
+        LineAANormals(P1, P2, N1, N2);
+        N2 *= HalfSize;
+        DrawList.SetVtx(&DrawList._VtxWritePtr[0], P1 + N1 * HalfSize, UV1, Col);
+        DrawList.SetVtx(&DrawList._VtxWritePtr[1], P1 - N1 * HalfSize, UV2, Col);
+        DrawList.SetVtx(&DrawList._VtxWritePtr[2], P2 + N2, UV1, Col);
+        DrawList.SetVtx(&DrawList._VtxWritePtr[3], P2 - N2, UV2, Col);
+        DrawList._VtxWritePtr += 4;
+        const unsigned int i = DrawList._VtxCurrentIdx;
+        DrawList._IdxWritePtr[0] = (ImDrawIdx)(i + 2); DrawList._IdxWritePtr[1] = (ImDrawIdx)(i + 0); DrawList._IdxWritePtr[2] = (ImDrawIdx)(i + 1);
+        DrawList._IdxWritePtr[3] = (ImDrawIdx)(i + 3); DrawList._IdxWritePtr[4] = (ImDrawIdx)(i + 1); DrawList._IdxWritePtr[5] = (ImDrawIdx)(i + 2);
+        DrawList._IdxWritePtr += 6;
+        DrawList._VtxCurrentIdx += 4;
+    }
+    ImU32 Col;
+    ImVec2 UV1, UV2;
+    float HalfSize;
+    static const int IdxConsumed = 6;
+    static const int VtxConsumed = 4;
+};
+
+struct PrimLineAAThin {
+    PrimLineAAThin(const ImDrawList& DrawList, float, ImU32 col) :
+        Col(col),
+        ColTrans(col & ~IM_COL32_A_MASK),
+        UV(DrawList._Data->TexUvWhitePixel),
+        AASize(DrawList._FringeScale)
+    { }
+    IMPLOT_INLINE void operator()(ImDrawList& DrawList, ImVec2 P1, ImVec2 P2) const {
+        P1 += ImVec2(0.5f, 0.5f);
+        P2 += ImVec2(0.5f, 0.5f);
+        ClipSegmentToVtxRange(DrawList, P1, P2, AASize + 1);
+        ImVec2 N1, N2;
+        LineAANormals(P1, P2, N1, N2);
+        N2 *= AASize;
+        DrawList.SetVtx(&DrawList._VtxWritePtr[0], P1, UV, Col);
+        DrawList.SetVtx(&DrawList._VtxWritePtr[1], P1 + N1 * AASize, UV, ColTrans);
+        DrawList.SetVtx(&DrawList._VtxWritePtr[2], P1 - N1 * AASize, UV, ColTrans);
+        DrawList.SetVtx(&DrawList._VtxWritePtr[3], P2, UV, Col);
+        DrawList.SetVtx(&DrawList._VtxWritePtr[4], P2 + N2, UV, ColTrans);
+        DrawList.SetVtx(&DrawList._VtxWritePtr[5], P2 - N2, UV, ColTrans);
+        DrawList._VtxWritePtr += 6;
+        const unsigned int i = DrawList._VtxCurrentIdx;
+        DrawList._IdxWritePtr[0] = (ImDrawIdx)(i + 3); DrawList._IdxWritePtr[1]  = (ImDrawIdx)(i + 0); DrawList._IdxWritePtr[2]  = (ImDrawIdx)(i + 2);
+        DrawList._IdxWritePtr[3] = (ImDrawIdx)(i + 2); DrawList._IdxWritePtr[4]  = (ImDrawIdx)(i + 5); DrawList._IdxWritePtr[5]  = (ImDrawIdx)(i + 3);
+        DrawList._IdxWritePtr[6] = (ImDrawIdx)(i + 4); DrawList._IdxWritePtr[7]  = (ImDrawIdx)(i + 1); DrawList._IdxWritePtr[8]  = (ImDrawIdx)(i + 0);
+        DrawList._IdxWritePtr[9] = (ImDrawIdx)(i + 0); DrawList._IdxWritePtr[10] = (ImDrawIdx)(i + 3); DrawList._IdxWritePtr[11] = (ImDrawIdx)(i + 4);
+        DrawList._IdxWritePtr += 12;
+        DrawList._VtxCurrentIdx += 6;
+    }
+    ImU32 Col, ColTrans;
+    ImVec2 UV;
+    float AASize;
+    static const int IdxConsumed = 12;
+    static const int VtxConsumed = 6;
+};
+
+struct PrimLineAAThick {
+    PrimLineAAThick(const ImDrawList& DrawList, float weight, ImU32 col) :
+        Col(col),
+        ColTrans(col & ~IM_COL32_A_MASK),
+        UV(DrawList._Data->TexUvWhitePixel),
+        HalfInner((ImMax(weight, 1.0f) - DrawList._FringeScale) * 0.5f),
+        HalfOuter(HalfInner + DrawList._FringeScale)
+    { }
+    IMPLOT_INLINE void operator()(ImDrawList& DrawList, ImVec2 P1, ImVec2 P2) const {
+        P1 += ImVec2(0.5f, 0.5f);
+        P2 += ImVec2(0.5f, 0.5f);
+        ClipSegmentToVtxRange(DrawList, P1, P2, HalfOuter + 1);
+        ImVec2 N1, N2;
+        LineAANormals(P1, P2, N1, N2);
+        const ImVec2 out2 = N2 * HalfOuter;
+        const ImVec2 in2  = N2 * HalfInner;
+        DrawList.SetVtx(&DrawList._VtxWritePtr[0], P1 + N1 * HalfOuter, UV, ColTrans);
+        DrawList.SetVtx(&DrawList._VtxWritePtr[1], P1 + N1 * HalfInner, UV, Col);
+        DrawList.SetVtx(&DrawList._VtxWritePtr[2], P1 - N1 * HalfInner, UV, Col);
+        DrawList.SetVtx(&DrawList._VtxWritePtr[3], P1 - N1 * HalfOuter, UV, ColTrans);
+        DrawList.SetVtx(&DrawList._VtxWritePtr[4], P2 + out2, UV, ColTrans);
+        DrawList.SetVtx(&DrawList._VtxWritePtr[5], P2 + in2, UV, Col);
+        DrawList.SetVtx(&DrawList._VtxWritePtr[6], P2 - in2, UV, Col);
+        DrawList.SetVtx(&DrawList._VtxWritePtr[7], P2 - out2, UV, ColTrans);
+        DrawList._VtxWritePtr += 8;
+        const unsigned int i = DrawList._VtxCurrentIdx;
+        DrawList._IdxWritePtr[0]  = (ImDrawIdx)(i + 5); DrawList._IdxWritePtr[1]  = (ImDrawIdx)(i + 1); DrawList._IdxWritePtr[2]  = (ImDrawIdx)(i + 2);
+        DrawList._IdxWritePtr[3]  = (ImDrawIdx)(i + 2); DrawList._IdxWritePtr[4]  = (ImDrawIdx)(i + 6); DrawList._IdxWritePtr[5]  = (ImDrawIdx)(i + 5);
+        DrawList._IdxWritePtr[6]  = (ImDrawIdx)(i + 5); DrawList._IdxWritePtr[7]  = (ImDrawIdx)(i + 1); DrawList._IdxWritePtr[8]  = (ImDrawIdx)(i + 0);
+        DrawList._IdxWritePtr[9]  = (ImDrawIdx)(i + 0); DrawList._IdxWritePtr[10] = (ImDrawIdx)(i + 4); DrawList._IdxWritePtr[11] = (ImDrawIdx)(i + 5);
+        DrawList._IdxWritePtr[12] = (ImDrawIdx)(i + 6); DrawList._IdxWritePtr[13] = (ImDrawIdx)(i + 2); DrawList._IdxWritePtr[14] = (ImDrawIdx)(i + 3);
+        DrawList._IdxWritePtr[15] = (ImDrawIdx)(i + 3); DrawList._IdxWritePtr[16] = (ImDrawIdx)(i + 7); DrawList._IdxWritePtr[17] = (ImDrawIdx)(i + 6);
+        DrawList._IdxWritePtr += 18;
+        DrawList._VtxCurrentIdx += 8;
+    }
+    ImU32 Col, ColTrans;
+    ImVec2 UV;
+    float HalfInner, HalfOuter;
+    static const int IdxConsumed = 18;
+    static const int VtxConsumed = 8;
+};
+
 template <typename TGetter, typename TTransformer>
 struct LineStripRenderer {
     IMPLOT_INLINE LineStripRenderer(const TGetter& getter, const TTransformer& transformer, ImU32 col, float weight) :
@@ -594,9 +943,12 @@ struct LineStripRenderer {
     {
         P1 = Transformer(Getter(0));
     }
+    IMPLOT_INLINE void Seek(int prim) const {
+        P1 = Transformer(Getter(prim));
+    }
     IMPLOT_INLINE bool operator()(ImDrawList& DrawList, const ImRect& cull_rect, const ImVec2& uv, int prim) const {
         ImVec2 P2 = Transformer(Getter(prim + 1));
-        if (!cull_rect.Overlaps(ImRect(ImMin(P1, P2), ImMax(P1, P2)))) {
+        if (!cull_rect.Overlaps(SegmentBounds(P1, P2))) {
             P1 = P2;
             return false;
         }
@@ -624,10 +976,11 @@ struct LineSegmentsRenderer {
         Col(col),
         HalfWeight(weight/2)
     {}
+    IMPLOT_INLINE void Seek(int) const { }
     IMPLOT_INLINE bool operator()(ImDrawList& DrawList, const ImRect& cull_rect, const ImVec2& uv, int prim) const {
         ImVec2 P1 = Transformer(Getter1(prim));
         ImVec2 P2 = Transformer(Getter2(prim));
-        if (!cull_rect.Overlaps(ImRect(ImMin(P1, P2), ImMax(P1, P2))))
+        if (!cull_rect.Overlaps(SegmentBounds(P1, P2)))
             return false;
         PrimLine(P1,P2,HalfWeight,Col,DrawList,uv);
         return true;
@@ -653,9 +1006,12 @@ struct StairsRenderer {
     {
         P1 = Transformer(Getter(0));
     }
+    IMPLOT_INLINE void Seek(int prim) const {
+        P1 = Transformer(Getter(prim));
+    }
     IMPLOT_INLINE bool operator()(ImDrawList& DrawList, const ImRect& cull_rect, const ImVec2& uv, int prim) const {
         ImVec2 P2 = Transformer(Getter(prim + 1));
-        if (!cull_rect.Overlaps(ImRect(ImMin(P1, P2), ImMax(P1, P2)))) {
+        if (!cull_rect.Overlaps(SegmentBounds(P1, P2))) {
             P1 = P2;
             return false;
         }
@@ -674,6 +1030,98 @@ struct StairsRenderer {
     static const int VtxConsumed = 8;
 };
 
+template <typename TGetter, typename TTransformer, typename TPrim>
+struct LineStripRendererAA {
+    IMPLOT_INLINE LineStripRendererAA(const TGetter& getter, const TTransformer& transformer, const TPrim& line) :
+        Getter(getter),
+        Transformer(transformer),
+        Prims(Getter.Count - 1),
+        Line(line)
+    {
+        P1 = Transformer(Getter(0));
+    }
+    IMPLOT_INLINE void Seek(int prim) const {
+        P1 = Transformer(Getter(prim));
+    }
+    IMPLOT_INLINE bool operator()(ImDrawList& DrawList, const ImRect& cull_rect, const ImVec2&, int prim) const {
+        ImVec2 P2 = Transformer(Getter(prim + 1));
+        if (!cull_rect.Overlaps(SegmentBounds(P1, P2))) {
+            P1 = P2;
+            return false;
+        }
+        Line(DrawList, P1, P2);
+        P1 = P2;
+        return true;
+    }
+    const TGetter& Getter;
+    const TTransformer& Transformer;
+    const int Prims;
+    const TPrim Line;
+    mutable ImVec2 P1;
+    static const int IdxConsumed = TPrim::IdxConsumed;
+    static const int VtxConsumed = TPrim::VtxConsumed;
+};
+
+template <typename TGetter1, typename TGetter2, typename TTransformer, typename TPrim>
+struct LineSegmentsRendererAA {
+    IMPLOT_INLINE LineSegmentsRendererAA(const TGetter1& getter1, const TGetter2& getter2, const TTransformer& transformer, const TPrim& line) :
+        Getter1(getter1),
+        Getter2(getter2),
+        Transformer(transformer),
+        Prims(ImMin(Getter1.Count, Getter2.Count)),
+        Line(line)
+    {}
+    IMPLOT_INLINE void Seek(int) const { }
+    IMPLOT_INLINE bool operator()(ImDrawList& DrawList, const ImRect& cull_rect, const ImVec2&, int prim) const {
+        ImVec2 P1 = Transformer(Getter1(prim));
+        ImVec2 P2 = Transformer(Getter2(prim));
+        if (!cull_rect.Overlaps(SegmentBounds(P1, P2)))
+            return false;
+        Line(DrawList, P1, P2);
+        return true;
+    }
+    const TGetter1& Getter1;
+    const TGetter2& Getter2;
+    const TTransformer& Transformer;
+    const int Prims;
+    const TPrim Line;
+    static const int IdxConsumed = TPrim::IdxConsumed;
+    static const int VtxConsumed = TPrim::VtxConsumed;
+};
+
+template <typename TGetter, typename TTransformer, typename TPrim>
+struct StairsRendererAA {
+    IMPLOT_INLINE StairsRendererAA(const TGetter& getter, const TTransformer& transformer, const TPrim& line) :
+        Getter(getter),
+        Transformer(transformer),
+        Prims(Getter.Count - 1),
+        Line(line)
+    {
+        P1 = Transformer(Getter(0));
+    }
+    IMPLOT_INLINE void Seek(int prim) const {
+        P1 = Transformer(Getter(prim));
+    }
+    IMPLOT_INLINE bool operator()(ImDrawList& DrawList, const ImRect& cull_rect, const ImVec2&, int prim) const {
+        ImVec2 P2 = Transformer(Getter(prim + 1));
+        if (!cull_rect.Overlaps(SegmentBounds(P1, P2))) {
+            P1 = P2;
+            return false;
+        }
+        const ImVec2 P12(P2.x, P1.y);
+        Line(DrawList, P1, P12);
+        Line(DrawList, P12, P2);
+        P1 = P2;
+        return true;
+    }
+    const TGetter& Getter;
+    const TTransformer& Transformer;
+    const int Prims;
+    const TPrim Line;
+    mutable ImVec2 P1;
+    static const int IdxConsumed = 2 * TPrim::IdxConsumed;
+    static const int VtxConsumed = 2 * TPrim::VtxConsumed;
+};
 
 
 template <typename TGetter1, typename TGetter2, typename TTransformer>
@@ -689,6 +1137,11 @@ struct ShadedRenderer {
         P12 = Transformer(Getter2(0));
     }
 
+    IMPLOT_INLINE void Seek(int prim) const {
+        P11 = Transformer(Getter1(prim));
+        P12 = Transformer(Getter2(prim));
+    }
+
     IMPLOT_INLINE bool operator()(ImDrawList& DrawList, const ImRect& cull_rect, const ImVec2& uv, int prim) const {
         ImVec2 P21 = Transformer(Getter1(prim+1));
         ImVec2 P22 = Transformer(Getter2(prim+1));
@@ -700,21 +1153,11 @@ struct ShadedRenderer {
         }
         const int intersect = (P11.y > P12.y && P22.y > P21.y) || (P12.y > P11.y && P21.y > P22.y);
         ImVec2 intersection = Intersection(P11,P21,P12,P22);
-        DrawList._VtxWritePtr[0].pos = P11;
-        DrawList._VtxWritePtr[0].uv  = uv;
-        DrawList._VtxWritePtr[0].col = Col;
-        DrawList._VtxWritePtr[1].pos = P21;
-        DrawList._VtxWritePtr[1].uv  = uv;
-        DrawList._VtxWritePtr[1].col = Col;
-        DrawList._VtxWritePtr[2].pos = intersection;
-        DrawList._VtxWritePtr[2].uv  = uv;
-        DrawList._VtxWritePtr[2].col = Col;
-        DrawList._VtxWritePtr[3].pos = P12;
-        DrawList._VtxWritePtr[3].uv  = uv;
-        DrawList._VtxWritePtr[3].col = Col;
-        DrawList._VtxWritePtr[4].pos = P22;
-        DrawList._VtxWritePtr[4].uv  = uv;
-        DrawList._VtxWritePtr[4].col = Col;
+        DrawList.SetVtx(&DrawList._VtxWritePtr[0], P11, uv, Col);
+        DrawList.SetVtx(&DrawList._VtxWritePtr[1], P21, uv, Col);
+        DrawList.SetVtx(&DrawList._VtxWritePtr[2], intersection, uv, Col);
+        DrawList.SetVtx(&DrawList._VtxWritePtr[3], P12, uv, Col);
+        DrawList.SetVtx(&DrawList._VtxWritePtr[4], P22, uv, Col);
         DrawList._VtxWritePtr += 5;
         DrawList._IdxWritePtr[0] = (ImDrawIdx)(DrawList._VtxCurrentIdx);
         DrawList._IdxWritePtr[1] = (ImDrawIdx)(DrawList._VtxCurrentIdx + 1 + intersect);
@@ -739,16 +1182,218 @@ struct ShadedRenderer {
     static const int VtxConsumed = 5;
 };
 
+// Renders primitives [first,last) into space already reserved in the draw list. Sets bit (prim - first) of #emitted,
+// when not NULL, for every primitive not culled and returns how many were emitted. RenderPrimitives and TessellateJob
+// both run this one out of line instantiation, so a primitive comes out the same on the serial and the parallel path.
+template <typename Renderer>
+static IMPLOT_NOINLINE int RenderPrimitivesRange(const Renderer& renderer, ImDrawList& DrawList, const ImRect& cull_rect, const ImVec2& uv, int first, int last, ImU32* emitted) {
+    int count = 0;
+    for (int prim = first; prim < last; ++prim) {
+        if (renderer(DrawList, cull_rect, uv, prim)) {
+            if (emitted)
+                emitted[(prim - first) >> 5] |= 1u << ((prim - first) & 31);
+            count++;
+        }
+    }
+    return count;
+}
+
+// Items with more than IMPLOT_JOB_PRIMS primitives are tessellated on the worker pool when SetThreadsCount > 1. Jobs
+// of IMPLOT_JOB_PRIMS primitives render into scratch draw lists, a wave of jobs at a time. Each wave is then stitched
+// into the plot draw list in order, taking the same reserve decisions RenderPrimitives takes so draw commands split
+// at the same primitives, and copied over with indices rebased, so the draw list comes out in the serial order.
+
+// Number of set bits in [first,last) of #bits
+static inline int CountBits(const ImU32* bits, int first, int last) {
+    int count = 0;
+    for (int i = first; i < last; ) {
+        ImU32 word = bits[i >> 5] >> (i & 31);
+        const int n = ImMin(32 - (i & 31), last - i);
+        if (n < 32)
+            word &= (1u << n) - 1;
+        word = word - ((word >> 1) & 0x55555555u);
+        word = (word & 0x33333333u) + ((word >> 2) & 0x33333333u);
+        count += (int)((((word + (word >> 4)) & 0x0F0F0F0Fu) * 0x01010101u) >> 24);
+        i += n;
+    }
+    return count;
+}
+
+// A run of one job's emitted primitives, copied into the draw list with its indices rebased
+struct JobSegment {
+    int          Job;
+    int          SrcVtx, SrcIdx;
+    int          DstVtx, DstIdx;
+    int          VtxCount, IdxCount;
+    unsigned int IdxDelta;
+};
+
+template <typename Renderer>
+struct TessellateJobs {
+    const Renderer* Rend;
+    ImRect          CullRect;
+    ImVec2          UV;
+    int             Prims;
+    int             FirstJob;
+    ImDrawList**    JobLists;
+    ImU32*          Emitted;
+};
+
+template <typename Renderer>
+static void TessellateJob(void* user_data, int job) {
+    const TessellateJobs<Renderer>& jobs = *(const TessellateJobs<Renderer>*)user_data;
+    const int first = (jobs.FirstJob + job) * IMPLOT_JOB_PRIMS;
+    const int last  = ImMin(first + IMPLOT_JOB_PRIMS, jobs.Prims);
+    ImDrawList& list = *jobs.JobLists[job];
+    // within the capacity RenderPrimitivesParallel reserved, so nothing is allocated on this thread
+    IM_ASSERT(list.VtxBuffer.Capacity >= (last - first) * Renderer::VtxConsumed && list.IdxBuffer.Capacity >= (last - first) * Renderer::IdxConsumed);
+    list.VtxBuffer.resize((last - first) * Renderer::VtxConsumed);
+    list.IdxBuffer.resize((last - first) * Renderer::IdxConsumed);
+    list._VtxWritePtr   = list.VtxBuffer.Data;
+    list._IdxWritePtr   = list.IdxBuffer.Data;
+    list._VtxCurrentIdx = 0;
+    ImU32* emitted = jobs.Emitted + first / 32;
+    memset(emitted, 0, ((last - first + 31) / 32) * sizeof(ImU32));
+    Renderer renderer(*jobs.Rend);
+    renderer.Seek(first);
+    RenderPrimitivesRange(renderer, list, jobs.CullRect, jobs.UV, first, last, emitted);
+}
+
+struct CopyJobs {
+    const JobSegment* Segments;
+    ImDrawList**      JobLists;
+    ImDrawVert*       VtxBuffer;
+    ImDrawIdx*        IdxBuffer;
+};
+
+static void CopyJob(void* user_data, int segment) {
+    const CopyJobs& jobs = *(const CopyJobs*)user_data;
+    const JobSegment& seg = jobs.Segments[segment];
+    const ImDrawList& list = *jobs.JobLists[seg.Job];
+    memcpy(jobs.VtxBuffer + seg.DstVtx, list.VtxBuffer.Data + seg.SrcVtx, seg.VtxCount * sizeof(ImDrawVert));
+    const ImDrawIdx* src = list.IdxBuffer.Data + seg.SrcIdx;
+    ImDrawIdx* dst = jobs.IdxBuffer + seg.DstIdx;
+    for (int i = 0; i < seg.IdxCount; ++i)
+        dst[i] = (ImDrawIdx)(src[i] + seg.IdxDelta);
+}
+
+template <typename Renderer>
+void RenderPrimitivesParallel(const Renderer& renderer, ImDrawList& DrawList, const ImRect& cull_rect) {
+    ImPlotContext& gp = *GImPlot;
+    const int prims      = renderer.Prims;
+    const int jobs_count = (prims + IMPLOT_JOB_PRIMS - 1) / IMPLOT_JOB_PRIMS;
+    const int wave_jobs  = ImMin(jobs_count, GetThreadsCount() * 4);
+    while (gp.JobDrawLists.Size < wave_jobs)
+        gp.JobDrawLists.push_back(IM_NEW(ImDrawList)(DrawList._Data));
+    // scratch lists are sized here for a full job, as workers must not allocate (ImGui::MemAlloc counters aren't atomic)
+    for (int i = 0; i < wave_jobs; ++i) {
+        ImDrawList& list = *gp.JobDrawLists[i];
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+        list.VtxOrigin = DrawList.VtxOrigin;
+#endif
+        list._Data = DrawList._Data;
+        list.VtxBuffer.reserve(IMPLOT_JOB_PRIMS * Renderer::VtxConsumed);
+        list.IdxBuffer.reserve(IMPLOT_JOB_PRIMS * Renderer::IdxConsumed);
+    }
+    gp.JobEmitted.resize((prims + 31) / 32);
+
+    TessellateJobs<Renderer> tessellate;
+    tessellate.Rend     = &renderer;
+    tessellate.CullRect = cull_rect;
+    tessellate.UV       = DrawList._Data->TexUvWhitePixel;
+    tessellate.Prims    = prims;
+    tessellate.JobLists = gp.JobDrawLists.Data;
+    tessellate.Emitted  = gp.JobEmitted.Data;
+
+    ImVector<JobSegment> segments;
+    unsigned int batch_end = 0;
+    for (int first_job = 0; first_job < jobs_count; first_job += wave_jobs) {
+        const int jobs = ImMin(wave_jobs, jobs_count - first_job);
+        tessellate.FirstJob = first_job;
+        RunJobs(jobs, TessellateJob<Renderer>, &tessellate);
+
+        // stitch, a new batch is decided from the vertex count reached at its first primitive as RenderPrimitives does
+        segments.resize(0);
+        for (int job = 0; job < jobs; ++job) {
+            const unsigned int job_first = (unsigned int)(first_job + job) * IMPLOT_JOB_PRIMS;
+            const unsigned int job_last  = ImMin(job_first + IMPLOT_JOB_PRIMS, (unsigned int)prims);
+            int emitted_before = 0;
+            for (unsigned int prim = job_first; prim < job_last; ) {
+                if (prim == batch_end) {
+                    const unsigned int left = prims - prim;
+                    unsigned int cnt = ImMin(left, (MaxIdx<ImDrawIdx>::Value - DrawList._VtxCurrentIdx) / Renderer::VtxConsumed);
+                    if (cnt < ImMin(64u, left)) {
+                        cnt = ImMin(left, MaxIdx<ImDrawIdx>::Value / Renderer::VtxConsumed);
+                        if (sizeof(ImDrawIdx) == 2 && (DrawList._VtxCurrentIdx + cnt * Renderer::VtxConsumed >= (1 << 16)) && (DrawList.Flags & ImDrawListFlags_AllowVtxOffset)) {
+                            DrawList._CmdHeader.VtxOffset = DrawList.VtxBuffer.Size;
+                            DrawList._OnChangedVtxOffset();
+                        }
+                    }
+                    batch_end = prim + cnt;
+                }
+                const unsigned int end = ImMin(job_last, batch_end);
+                const int emitted = CountBits(gp.JobEmitted.Data + job_first / 32, prim - job_first, end - job_first);
+                if (emitted > 0) {
+                    JobSegment seg;
+                    seg.Job      = job;
+                    seg.SrcVtx   = emitted_before * Renderer::VtxConsumed;
+                    seg.SrcIdx   = emitted_before * Renderer::IdxConsumed;
+                    seg.DstVtx   = DrawList.VtxBuffer.Size;
+                    seg.DstIdx   = DrawList.IdxBuffer.Size;
+                    seg.VtxCount = emitted * Renderer::VtxConsumed;
+                    seg.IdxCount = emitted * Renderer::IdxConsumed;
+                    seg.IdxDelta = DrawList._VtxCurrentIdx - (unsigned int)seg.SrcVtx;
+                    segments.push_back(seg);
+                    DrawList.PrimReserve(seg.IdxCount, seg.VtxCount);
+                    DrawList._VtxCurrentIdx += seg.VtxCount;
+                    emitted_before += emitted;
+                }
+                prim = end;
+            }
+        }
+
+        CopyJobs copy;
+        copy.Segments  = segments.Data;
+        copy.JobLists  = gp.JobDrawLists.Data;
+        copy.VtxBuffer = DrawList.VtxBuffer.Data;
+        copy.IdxBuffer = DrawList.IdxBuffer.Data;
+        RunJobs(segments.Size, CopyJob, &copy);
+    }
+    DrawList._VtxWritePtr = DrawList.VtxBuffer.Data + DrawList.VtxBuffer.Size;
+    DrawList._IdxWritePtr = DrawList.IdxBuffer.Data + DrawList.IdxBuffer.Size;
+}
+
 /// Renders primitive shapes in bulk as efficiently as possible.
 template <typename Renderer>
 IMPLOT_INLINE void RenderPrimitives(const Renderer& renderer, ImDrawList& DrawList, const ImRect& cull_rect) {
+    if (renderer.Prims <= 0)
+        return;
     unsigned int prims        = renderer.Prims;
     unsigned int prims_culled = 0;
     unsigned int idx          = 0;
     const ImVec2 uv = DrawList._Data->TexUvWhitePixel;
+    // no reservation is larger than IMPLOT_RESERVE_VTX, which also keeps the int sizes passed to PrimReserve small
+    const unsigned int max_cnt = IMPLOT_RESERVE_VTX / Renderer::VtxConsumed;
+    // grow the buffers once for the whole item instead of by half again every chunk, up to max_cnt prims since culling
+    // may leave most of it unused (ImGui's RenderText reserves ahead for its worst case the same way)
+    const size_t reserve_cnt = ImMin(prims, max_cnt);
+    const size_t reserve_vtx = (size_t)DrawList.VtxBuffer.Size + reserve_cnt * Renderer::VtxConsumed;
+    const size_t reserve_idx = (size_t)DrawList.IdxBuffer.Size + reserve_cnt * Renderer::IdxConsumed;
+    if (reserve_vtx <= (size_t)INT_MAX && reserve_idx <= (size_t)INT_MAX) {
+        DrawList.VtxBuffer.reserve((int)reserve_vtx);
+        DrawList.IdxBuffer.reserve((int)reserve_idx);
+    }
+    // culled prims are unreserved, so the vertices added tell how many were emitted
+    const int vtx_start = DrawList.VtxBuffer.Size;
+    if (prims > IMPLOT_JOB_PRIMS && GetThreadsCount() > 1) {
+        RenderPrimitivesParallel(renderer, DrawList, cull_rect);
+        const int emitted = (DrawList.VtxBuffer.Size - vtx_start) / Renderer::VtxConsumed;
+        AddItemPrims(emitted, renderer.Prims - emitted);
+        return;
+    }
     while (prims) {
         // find how many can be reserved up to end of current draw command's limit
-        unsigned int cnt = ImMin(prims, (MaxIdx<ImDrawIdx>::Value - DrawList._VtxCurrentIdx) / Renderer::VtxConsumed);
+        unsigned int cnt = ImMin(ImMin(prims, max_cnt), (MaxIdx<ImDrawIdx>::Value - DrawList._VtxCurrentIdx) / Renderer::VtxConsumed);
         // make sure at least this many elements can be rendered to avoid situations where at the end of buffer this slow path is not taken all the time
         if (cnt >= ImMin(64u, prims)) {
             if (prims_culled >= cnt)
@@ -764,70 +1409,52 @@ IMPLOT_INLINE void RenderPrimitives(const Renderer& renderer, ImDrawList& DrawLi
                 DrawList.PrimUnreserve(prims_culled * Renderer::IdxConsumed, prims_culled * Renderer::VtxConsumed);
                 prims_culled = 0;
             }
-            cnt = ImMin(prims, (MaxIdx<ImDrawIdx>::Value - 0/*DrawList._VtxCurrentIdx*/) / Renderer::VtxConsumed);
+            cnt = ImMin(ImMin(prims, max_cnt), (MaxIdx<ImDrawIdx>::Value - 0/*DrawList._VtxCurrentIdx*/) / Renderer::VtxConsumed);
             DrawList.PrimReserve(cnt * Renderer::IdxConsumed, cnt * Renderer::VtxConsumed); // reserve new draw command
         }
         prims -= cnt;
-        for (unsigned int ie = idx + cnt; idx != ie; ++idx) {
-            if (!renderer(DrawList, cull_rect, uv, idx))
-                prims_culled++;
-        }
+        prims_culled += cnt - RenderPrimitivesRange(renderer, DrawList, cull_rect, uv, (int)idx, (int)(idx + cnt), NULL);
+        idx += cnt;
     }
     if (prims_culled > 0)
         DrawList.PrimUnreserve(prims_culled * Renderer::IdxConsumed, prims_culled * Renderer::VtxConsumed);
+    const int emitted = (DrawList.VtxBuffer.Size - vtx_start) / Renderer::VtxConsumed;
+    AddItemPrims(emitted, renderer.Prims - emitted);
 }
 
 template <typename Getter, typename Transformer>
 IMPLOT_INLINE void RenderLineStrip(const Getter& getter, const Transformer& transformer, ImDrawList& DrawList, float line_weight, ImU32 col) {
     ImPlotContext& gp = *GImPlot;
-    if (ImHasFlag(gp.CurrentPlot->Flags, ImPlotFlags_AntiAliased) || gp.Style.AntiAliasedLines) {
-        ImVec2 p1 = transformer(getter(0));
-        for (int i = 1; i < getter.Count; ++i) {
-            ImVec2 p2 = transformer(getter(i));
-            if (gp.CurrentPlot->PlotRect.Overlaps(ImRect(ImMin(p1, p2), ImMax(p1, p2))))
-                DrawList.AddLine(p1, p2, col, line_weight);
-            p1 = p2;
-        }
-    }
-    else {
-        RenderPrimitives(LineStripRenderer<Getter,Transformer>(getter, transformer, col, line_weight), DrawList, gp.CurrentPlot->PlotRect);
+    const ImRect& cull_rect = gp.CurrentPlot->PlotRect;
+    switch (GetLineAAMode(DrawList, line_weight)) {
+        case LineAAMode_Tex:   RenderPrimitives(LineStripRendererAA<Getter,Transformer,PrimLineAATex>(getter, transformer, PrimLineAATex(DrawList, line_weight, col)), DrawList, cull_rect); break;
+        case LineAAMode_Thin:  RenderPrimitives(LineStripRendererAA<Getter,Transformer,PrimLineAAThin>(getter, transformer, PrimLineAAThin(DrawList, line_weight, col)), DrawList, cull_rect); break;
+        case LineAAMode_Thick: RenderPrimitives(LineStripRendererAA<Getter,Transformer,PrimLineAAThick>(getter, transformer, PrimLineAAThick(DrawList, line_weight, col)), DrawList, cull_rect); break;
+        default:               RenderPrimitives(LineStripRenderer<Getter,Transformer>(getter, transformer, col, line_weight), DrawList, cull_rect); break;
     }
 }
 
 template <typename Getter1, typename Getter2, typename Transformer>
 IMPLOT_INLINE void RenderLineSegments(const Getter1& getter1, const Getter2& getter2, const Transformer& transformer, ImDrawList& DrawList, float line_weight, ImU32 col) {
     ImPlotContext& gp = *GImPlot;
-    if (ImHasFlag(gp.CurrentPlot->Flags, ImPlotFlags_AntiAliased) || gp.Style.AntiAliasedLines) {
-        int I = ImMin(getter1.Count, getter2.Count);
-        for (int i = 0; i < I; ++i) {
-            ImVec2 p1 = transformer(getter1(i));
-            ImVec2 p2 = transformer(getter2(i));
-            if (gp.CurrentPlot->PlotRect.Overlaps(ImRect(ImMin(p1, p2), ImMax(p1, p2))))
-                DrawList.AddLine(p1, p2, col, line_weight);
-        }
-    }
-    else {
-        RenderPrimitives(LineSegmentsRenderer<Getter1,Getter2,Transformer>(getter1, getter2, transformer, col, line_weight), DrawList, gp.CurrentPlot->PlotRect);
+    const ImRect& cull_rect = gp.CurrentPlot->PlotRect;
+    switch (GetLineAAMode(DrawList, line_weight)) {
+        case LineAAMode_Tex:   RenderPrimitives(LineSegmentsRendererAA<Getter1,Getter2,Transformer,PrimLineAATex>(getter1, getter2, transformer, PrimLineAATex(DrawList, line_weight, col)), DrawList, cull_rect); break;
+        case LineAAMode_Thin:  RenderPrimitives(LineSegmentsRendererAA<Getter1,Getter2,Transformer,PrimLineAAThin>(getter1, getter2, transformer, PrimLineAAThin(DrawList, line_weight, col)), DrawList, cull_rect); break;
+        case LineAAMode_Thick: RenderPrimitives(LineSegmentsRendererAA<Getter1,Getter2,Transformer,PrimLineAAThick>(getter1, getter2, transformer, PrimLineAAThick(DrawList, line_weight, col)), DrawList, cull_rect); break;
+        default:               RenderPrimitives(LineSegmentsRenderer<Getter1,Getter2,Transformer>(getter1, getter2, transformer, col, line_weight), DrawList, cull_rect); break;
     }
 }
 
 template <typename Getter, typename Transformer>
 IMPLOT_INLINE void RenderStairs(const Getter& getter, const Transformer& transformer, ImDrawList& DrawList, float line_weight, ImU32 col) {
     ImPlotContext& gp = *GImPlot;
-    if (ImHasFlag(gp.CurrentPlot->Flags, ImPlotFlags_AntiAliased) || gp.Style.AntiAliasedLines) {
-        ImVec2 p1 = transformer(getter(0));
-        for (int i = 1; i < getter.Count; ++i) {
-            ImVec2 p2 = transformer(getter(i));
-            if (gp.CurrentPlot->PlotRect.Overlaps(ImRect(ImMin(p1, p2), ImMax(p1, p2)))) {
-                ImVec2 p12(p2.x, p1.y);
-                DrawList.AddLine(p1, p12, col, line_weight);
-                DrawList.AddLine(p12, p2, col, line_weight);
-            }
-            p1 = p2;
-        }
-    }
-    else {
-        RenderPrimitives(StairsRenderer<Getter,Transformer>(getter, transformer, col, line_weight), DrawList, gp.CurrentPlot->PlotRect);
+    const ImRect& cull_rect = gp.CurrentPlot->PlotRect;
+    switch (GetLineAAMode(DrawList, line_weight)) {
+        case LineAAMode_Tex:   RenderPrimitives(StairsRendererAA<Getter,Transformer,PrimLineAATex>(getter, transformer, PrimLineAATex(DrawList, line_weight, col)), DrawList, cull_rect); break;
+        case LineAAMode_Thin:  RenderPrimitives(StairsRendererAA<Getter,Transformer,PrimLineAAThin>(getter, transformer, PrimLineAAThin(DrawList, line_weight, col)), DrawList, cull_rect); break;
+        case LineAAMode_Thick: RenderPrimitives(StairsRendererAA<Getter,Transformer,PrimLineAAThick>(getter, transformer, PrimLineAAThick(DrawList, line_weight, col)), DrawList, cull_rect); break;
+        default:               RenderPrimitives(StairsRenderer<Getter,Transformer>(getter, transformer, col, line_weight), DrawList, cull_rect); break;
     }
 }
 
@@ -934,10 +1561,465 @@ IMPLOT_INLINE void RenderMarkers(Getter getter, Transformer transformer, ImDrawL
     };
     ImPlotContext& gp = *GImPlot;
     const ImRect& rect = gp.CurrentPlot->PlotRect;
+    int emitted = 0;
     for (int i = 0; i < getter.Count; ++i) {
         ImVec2 c = transformer(getter(i));
-        if (c.x >= rect.Min.x && c.y >= rect.Min.y && c.x <= rect.Max.x && c.y <= rect.Max.y)
+        if (!PixelNanOrInf(c) && c.x >= rect.Min.x && c.y >= rect.Min.y && c.x <= rect.Max.x && c.y <= rect.Max.y) {
             marker_table[marker](DrawList, c, size, rend_mk_line, col_mk_line, rend_mk_fill, col_mk_fill, weight);
+            emitted++;
+        }
+    }
+    AddItemPrims(emitted, getter.Count - emitted);
+}
+
+//-----------------------------------------------------------------------------
+// PER POINT RENDERERS
+//-----------------------------------------------------------------------------
+
+// Items colored or sized per point (see SetNextColormapValues, SetNextMarkerSizes) transform their points to pixels
+// once and render markers and segments through RenderPrimitives, one primitive per marker or segment.
+
+// Per point colors and sizes of the current item, NULL unless set for the next item
+IMPLOT_INLINE void GetPointStyle(int count, const ImU32** cols, const float** sizes) {
+    const ImPlotNextItemData& s = GImPlot->NextItemData;
+    IM_ASSERT_USER_ERROR(s.PointColors.Size == 0 || s.PointColors.Size >= count, "SetNextColormapValues() count must cover the item's points!");
+    IM_ASSERT_USER_ERROR(s.PointSizes.Size == 0 || s.PointSizes.Size >= count, "SetNextMarkerSizes() count must cover the item's points!");
+    *cols  = s.PointColors.Size > 0 && s.PointColors.Size >= count ? s.PointColors.Data : NULL;
+    *sizes = s.PointSizes.Size > 0 && s.PointSizes.Size >= count ? s.PointSizes.Data : NULL;
+}
+
+// Color of point #i, the sampled color with its alpha scaled by the style color's, or the style color
+IMPLOT_INLINE ImU32 PointColorU32(const ImU32* cols, int i, ImU32 col) {
+    if (cols == NULL)
+        return col;
+    const ImU32 a = (((cols[i] >> IM_COL32_A_SHIFT) & 0xFF) * ((col >> IM_COL32_A_SHIFT) & 0xFF) + 127) / 255;
+    return (cols[i] & ~IM_COL32_A_MASK) | (a << IM_COL32_A_SHIFT);
+}
+
+template <typename Getter, typename Transformer>
+IMPLOT_INLINE void TransformPoints(const Getter& getter, const Transformer& transformer, ImVec2* pixels) {
+    for (int i = 0; i < getter.Count; ++i)
+        pixels[i] = transformer(getter(i));
+}
+
+// Transforms all points of #getter to pixels in GImPlot->TempPixels
+template <typename Getter>
+const ImVec2* TransformPoints(const Getter& getter) {
+    ImVector<ImVec2>& pixels = GImPlot->TempPixels;
+    pixels.resize(getter.Count);
+    switch (GetCurrentScale()) {
+        case ImPlotScale_LinLin: TransformPoints(getter, TransformerLinLin(), pixels.Data); break;
+        case ImPlotScale_LogLin: TransformPoints(getter, TransformerLogLin(), pixels.Data); break;
+        case ImPlotScale_LinLog: TransformPoints(getter, TransformerLinLog(), pixels.Data); break;
+        case ImPlotScale_LogLog: TransformPoints(getter, TransformerLogLog(), pixels.Data); break;
+    }
+    return pixels.Data;
+}
+
+struct LineStripColorsRenderer {
+    LineStripColorsRenderer(const ImVec2* points, int count, const ImU32* cols, ImU32 col, float weight) :
+        Points(points),
+        Prims(count - 1),
+        Cols(cols),
+        Col(col),
+        HalfWeight(weight/2)
+    { }
+    IMPLOT_INLINE void Seek(int) const { }
+    IMPLOT_INLINE bool operator()(ImDrawList& DrawList, const ImRect& cull_rect, const ImVec2& uv, int prim) const {
+        const ImVec2& P1 = Points[prim];
+        const ImVec2& P2 = Points[prim + 1];
+        if (!cull_rect.Overlaps(SegmentBounds(P1, P2)))
+            return false;
+        PrimLine(P1, P2, HalfWeight, PointColorU32(Cols, prim, Col), DrawList, uv);
+        return true;
+    }
+    const ImVec2* Points;
+    const int Prims;
+    const ImU32* Cols;
+    const ImU32 Col;
+    const float HalfWeight;
+    static const int IdxConsumed = 6;
+    static const int VtxConsumed = 4;
+};
+
+// Marker shapes of the RenderMarker* functions, and the point pairs of their outlines
+static const ImVec2 MARKER_CIRCLE[10]  = {ImVec2(1.0f, 0.0f), ImVec2(0.809017f, 0.58778524f), ImVec2(0.30901697f, 0.95105654f), ImVec2(-0.30901703f, 0.9510565f),
+                                          ImVec2(-0.80901706f, 0.5877852f), ImVec2(-1.0f, 0.0f), ImVec2(-0.80901694f, -0.58778536f), ImVec2(-0.3090171f, -0.9510565f),
+                                          ImVec2(0.30901712f, -0.9510565f), ImVec2(0.80901694f, -0.5877853f)};
+static const ImVec2 MARKER_SQUARE[4]   = {ImVec2(SQRT_1_2,SQRT_1_2), ImVec2(SQRT_1_2,-SQRT_1_2), ImVec2(-SQRT_1_2,-SQRT_1_2), ImVec2(-SQRT_1_2,SQRT_1_2)};
+static const ImVec2 MARKER_DIAMOND[4]  = {ImVec2(1, 0), ImVec2(0, -1), ImVec2(-1, 0), ImVec2(0, 1)};
+static const ImVec2 MARKER_UP[3]       = {ImVec2(SQRT_3_2,0.5f), ImVec2(0,-1), ImVec2(-SQRT_3_2,0.5f)};
+static const ImVec2 MARKER_DOWN[3]     = {ImVec2(SQRT_3_2,-0.5f), ImVec2(0,1), ImVec2(-SQRT_3_2,-0.5f)};
+static const ImVec2 MARKER_LEFT[3]     = {ImVec2(-1,0), ImVec2(0.5, SQRT_3_2), ImVec2(0.5, -SQRT_3_2)};
+static const ImVec2 MARKER_RIGHT[3]    = {ImVec2(1,0), ImVec2(-0.5, SQRT_3_2), ImVec2(-0.5, -SQRT_3_2)};
+static const ImVec2 MARKER_ASTERISK[6] = {ImVec2(SQRT_3_2, 0.5f), ImVec2(0, -1), ImVec2(-SQRT_3_2, 0.5f), ImVec2(SQRT_3_2, -0.5f), ImVec2(0, 1), ImVec2(-SQRT_3_2, -0.5f)};
+
+static const int MARKER_LOOP10[20]      = {0,1, 1,2, 2,3, 3,4, 4,5, 5,6, 6,7, 7,8, 8,9, 9,0};
+static const int MARKER_LOOP4[8]        = {0,1, 1,2, 2,3, 3,0};
+static const int MARKER_LOOP3[6]        = {0,1, 1,2, 2,0};
+static const int MARKER_DIAGONALS[4]    = {0,2, 1,3};
+static const int MARKER_ASTERISK_SEG[6] = {0,5, 1,4, 2,3};
+
+IMPLOT_INLINE bool MarkerVisible(const ImRect& rect, const ImVec2& c) {
+    return !PixelNanOrInf(c) && c.x >= rect.Min.x && c.y >= rect.Min.y && c.x <= rect.Max.x && c.y <= rect.Max.y;
+}
+
+// Fills convex marker shapes of N points as AddConvexPolyFilled does without anti-aliasing
+template <int N>
+struct MarkerFillRenderer {
+    MarkerFillRenderer(const ImVec2* points, int count, const ImVec2* shape, const float* sizes, float size, const ImU32* cols, ImU32 col) :
+        Points(points),
+        Prims(count),
+        Shape(shape),
+        Sizes(sizes),
+        Size(size),
+        Cols(cols),
+        Col(col)
+    { }
+    IMPLOT_INLINE void Seek(int) const { }
+    IMPLOT_INLINE bool operator()(ImDrawList& DrawList, const ImRect& cull_rect, const ImVec2& uv, int prim) const {
+        const ImVec2 c = Points[prim];
+        if (!MarkerVisible(cull_rect, c))
+            return false;
+        const float s   = Sizes ? Sizes[prim] : Size;
+        const ImU32 col = PointColorU32(Cols, prim, Col);
+        for (int i = 0; i < N; ++i)
+            DrawList.SetVtx(&DrawList._VtxWritePtr[i], ImVec2(c.x + Shape[i].x * s, c.y + Shape[i].y * s), uv, col);
+        DrawList._VtxWritePtr += N;
+        const unsigned int idx = DrawList._VtxCurrentIdx;
+        for (int i = 2; i < N; ++i) {
+            DrawList._IdxWritePtr[0] = (ImDrawIdx)(idx);
+            DrawList._IdxWritePtr[1] = (ImDrawIdx)(idx + i - 1);
+            DrawList._IdxWritePtr[2] = (ImDrawIdx)(idx + i);
+            DrawList._IdxWritePtr += 3;
+        }
+        DrawList._VtxCurrentIdx += N;
+        return true;
+    }
+    const ImVec2* Points;
+    const int Prims;
+    const ImVec2* Shape;
+    const float* Sizes;
+    const float Size;
+    const ImU32* Cols;
+    const ImU32 Col;
+    static const int IdxConsumed = (N - 2) * 3;
+    static const int VtxConsumed = N;
+};
+
+// Outlines markers with S segments between the shape points in #segs
+template <int S>
+struct MarkerLineRenderer {
+    MarkerLineRenderer(const ImVec2* points, int count, const ImVec2* shape, const int* segs, const float* sizes, float size, const ImU32* cols, ImU32 col, float weight) :
+        Points(points),
+        Prims(count),
+        Shape(shape),
+        Segs(segs),
+        Sizes(sizes),
+        Size(size),
+        Cols(cols),
+        Col(col),
+        HalfWeight(weight/2)
+    { }
+    IMPLOT_INLINE void Seek(int) const { }
+    IMPLOT_INLINE bool operator()(ImDrawList& DrawList, const ImRect& cull_rect, const ImVec2& uv, int prim) const {
+        const ImVec2 c = Points[prim];
+        if (!MarkerVisible(cull_rect, c))
+            return false;
+        const float s   = Sizes ? Sizes[prim] : Size;
+        const ImU32 col = PointColorU32(Cols, prim, Col);
+        for (int i = 0; i < S; ++i) {
+            const ImVec2& a = Shape[Segs[2*i]];
+            const ImVec2& b = Shape[Segs[2*i+1]];
+            PrimLine(ImVec2(c.x + a.x * s, c.y + a.y * s), ImVec2(c.x + b.x * s, c.y + b.y * s), HalfWeight, col, DrawList, uv);
+        }
+        return true;
+    }
+    const ImVec2* Points;
+    const int Prims;
+    const ImVec2* Shape;
+    const int* Segs;
+    const float* Sizes;
+    const float Size;
+    const ImU32* Cols;
+    const ImU32 Col;
+    const float HalfWeight;
+    static const int IdxConsumed = 6 * S;
+    static const int VtxConsumed = 4 * S;
+};
+
+template <int N>
+void RenderMarkerShapes(const ImVec2* points, int count, const ImVec2* shape, const int* loop, ImDrawList& DrawList, const ImRect& cull_rect,
+                        float size, const float* sizes, bool outline, ImU32 col_outline, float weight, bool fill, ImU32 col_fill, const ImU32* cols) {
+    if (fill)
+        RenderPrimitives(MarkerFillRenderer<N>(points, count, shape, sizes, size, cols, col_fill), DrawList, cull_rect);
+    // per point colors leave outline and fill apart by alpha only
+    const bool same = cols ? ((col_outline ^ col_fill) & IM_COL32_A_MASK) == 0 : col_outline == col_fill;
+    if (outline && !(fill && same))
+        RenderPrimitives(MarkerLineRenderer<N>(points, count, shape, loop, sizes, size, cols, col_outline, weight), DrawList, cull_rect);
+}
+
+// Renders markers with per point sizes and/or colors (NULL for the uniform #size and colors). Fills are batched before
+// outlines, so overlapping markers layer differently than RenderMarkers' marker by marker order.
+void RenderMarkers(const ImVec2* points, int count, ImDrawList& DrawList, ImPlotMarker marker, float size, const float* sizes,
+                   bool rend_mk_line, ImU32 col_mk_line, float weight, bool rend_mk_fill, ImU32 col_mk_fill, const ImU32* cols) {
+    const ImRect& cull_rect = GImPlot->CurrentPlot->PlotRect;
+    switch (marker) {
+        case ImPlotMarker_Circle:   RenderMarkerShapes<10>(points, count, MARKER_CIRCLE, MARKER_LOOP10, DrawList, cull_rect, size, sizes, rend_mk_line, col_mk_line, weight, rend_mk_fill, col_mk_fill, cols); break;
+        case ImPlotMarker_Square:   RenderMarkerShapes<4>(points, count, MARKER_SQUARE, MARKER_LOOP4, DrawList, cull_rect, size, sizes, rend_mk_line, col_mk_line, weight, rend_mk_fill, col_mk_fill, cols); break;
+        case ImPlotMarker_Diamond:  RenderMarkerShapes<4>(points, count, MARKER_DIAMOND, MARKER_LOOP4, DrawList, cull_rect, size, sizes, rend_mk_line, col_mk_line, weight, rend_mk_fill, col_mk_fill, cols); break;
+        case ImPlotMarker_Up:       RenderMarkerShapes<3>(points, count, MARKER_UP, MARKER_LOOP3, DrawList, cull_rect, size, sizes, rend_mk_line, col_mk_line, weight, rend_mk_fill, col_mk_fill, cols); break;
+        case ImPlotMarker_Down:     RenderMarkerShapes<3>(points, count, MARKER_DOWN, MARKER_LOOP3, DrawList, cull_rect, size, sizes, rend_mk_line, col_mk_line, weight, rend_mk_fill, col_mk_fill, cols); break;
+        case ImPlotMarker_Left:     RenderMarkerShapes<3>(points, count, MARKER_LEFT, MARKER_LOOP3, DrawList, cull_rect, size, sizes, rend_mk_line, col_mk_line, weight, rend_mk_fill, col_mk_fill, cols); break;
+        case ImPlotMarker_Right:    RenderMarkerShapes<3>(points, count, MARKER_RIGHT, MARKER_LOOP3, DrawList, cull_rect, size, sizes, rend_mk_line, col_mk_line, weight, rend_mk_fill, col_mk_fill, cols); break;
+        case ImPlotMarker_Cross:    RenderPrimitives(MarkerLineRenderer<2>(points, count, MARKER_SQUARE, MARKER_DIAGONALS, sizes, size, cols, col_mk_line, weight), DrawList, cull_rect); break;
+        case ImPlotMarker_Plus:     RenderPrimitives(MarkerLineRenderer<2>(points, count, MARKER_DIAMOND, MARKER_DIAGONALS, sizes, size, cols, col_mk_line, weight), DrawList, cull_rect); break;
+        case ImPlotMarker_Asterisk: RenderPrimitives(MarkerLineRenderer<3>(points, count, MARKER_ASTERISK, MARKER_ASTERISK_SEG, sizes, size, cols, col_mk_line, weight), DrawList, cull_rect); break;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// NEAREST POINT
+//-----------------------------------------------------------------------------
+
+static const float NEAREST_CELL_SIZE = 4.0f;
+static const int   NEAREST_SCAN_MAX  = 32768;
+
+// Identifies item data for its nearest point index: the first point and SetNextDataVersion. Growing data is told apart
+// from appended data by ImPlotNearestIndex::Last.
+template <typename Getter>
+ImGuiID NearestDataKey(const Getter& getter, int version) {
+    const ImPlotPoint first = getter(0);
+    return ImHashData(&first, sizeof(first), (ImGuiID)version);
+}
+
+// Extends the monotonic x check from index.Count to the end of the data (NaNs and infinities make data unsorted)
+template <typename Getter>
+void ExtendMonotonicX(ImPlotNearestIndex& index, const Getter& getter) {
+    double prev = index.Last.x;
+    for (int i = index.Count; i < getter.Count && (index.Inc || index.Dec); ++i) {
+        const double x = getter(i).x;
+        if (ImNanOrInf(x)) {
+            index.Inc = index.Dec = false;
+            break;
+        }
+        if (i > 0) {
+            index.Inc = index.Inc && x >= prev;
+            index.Dec = index.Dec && x <= prev;
+        }
+        prev = x;
+    }
+    index.Sorted = index.Inc || index.Dec;
+}
+
+// Buckets the points inside #rect into a grid of NEAREST_CELL_SIZE pixel cells (counting sort, points keep index order)
+template <typename Getter, typename Transformer>
+void BuildNearestGrid(ImPlotNearestIndex& index, const Getter& getter, const Transformer& transformer, const ImRect& rect) {
+    index.Rect = rect;
+    index.Cols = ImMax(1, (int)ImCeil(rect.GetWidth()  / NEAREST_CELL_SIZE));
+    index.Rows = ImMax(1, (int)ImCeil(rect.GetHeight() / NEAREST_CELL_SIZE));
+    const int cells = index.Cols * index.Rows;
+    index.CellStart.resize(cells + 1);
+    memset(index.CellStart.Data, 0, (cells + 1) * sizeof(int));
+    ImVector<int>& cell_of = GImPlot->TempInt1;
+    cell_of.resize(getter.Count);
+    const float inv = 1.0f / NEAREST_CELL_SIZE;
+    for (int i = 0; i < getter.Count; ++i) {
+        const ImVec2 p = transformer(getter(i));
+        int cell = -1;
+        if (!PixelNanOrInf(p) && p.x >= rect.Min.x && p.y >= rect.Min.y && p.x < rect.Max.x && p.y < rect.Max.y) {
+            const int cx = ImMin((int)((p.x - rect.Min.x) * inv), index.Cols - 1);
+            const int cy = ImMin((int)((p.y - rect.Min.y) * inv), index.Rows - 1);
+            cell = cy * index.Cols + cx;
+            index.CellStart[cell + 1]++;
+        }
+        cell_of[i] = cell;
+    }
+    for (int c = 0; c < cells; ++c)
+        index.CellStart[c + 1] += index.CellStart[c];
+    index.Indices.resize(index.CellStart[cells]);
+    // fill using the starts as cursors, which leaves each holding the next cell's start
+    for (int i = 0; i < getter.Count; ++i) {
+        if (cell_of[i] != -1)
+            index.Indices[index.CellStart[cell_of[i]]++] = i;
+    }
+    for (int c = cells; c > 0; --c)
+        index.CellStart[c] = index.CellStart[c - 1];
+    index.CellStart[0] = 0;
+    index.GridCount = getter.Count;
+}
+
+// Keeps the closest of point #idx and the best so far, lower indices win ties
+template <typename Getter, typename Transformer>
+IMPLOT_INLINE void TestNearest(const Getter& getter, const Transformer& transformer, int idx, const ImVec2& mouse, float& best_d2, int& best_idx) {
+    const ImVec2 p = transformer(getter(idx));
+    if (PixelNanOrInf(p))
+        return;
+    const float d2 = ImLengthSqr(p - mouse);
+    if (d2 < best_d2 || (d2 == best_d2 && (best_idx == -1 || idx < best_idx))) {
+        best_d2  = d2;
+        best_idx = idx;
+    }
+}
+
+// Searches grid cells in rings around the mouse until a ring cannot hold anything closer
+template <typename Getter, typename Transformer>
+void QueryNearestGrid(const ImPlotNearestIndex& index, const Getter& getter, const Transformer& transformer, const ImVec2& mouse, float& best_d2, int& best_idx) {
+    const int mx = ImClamp((int)((mouse.x - index.Rect.Min.x) / NEAREST_CELL_SIZE), 0, index.Cols - 1);
+    const int my = ImClamp((int)((mouse.y - index.Rect.Min.y) / NEAREST_CELL_SIZE), 0, index.Rows - 1);
+    const int rings = (int)ImCeil(ImSqrt(best_d2) / NEAREST_CELL_SIZE) + 1;
+    for (int k = 0; k <= rings; ++k) {
+        // ring k lies outside the block of rings 0..k-1, stop once that block holds anything closer
+        if (k > 0) {
+            const float l = mouse.x - (index.Rect.Min.x + (mx - k + 1) * NEAREST_CELL_SIZE);
+            const float r = index.Rect.Min.x + (mx + k) * NEAREST_CELL_SIZE - mouse.x;
+            const float t = mouse.y - (index.Rect.Min.y + (my - k + 1) * NEAREST_CELL_SIZE);
+            const float b = index.Rect.Min.y + (my + k) * NEAREST_CELL_SIZE - mouse.y;
+            const float gap = ImMax(ImMin(ImMin(l, r), ImMin(t, b)), 0.0f);
+            if (gap * gap > best_d2)
+                break;
+        }
+        for (int cy = ImMax(my - k, 0); cy <= ImMin(my + k, index.Rows - 1); ++cy) {
+            const bool edge = cy == my - k || cy == my + k;
+            const int step = edge || k == 0 ? 1 : 2 * k;
+            for (int cx = mx - k; cx <= mx + k; cx += step) {
+                if (cx < 0 || cx >= index.Cols)
+                    continue;
+                const int cell = cy * index.Cols + cx;
+                for (int j = index.CellStart[cell]; j < index.CellStart[cell + 1]; ++j)
+                    TestNearest(getter, transformer, index.Indices[j], mouse, best_d2, best_idx);
+            }
+        }
+    }
+}
+
+// First index whose pixel x is at or past #px in the direction x runs
+template <typename Getter, typename Transformer>
+int LowerBoundX(const Getter& getter, const Transformer& transformer, bool ascending, float px) {
+    int lo = 0, hi = getter.Count;
+    while (lo < hi) {
+        const int mid = lo + (hi - lo) / 2;
+        const float x = transformer.Tx(getter(mid).x);
+        if (ascending ? x < px : x > px)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+// Binary searches monotonic x for the mouse, then walks out both ways until points are horizontally too far away.
+// Returns false without searching if more than NEAREST_SCAN_MAX points lie within reach horizontally.
+template <typename Getter, typename Transformer>
+bool QueryNearestSorted(const Getter& getter, const Transformer& transformer, const ImVec2& mouse, float& best_d2, int& best_idx) {
+    const int count = getter.Count;
+    const bool ascending = transformer.Tx(getter(count - 1).x) >= transformer.Tx(getter(0).x);
+    const float reach = ImSqrt(best_d2);
+    const int a = LowerBoundX(getter, transformer, ascending, ascending ? mouse.x - reach : mouse.x + reach);
+    const int b = LowerBoundX(getter, transformer, ascending, ascending ? mouse.x + reach : mouse.x - reach);
+    if (b - a > NEAREST_SCAN_MAX)
+        return false;
+    const int mid = LowerBoundX(getter, transformer, ascending, mouse.x);
+    int l = mid - 1, r = mid;
+    while (l >= 0 || r < count) {
+        if (r < count) {
+            const float dx = transformer.Tx(getter(r).x) - mouse.x;
+            if (dx * dx > best_d2)
+                r = count;
+            else
+                TestNearest(getter, transformer, r++, mouse, best_d2, best_idx);
+        }
+        if (l >= 0) {
+            const float dx = transformer.Tx(getter(l).x) - mouse.x;
+            if (dx * dx > best_d2)
+                l = -1;
+            else
+                TestNearest(getter, transformer, l--, mouse, best_d2, best_idx);
+        }
+    }
+    return true;
+}
+
+// Finds the current item's point nearest to the mouse, updating its index for appended data and rebuilding it if the data
+// or axes changed
+template <typename Getter, typename Transformer>
+void FindNearest(const Getter& getter, const Transformer& transformer) {
+    ImPlotContext& gp = *GImPlot;
+    ImPlotPlot& plot = *gp.CurrentPlot;
+    ImPlotItem& item = *gp.CurrentItem;
+    ImPlotNearestIndex& index = item.Nearest;
+    const ImGuiID data_key = NearestDataKey(getter, gp.NextItemData.DataVersion);
+    bool appended = data_key == index.DataKey && index.Count > 0 && getter.Count >= index.Count;
+    if (appended) {
+        const ImPlotPoint last = getter(index.Count - 1);
+        appended = memcmp(&last, &index.Last, sizeof(ImPlotPoint)) == 0;
+    }
+    if (!appended) {
+        index.DataKey = data_key;
+        index.Count   = 0;
+        index.Inc     = index.Dec = true;
+        index.GridKey = 0;
+    }
+    if (getter.Count > index.Count) {
+        ExtendMonotonicX(index, getter);
+        index.Count = getter.Count;
+        index.Last  = getter(getter.Count - 1);
+    }
+    const ImVec2 mouse = ImGui::GetIO().MousePos;
+    float best_d2 = plot.NearestDist * plot.NearestDist;
+    int best_idx = -1;
+    // sorted data needs no index unless it is too dense around the mouse
+    if (!index.Sorted || !QueryNearestSorted(getter, transformer, mouse, best_d2, best_idx)) {
+        ImGuiID grid_key = ImHashData(&transformer, sizeof(Transformer), 0);
+        grid_key = ImHashData(&plot.PlotRect, sizeof(ImRect), grid_key);
+        grid_key = ImHashData(&plot.NearestDist, sizeof(float), grid_key);
+        if (grid_key != index.GridKey && grid_key != index.PendingKey) {
+            // wait for the axes to settle for a frame, so zooming doesn't rebuild every frame, testing small data directly meanwhile
+            index.PendingKey = grid_key;
+            if (getter.Count > NEAREST_SCAN_MAX)
+                return;
+            for (int i = 0; i < getter.Count; ++i)
+                TestNearest(getter, transformer, i, mouse, best_d2, best_idx);
+        }
+        else {
+            // rebuild once the axes settled after changing or the data was replaced, and when enough points were appended
+            // that testing them one by one costs more than the grid saves
+            const int appended_max = ImMax(index.GridCount / 4, NEAREST_SCAN_MAX);
+            if (grid_key != index.GridKey || getter.Count - index.GridCount > appended_max) {
+                ImRect rect = plot.PlotRect;
+                rect.Expand(plot.NearestDist);
+                BuildNearestGrid(index, getter, transformer, rect);
+                index.GridKey = grid_key;
+            }
+            QueryNearestGrid(index, getter, transformer, mouse, best_d2, best_idx);
+            for (int i = index.GridCount; i < getter.Count; ++i)
+                TestNearest(getter, transformer, i, mouse, best_d2, best_idx);
+        }
+    }
+    // later items are drawn on top, so they win ties
+    if (best_idx != -1 && (plot.NearestItem == 0 || best_d2 <= plot.NearestDist2)) {
+        plot.NearestItem  = item.ID;
+        plot.NearestIdx   = best_idx;
+        plot.NearestPoint = getter(best_idx);
+        plot.NearestPos   = transformer(plot.NearestPoint);
+        plot.NearestDist2 = best_d2;
+        plot.NearestColor = item.Color;
+        plot.NearestX     = plot.CurrentX;
+        plot.NearestY     = plot.CurrentY;
+    }
+}
+
+// Nearest point query for line and scatter items, only while SetupNearest is on and the mouse rests over the plot
+template <typename Getter>
+void FindNearest(const Getter& getter) {
+    const ImPlotPlot& plot = *GImPlot->CurrentPlot;
+    if (plot.NearestDist <= 0 || getter.Count <= 0 || !plot.Hovered || plot.Held || plot.Selecting)
+        return;
+    switch (GetCurrentScale()) {
+        case ImPlotScale_LinLin: FindNearest(getter, TransformerLinLin()); break;
+        case ImPlotScale_LogLin: FindNearest(getter, TransformerLogLin()); break;
+        case ImPlotScale_LinLog: FindNearest(getter, TransformerLinLog()); break;
+        case ImPlotScale_LogLog: FindNearest(getter, TransformerLogLog()); break;
     }
 }
 
@@ -948,21 +2030,33 @@ IMPLOT_INLINE void RenderMarkers(Getter getter, Transformer transformer, ImDrawL
 template <typename Getter>
 IMPLOT_INLINE void PlotLineEx(const char* label_id, const Getter& getter) {
     if (BeginItem(label_id, ImPlotCol_Line)) {
+        AddItemPoints(getter.Count);
         if (FitThisFrame()) {
+            ImPlotFitTimer fit_timer;
             for (int i = 0; i < getter.Count; ++i) {
                 ImPlotPoint p = getter(i);
                 FitPoint(p);
             }
         }
+        FindNearest(getter);
         const ImPlotNextItemData& s = GetItemData();
         ImDrawList& DrawList = *GetPlotDrawList();
+        const ImU32* point_cols;
+        const float* point_sizes;
+        GetPointStyle(getter.Count, &point_cols, &point_sizes);
+        const ImVec2* pixels = point_cols != NULL || point_sizes != NULL ? TransformPoints(getter) : NULL;
         if (getter.Count > 1 && s.RenderLine) {
             const ImU32 col_line    = ImGui::GetColorU32(s.Colors[ImPlotCol_Line]);
-            switch (GetCurrentScale()) {
-                case ImPlotScale_LinLin: RenderLineStrip(getter, TransformerLinLin(), DrawList, s.LineWeight, col_line); break;
-                case ImPlotScale_LogLin: RenderLineStrip(getter, TransformerLogLin(), DrawList, s.LineWeight, col_line); break;
-                case ImPlotScale_LinLog: RenderLineStrip(getter, TransformerLinLog(), DrawList, s.LineWeight, col_line); break;
-                case ImPlotScale_LogLog: RenderLineStrip(getter, TransformerLogLog(), DrawList, s.LineWeight, col_line); break;
+            if (point_cols != NULL) {
+                RenderPrimitives(LineStripColorsRenderer(pixels, getter.Count, point_cols, col_line, s.LineWeight), DrawList, GImPlot->CurrentPlot->PlotRect);
+            }
+            else {
+                switch (GetCurrentScale()) {
+                    case ImPlotScale_LinLin: RenderLineStrip(getter, TransformerLinLin(), DrawList, s.LineWeight, col_line); break;
+                    case ImPlotScale_LogLin: RenderLineStrip(getter, TransformerLogLin(), DrawList, s.LineWeight, col_line); break;
+                    case ImPlotScale_LinLog: RenderLineStrip(getter, TransformerLinLog(), DrawList, s.LineWeight, col_line); break;
+                    case ImPlotScale_LogLog: RenderLineStrip(getter, TransformerLogLog(), DrawList, s.LineWeight, col_line); break;
+                }
             }
         }
         // render markers
@@ -972,11 +2066,16 @@ IMPLOT_INLINE void PlotLineEx(const char* label_id, const Getter& getter) {
             // PushPlotClipRect(s.MarkerSize);
             const ImU32 col_line = ImGui::GetColorU32(s.Colors[ImPlotCol_MarkerOutline]);
             const ImU32 col_fill = ImGui::GetColorU32(s.Colors[ImPlotCol_MarkerFill]);
-            switch (GetCurrentScale()) {
-                case ImPlotScale_LinLin: RenderMarkers(getter, TransformerLinLin(), DrawList, s.Marker, s.MarkerSize, s.RenderMarkerLine, col_line, s.MarkerWeight, s.RenderMarkerFill, col_fill); break;
-                case ImPlotScale_LogLin: RenderMarkers(getter, TransformerLogLin(), DrawList, s.Marker, s.MarkerSize, s.RenderMarkerLine, col_line, s.MarkerWeight, s.RenderMarkerFill, col_fill); break;
-                case ImPlotScale_LinLog: RenderMarkers(getter, TransformerLinLog(), DrawList, s.Marker, s.MarkerSize, s.RenderMarkerLine, col_line, s.MarkerWeight, s.RenderMarkerFill, col_fill); break;
-                case ImPlotScale_LogLog: RenderMarkers(getter, TransformerLogLog(), DrawList, s.Marker, s.MarkerSize, s.RenderMarkerLine, col_line, s.MarkerWeight, s.RenderMarkerFill, col_fill); break;
+            if (pixels != NULL) {
+                RenderMarkers(pixels, getter.Count, DrawList, s.Marker, s.MarkerSize, point_sizes, s.RenderMarkerLine, col_line, s.MarkerWeight, s.RenderMarkerFill, col_fill, point_cols);
+            }
+            else {
+                switch (GetCurrentScale()) {
+                    case ImPlotScale_LinLin: RenderMarkers(getter, TransformerLinLin(), DrawList, s.Marker, s.MarkerSize, s.RenderMarkerLine, col_line, s.MarkerWeight, s.RenderMarkerFill, col_fill); break;
+                    case ImPlotScale_LogLin: RenderMarkers(getter, TransformerLogLin(), DrawList, s.Marker, s.MarkerSize, s.RenderMarkerLine, col_line, s.MarkerWeight, s.RenderMarkerFill, col_fill); break;
+                    case ImPlotScale_LinLog: RenderMarkers(getter, TransformerLinLog(), DrawList, s.Marker, s.MarkerSize, s.RenderMarkerLine, col_line, s.MarkerWeight, s.RenderMarkerFill, col_fill); break;
+                    case ImPlotScale_LogLog: RenderMarkers(getter, TransformerLogLog(), DrawList, s.Marker, s.MarkerSize, s.RenderMarkerLine, col_line, s.MarkerWeight, s.RenderMarkerFill, col_fill); break;
+                }
             }
         }
         EndItem();
@@ -1024,6 +2123,16 @@ void PlotLineG(const char* label_id, ImPlotGetter getter_func, void* data, int c
     return PlotLineEx(label_id, getter);
 }
 
+void PlotLine(const char* label_id, const ImPlotColumn& ys, double xscale, double x0) {
+    GetterColumnY getter(ys, xscale, x0);
+    PlotLineEx(label_id, getter);
+}
+
+void PlotLine(const char* label_id, const ImPlotColumn& xs, const ImPlotColumn& ys) {
+    GetterColumnXY getter(xs, ys);
+    PlotLineEx(label_id, getter);
+}
+
 //-----------------------------------------------------------------------------
 // PLOT SCATTER
 //-----------------------------------------------------------------------------
@@ -1031,14 +2140,20 @@ void PlotLineG(const char* label_id, ImPlotGetter getter_func, void* data, int c
 template <typename Getter>
 IMPLOT_INLINE void PlotScatterEx(const char* label_id, const Getter& getter) {
     if (BeginItem(label_id, ImPlotCol_MarkerOutline)) {
+        AddItemPoints(getter.Count);
         if (FitThisFrame()) {
+            ImPlotFitTimer fit_timer;
             for (int i = 0; i < getter.Count; ++i) {
                 ImPlotPoint p = getter(i);
                 FitPoint(p);
             }
         }
+        FindNearest(getter);
         const ImPlotNextItemData& s = GetItemData();
         ImDrawList& DrawList = *GetPlotDrawList();
+        const ImU32* point_cols;
+        const float* point_sizes;
+        GetPointStyle(getter.Count, &point_cols, &point_sizes);
         // render markers
         ImPlotMarker marker = s.Marker == ImPlotMarker_None ? ImPlotMarker_Circle : s.Marker;
         if (marker != ImPlotMarker_None) {
@@ -1047,11 +2162,16 @@ IMPLOT_INLINE void PlotScatterEx(const char* label_id, const Getter& getter) {
             // PushPlotClipRect(s.MarkerSize);
             const ImU32 col_line = ImGui::GetColorU32(s.Colors[ImPlotCol_MarkerOutline]);
             const ImU32 col_fill = ImGui::GetColorU32(s.Colors[ImPlotCol_MarkerFill]);
-            switch (GetCurrentScale()) {
-                case ImPlotScale_LinLin: RenderMarkers(getter, TransformerLinLin(), DrawList, marker, s.MarkerSize, s.RenderMarkerLine, col_line, s.MarkerWeight, s.RenderMarkerFill, col_fill); break;
-                case ImPlotScale_LogLin: RenderMarkers(getter, TransformerLogLin(), DrawList, marker, s.MarkerSize, s.RenderMarkerLine, col_line, s.MarkerWeight, s.RenderMarkerFill, col_fill); break;
-                case ImPlotScale_LinLog: RenderMarkers(getter, TransformerLinLog(), DrawList, marker, s.MarkerSize, s.RenderMarkerLine, col_line, s.MarkerWeight, s.RenderMarkerFill, col_fill); break;
-                case ImPlotScale_LogLog: RenderMarkers(getter, TransformerLogLog(), DrawList, marker, s.MarkerSize, s.RenderMarkerLine, col_line, s.MarkerWeight, s.RenderMarkerFill, col_fill); break;
+            if (point_cols != NULL || point_sizes != NULL) {
+                RenderMarkers(TransformPoints(getter), getter.Count, DrawList, marker, s.MarkerSize, point_sizes, s.RenderMarkerLine, col_line, s.MarkerWeight, s.RenderMarkerFill, col_fill, point_cols);
+            }
+            else {
+                switch (GetCurrentScale()) {
+                    case ImPlotScale_LinLin: RenderMarkers(getter, TransformerLinLin(), DrawList, marker, s.MarkerSize, s.RenderMarkerLine, col_line, s.MarkerWeight, s.RenderMarkerFill, col_fill); break;
+                    case ImPlotScale_LogLin: RenderMarkers(getter, TransformerLogLin(), DrawList, marker, s.MarkerSize, s.RenderMarkerLine, col_line, s.MarkerWeight, s.RenderMarkerFill, col_fill); break;
+                    case ImPlotScale_LinLog: RenderMarkers(getter, TransformerLinLog(), DrawList, marker, s.MarkerSize, s.RenderMarkerLine, col_line, s.MarkerWeight, s.RenderMarkerFill, col_fill); break;
+                    case ImPlotScale_LogLog: RenderMarkers(getter, TransformerLogLog(), DrawList, marker, s.MarkerSize, s.RenderMarkerLine, col_line, s.MarkerWeight, s.RenderMarkerFill, col_fill); break;
+                }
             }
         }
         EndItem();
@@ -1098,6 +2218,16 @@ void PlotScatterG(const char* label_id, ImPlotGetter getter_func, void* data, in
     return PlotScatterEx(label_id, getter);
 }
 
+void PlotScatter(const char* label_id, const ImPlotColumn& ys, double xscale, double x0) {
+    GetterColumnY getter(ys, xscale, x0);
+    PlotScatterEx(label_id, getter);
+}
+
+void PlotScatter(const char* label_id, const ImPlotColumn& xs, const ImPlotColumn& ys) {
+    GetterColumnXY getter(xs, ys);
+    PlotScatterEx(label_id, getter);
+}
+
 //-----------------------------------------------------------------------------
 // PLOT STAIRS
 //-----------------------------------------------------------------------------
@@ -1105,7 +2235,9 @@ void PlotScatterG(const char* label_id, ImPlotGetter getter_func, void* data, in
 template <typename Getter>
 IMPLOT_INLINE void PlotStairsEx(const char* label_id, const Getter& getter) {
     if (BeginItem(label_id, ImPlotCol_Line)) {
+        AddItemPoints(getter.Count);
         if (FitThisFrame()) {
+            ImPlotFitTimer fit_timer;
             for (int i = 0; i < getter.Count; ++i) {
                 ImPlotPoint p = getter(i);
                 FitPoint(p);
@@ -1179,6 +2311,16 @@ void PlotStairsG(const char* label_id, ImPlotGetter getter_func, void* data, int
     return PlotStairsEx(label_id, getter);
 }
 
+void PlotStairs(const char* label_id, const ImPlotColumn& ys, double xscale, double x0) {
+    GetterColumnY getter(ys, xscale, x0);
+    PlotStairsEx(label_id, getter);
+}
+
+void PlotStairs(const char* label_id, const ImPlotColumn& xs, const ImPlotColumn& ys) {
+    GetterColumnXY getter(xs, ys);
+    PlotStairsEx(label_id, getter);
+}
+
 //-----------------------------------------------------------------------------
 // PLOT SHADED
 //-----------------------------------------------------------------------------
@@ -1186,7 +2328,9 @@ void PlotStairsG(const char* label_id, ImPlotGetter getter_func, void* data, int
 template <typename Getter1, typename Getter2>
 IMPLOT_INLINE void PlotShadedEx(const char* label_id, const Getter1& getter1, const Getter2& getter2, bool fit2) {
     if (BeginItem(label_id, ImPlotCol_Fill)) {
+        AddItemPoints(getter1.Count);
         if (FitThisFrame()) {
+            ImPlotFitTimer fit_timer;
             for (int i = 0; i < getter1.Count; ++i)
                 FitPoint(getter1(i));
             if (fit2) {
@@ -1297,8 +2441,10 @@ void PlotShadedG(const char* label_id, ImPlotGetter getter_func1, void* data1, I
 template <typename Getter>
 void PlotBarsEx(const char* label_id, const Getter& getter, double width) {
     if (BeginItem(label_id, ImPlotCol_Fill)) {
+        AddItemPoints(getter.Count);
         const double half_width = width / 2;
         if (FitThisFrame()) {
+            ImPlotFitTimer fit_timer;
             for (int i = 0; i < getter.Count; ++i) {
                 ImPlotPoint p = getter(i);
                 FitPoint(ImPlotPoint(p.x - half_width, p.y));
@@ -1312,6 +2458,9 @@ void PlotBarsEx(const char* label_id, const Getter& getter, double width) {
         bool  rend_line = s.RenderLine;
         if (s.RenderFill && col_line == col_fill)
             rend_line = false;
+        const ImU32* point_cols;
+        const float* point_sizes;
+        GetPointStyle(getter.Count, &point_cols, &point_sizes);
         for (int i = 0; i < getter.Count; ++i) {
             ImPlotPoint p = getter(i);
             if (p.y == 0)
@@ -1326,9 +2475,9 @@ void PlotBarsEx(const char* label_id, const Getter& getter, double width) {
             // a.x = IM_ROUND(a.x);
             // b.x = IM_ROUND(b.x);
             if (s.RenderFill)
-                DrawList.AddRectFilled(a, b, col_fill);
+                DrawList.AddRectFilled(a, b, PointColorU32(point_cols, i, col_fill));
             if (rend_line)
-                DrawList.AddRect(a, b, col_line, 0, ImDrawFlags_RoundCornersAll, s.LineWeight);
+                DrawList.AddRect(a, b, PointColorU32(point_cols, i, col_line), 0, ImDrawFlags_RoundCornersAll, s.LineWeight);
         }
         EndItem();
     }
@@ -1383,8 +2532,10 @@ void PlotBarsG(const char* label_id, ImPlotGetter getter_func, void* data, int c
 template <typename Getter, typename THeight>
 void PlotBarsHEx(const char* label_id, const Getter& getter, THeight height) {
     if (BeginItem(label_id, ImPlotCol_Fill)) {
+        AddItemPoints(getter.Count);
         const THeight half_height = height / 2;
         if (FitThisFrame()) {
+            ImPlotFitTimer fit_timer;
             for (int i = 0; i < getter.Count; ++i) {
                 ImPlotPoint p = getter(i);
                 FitPoint(ImPlotPoint(0, p.y - half_height));
@@ -1398,6 +2549,9 @@ void PlotBarsHEx(const char* label_id, const Getter& getter, THeight height) {
         bool  rend_line = s.RenderLine;
         if (s.RenderFill && col_line == col_fill)
             rend_line = false;
+        const ImU32* point_cols;
+        const float* point_sizes;
+        GetPointStyle(getter.Count, &point_cols, &point_sizes);
         for (int i = 0; i < getter.Count; ++i) {
             ImPlotPoint p = getter(i);
             if (p.x == 0)
@@ -1405,9 +2559,9 @@ void PlotBarsHEx(const char* label_id, const Getter& getter, THeight height) {
             ImVec2 a = PlotToPixels(0, p.y - half_height,IMPLOT_AUTO,IMPLOT_AUTO);
             ImVec2 b = PlotToPixels(p.x, p.y + half_height,IMPLOT_AUTO,IMPLOT_AUTO);
             if (s.RenderFill)
-                DrawList.AddRectFilled(a, b, col_fill);
+                DrawList.AddRectFilled(a, b, PointColorU32(point_cols, i, col_fill));
             if (rend_line)
-                DrawList.AddRect(a, b, col_line, 0, ImDrawFlags_RoundCornersAll, s.LineWeight);
+                DrawList.AddRect(a, b, PointColorU32(point_cols, i, col_line), 0, ImDrawFlags_RoundCornersAll, s.LineWeight);
         }
         EndItem();
     }
@@ -1460,7 +2614,9 @@ void PlotBarsHG(const char* label_id, ImPlotGetter getter_func, void* data, int
 template <typename Getter>
 void PlotErrorBarsEx(const char* label_id, const Getter& getter) {
     if (BeginItem(label_id)) {
+        AddItemPoints(getter.Count);
         if (FitThisFrame()) {
+            ImPlotFitTimer fit_timer;
             for (int i = 0; i < getter.Count; ++i) {
                 ImPlotPointError e = getter(i);
                 FitPoint(ImPlotPoint(e.X , e.Y - e.Neg));
@@ -1527,7 +2683,9 @@ template IMPLOT_API void PlotErrorBars<double>(const char* label_id, const doubl
 template <typename Getter>
 void PlotErrorBarsHEx(const char* label_id, const Getter& getter) {
     if (BeginItem(label_id)) {
+        AddItemPoints(getter.Count);
         if (FitThisFrame()) {
+            ImPlotFitTimer fit_timer;
             for (int i = 0; i < getter.Count; ++i) {
                 ImPlotPointError e = getter(i);
                 FitPoint(ImPlotPoint(e.X - e.Neg, e.Y));
@@ -1594,7 +2752,9 @@ template IMPLOT_API void PlotErrorBarsH<double>(const char* label_id, const doub
 template <typename GetterM, typename GetterB>
 IMPLOT_INLINE void PlotStemsEx(const char* label_id, const GetterM& get_mark, const GetterB& get_base) {
     if (BeginItem(label_id, ImPlotCol_Line)) {
+        AddItemPoints(get_base.Count);
         if (FitThisFrame()) {
+            ImPlotFitTimer fit_timer;
             for (int i = 0; i < get_base.Count; ++i) {
                 FitPoint(get_mark(i));
                 FitPoint(get_base(i));
@@ -1673,10 +2833,12 @@ template IMPLOT_API void PlotStems<double>(const char* label_id, const double* x
 template <typename T>
 void PlotVLines(const char* label_id, const T* xs, int count, int offset, int stride) {
     if (BeginItem(label_id, ImPlotCol_Line)) {
+        AddItemPoints(count);
         const ImPlotRect lims = GetPlotLimits(IMPLOT_AUTO,IMPLOT_AUTO);
         GetterXsYRef<T> get_min(xs,lims.Y.Min,count,offset,stride);
         GetterXsYRef<T> get_max(xs,lims.Y.Max,count,offset,stride);
         if (FitThisFrame()) {
+            ImPlotFitTimer fit_timer;
             for (int i = 0; i < get_min.Count; ++i)
                 FitPointX(get_min(i).x);
         }
@@ -1711,10 +2873,12 @@ template IMPLOT_API void PlotVLines<double>(const char* label_id, const double*
 template <typename T>
 void PlotHLines(const char* label_id, const T* ys, int count, int offset, int stride) {
     if (BeginItem(label_id, ImPlotCol_Line)) {
+        AddItemPoints(count);
         const ImPlotRect lims = GetPlotLimits(IMPLOT_AUTO,IMPLOT_AUTO);
         GetterXRefYs<T> get_min(lims.X.Min,ys,count,offset,stride);
         GetterXRefYs<T> get_max(lims.X.Max,ys,count,offset,stride);
         if (FitThisFrame()) {
+            ImPlotFitTimer fit_timer;
             for (int i = 0; i < get_min.Count; ++i)
                 FitPointY(get_min(i).y);
         }
@@ -1778,7 +2942,9 @@ void PlotPieChart(const char* const label_ids[], const T* values, int count, dou
         double percent = normalize ? (double)values[i] / sum : (double)values[i];
         a1 = a0 + 2 * IM_PI * percent;
         if (BeginItem(label_ids[i])) {
+            AddItemPoints(1);
             if (FitThisFrame()) {
+                ImPlotFitTimer fit_timer;
                 FitPoint(ImPlotPoint(x-radius,y-radius));
                 FitPoint(ImPlotPoint(x+radius,y+radius));
             }
@@ -1843,6 +3009,7 @@ struct RectRenderer {
         Transformer(transformer),
         Prims(Getter.Count)
     {}
+    IMPLOT_INLINE void Seek(int) const { }
     IMPLOT_INLINE bool operator()(ImDrawList& DrawList, const ImRect& cull_rect, const ImVec2& uv, int prim) const {
         RectInfo rect = Getter(prim);
         ImVec2 P1 = Transformer(rect.Min);
@@ -1851,20 +3018,10 @@ struct RectRenderer {
         if ((rect.Color & IM_COL32_A_MASK) == 0 || !cull_rect.Overlaps(ImRect(ImMin(P1, P2), ImMax(P1, P2))))
             return false;
 
-        DrawList._VtxWritePtr[0].pos   = P1;
-        DrawList._VtxWritePtr[0].uv    = uv;
-        DrawList._VtxWritePtr[0].col   = rect.Color;
-        DrawList._VtxWritePtr[1].pos.x = P1.x;
-        DrawList._VtxWritePtr[1].pos.y = P2.y;
-        DrawList._VtxWritePtr[1].uv    = uv;
-        DrawList._VtxWritePtr[1].col   = rect.Color;
-        DrawList._VtxWritePtr[2].pos   = P2;
-        DrawList._VtxWritePtr[2].uv    = uv;
-        DrawList._VtxWritePtr[2].col   = rect.Color;
-        DrawList._VtxWritePtr[3].pos.x = P2.x;
-        DrawList._VtxWritePtr[3].pos.y = P1.y;
-        DrawList._VtxWritePtr[3].uv    = uv;
-        DrawList._VtxWritePtr[3].col   = rect.Color;
+        DrawList.SetVtx(&DrawList._VtxWritePtr[0], P1, uv, rect.Color);
+        DrawList.SetVtx(&DrawList._VtxWritePtr[1], ImVec2(P1.x, P2.y), uv, rect.Color);
+        DrawList.SetVtx(&DrawList._VtxWritePtr[2], P2, uv, rect.Color);
+        DrawList.SetVtx(&DrawList._VtxWritePtr[3], ImVec2(P2.x, P1.y), uv, rect.Color);
         DrawList._VtxWritePtr += 4;
         DrawList._IdxWritePtr[0] = (ImDrawIdx)(DrawList._VtxCurrentIdx);
         DrawList._IdxWritePtr[1] = (ImDrawIdx)(DrawList._VtxCurrentIdx + 1);
@@ -1972,7 +3129,9 @@ void RenderHeatmap(Transformer transformer, ImDrawList& DrawList, const T* value
 template <typename T>
 void PlotHeatmap(const char* label_id, const T* values, int rows, int cols, double scale_min, double scale_max, const char* fmt, const ImPlotPoint& bounds_min, const ImPlotPoint& bounds_max) {
     if (BeginItem(label_id)) {
+        AddItemPoints(rows * cols);
         if (FitThisFrame()) {
+            ImPlotFitTimer fit_timer;
             FitPoint(bounds_min);
             FitPoint(bounds_max);
         }
@@ -2146,7 +3305,9 @@ double PlotHistogram2D(const char* label_id, const T* xs, const T* ys, int count
     }
 
     if (BeginItem(label_id)) {
+        AddItemPoints(count);
         if (FitThisFrame()) {
+            ImPlotFitTimer fit_timer;
             FitPoint(range.Min());
             FitPoint(range.Max());
         }
@@ -2182,6 +3343,7 @@ template IMPLOT_API double PlotHistogram2D<double>(const char* label_id, const d
 template <typename Getter>
 IMPLOT_INLINE void PlotDigitalEx(const char* label_id, Getter getter) {
     if (BeginItem(label_id, ImPlotCol_Fill)) {
+        AddItemPoints(getter.Count);
         ImPlotContext& gp = *GImPlot;
         ImDrawList& DrawList = *GetPlotDrawList();
         const ImPlotNextItemData& s = GetItemData();
@@ -2269,6 +3431,7 @@ void PlotDigitalG(const char* label_id, ImPlotGetter getter_func, void* data, in
 void PlotImage(const char* label_id, ImTextureID user_texture_id, const ImPlotPoint& bmin, const ImPlotPoint& bmax, const ImVec2& uv0, const ImVec2& uv1, const ImVec4& tint_col) {
     if (BeginItem(label_id)) {
         if (FitThisFrame()) {
+            ImPlotFitTimer fit_timer;
             FitPoint(bmin);
             FitPoint(bmax);
         }
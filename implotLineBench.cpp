@@ -0,0 +1,117 @@
+//{{{
+// implotLineBench - implot PlotLine/PlotStairs ms/frame on big items, draw list size + draw cmds, no window or gpu needed
+//   implotLineBench [points] [frames] [threads]   default 1000000 points, 60 frames, 1 thread (serial tessellation)
+//}}}
+//{{{  includes
+#include "imgui.h"
+#include "implot.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <chrono>
+#include <vector>
+//}}}
+
+//{{{
+static double seconds (std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  }
+//}}}
+//{{{
+static double frame (const char* title, const std::vector<float>& xs, const std::vector<float>& ys,
+                     bool stairs, ImPlotFlags flags, double xMin, double xMax, int& cmds, int& vertices) {
+// one frame, one plot, one item, returns ms spent in BeginPlot .. EndPlot
+
+  ImGui::GetIO().DeltaTime = 1.0f / 60.0f;
+  ImGui::NewFrame();
+
+  ImGui::SetNextWindowPos (ImVec2(0.f, 0.f));
+  ImGui::SetNextWindowSize (ImGui::GetIO().DisplaySize);
+  ImGui::Begin ("bench", nullptr, ImGuiWindowFlags_NoDecoration);
+
+  auto start = std::chrono::steady_clock::now();
+  if (ImPlot::BeginPlot (title, ImVec2(-1.f, -1.f), flags)) {
+    ImPlot::SetupAxesLimits (xMin, xMax, -1.0, 1.0, ImGuiCond_Always);
+    if (stairs)
+      ImPlot::PlotStairs ("item", xs.data(), ys.data(), (int)xs.size());
+    else
+      ImPlot::PlotLine ("item", xs.data(), ys.data(), (int)xs.size());
+    ImPlot::EndPlot();
+    }
+  const double ms = seconds (start) * 1000.0;
+
+  ImGui::End();
+  ImGui::Render();
+
+  // plot draw list is the window's
+  const ImDrawData* drawData = ImGui::GetDrawData();
+  cmds = 0;
+  for (int i = 0; i < drawData->CmdListsCount; i++)
+    cmds += drawData->CmdLists[i]->CmdBuffer.Size;
+  vertices = drawData->TotalVtxCount;
+  return ms;
+  }
+//}}}
+//{{{
+static void bench (const char* name, const std::vector<float>& xs, const std::vector<float>& ys,
+                   bool stairs, ImPlotFlags flags, double visible, int frames, int threads) {
+// fresh contexts, first frame grows the draw list buffers, the rest reuse them
+
+  ImGui::CreateContext();
+  ImPlot::CreateContext();
+  ImPlot::SetThreadsCount (threads);
+
+  // renderers split big draw lists with ImDrawCmd::VtxOffset, as every backend here does
+  ImGuiIO& io = ImGui::GetIO();
+  io.IniFilename = nullptr;
+  io.DisplaySize = ImVec2 (1920.f, 1080.f);
+  io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;
+  unsigned char* pixels;
+  int width;
+  int height;
+  io.Fonts->GetTexDataAsRGBA32 (&pixels, &width, &height);
+
+  int cmds;
+  int vertices;
+  const double first = frame (name, xs, ys, stairs, flags, 0.0, visible, cmds, vertices);
+
+  double total = 0.0;
+  double most = 0.0;
+  for (int i = 0; i < frames; i++) {
+    const double ms = frame (name, xs, ys, stairs, flags, 0.0, visible, cmds, vertices);
+    total += ms;
+    most = ms > most ? ms : most;
+    }
+
+  printf ("%-10s %3.0f%% visible first %7.2f ms, %7.2f ms/frame max %7.2f ms, %5d cmds %9d vertices\n",
+          name, visible * 100.0, first, total / frames, most, cmds, vertices);
+
+  ImPlot::SetThreadsCount (1);
+  ImPlot::DestroyContext();
+  ImGui::DestroyContext();
+  }
+//}}}
+
+int main (int argc, char** argv) {
+
+  int points = (argc > 1) ? atoi (argv[1]) : 1000000;
+  int frames = (argc > 2) ? atoi (argv[2]) : 60;
+  int threads = (argc > 3) ? atoi (argv[3]) : 1;
+
+  std::vector<float> xs (points);
+  std::vector<float> ys (points);
+  for (int i = 0; i < points; i++) {
+    xs[i] = (float)i / points;
+    ys[i] = 0.8f * sinf (xs[i] * 300.f);
+    }
+
+  IMGUI_CHECKVERSION();
+  printf ("%d points, %d bit ImDrawIdx, %d threads\n", points, (int)sizeof(ImDrawIdx) * 8, threads);
+  for (double visible : { 1.0, 0.5, 0.02 }) {
+    bench ("line", xs, ys, false, ImPlotFlags_None, visible, frames, threads);
+    bench ("stairs", xs, ys, true, ImPlotFlags_None, visible, frames, threads);
+    bench ("aa line", xs, ys, false, ImPlotFlags_AntiAliased, visible, frames, threads);
+    }
+
+  return 0;
+  }
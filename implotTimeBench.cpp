@@ -0,0 +1,166 @@
+//{{{
+// implotTimeBench - implot time axis tick generation from microseconds to decades, utc + local time, no window or gpu needed
+//   implotTimeBench [generations]   local time zone from TZ
+//}}}
+//{{{  includes
+#include "imgui.h"
+#include "implot.h"
+#include "implot_internal.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <chrono>
+//}}}
+
+//{{{
+static double seconds (std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  }
+//}}}
+//{{{
+static time_t randomTime (unsigned int& seed) {
+// xorshift, 1970 .. 3000 like IMPLOT_MAX_TIME
+
+  seed ^= seed << 13;
+  seed ^= seed >> 17;
+  seed ^= seed << 5;
+  return (time_t)((double)seed / 4294967296.0 * IMPLOT_MAX_TIME);
+  }
+//}}}
+//{{{
+static void benchTicks (bool localTime, int generations) {
+// AddTicksTime panning across a window of each span, labels formatted + measured as SetupFinish does
+
+  static const double kSpans[] = { 2e-5, 1e-3, 0.05, 1, 30, 600, 6*3600, 3*86400, 40*86400,
+                                   400*86400, 6*365.25*86400, 40*365.25*86400, 300*365.25*86400 };
+  ImPlot::GetStyle().UseLocalTime = localTime;
+
+  for (double span : kSpans) {
+    int ticks = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < generations; i++) {
+      const double t0 = 1.6e9 + (i % 50) * span * 0.02;
+      ImPlotTickCollection collection;
+      ImPlot::AddTicksTime (ImPlotRange (t0, t0 + span), 1200.f, collection);
+      ticks += collection.Size;
+      }
+    printf ("%s span %12.6gs %7.2f us/generation %4d ticks\n",
+            localTime ? "local" : "utc  ", span, seconds (start) * 1e6 / generations, ticks / generations);
+    }
+  }
+//}}}
+//{{{
+static void benchConversions (int count) {
+// ImPlot civil time against libc, ns per call
+
+  tm Tm;
+  unsigned int seed = 12345;
+  volatile int sink = 0;
+
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < count; i++) {
+    time_t t = randomTime (seed);
+    #ifdef _WIN32
+      gmtime_s (&Tm, &t);
+    #else
+      gmtime_r (&t, &Tm);
+    #endif
+    sink += Tm.tm_mday;
+    }
+  const double libcGmt = seconds (start);
+
+  seed = 12345;
+  start = std::chrono::steady_clock::now();
+  for (int i = 0; i < count; i++) {
+    ImPlot::GetGmtTime (ImPlotTime (randomTime (seed)), &Tm);
+    sink += Tm.tm_mday;
+    }
+  const double implotGmt = seconds (start);
+
+  seed = 12345;
+  start = std::chrono::steady_clock::now();
+  for (int i = 0; i < count; i++) {
+    time_t t = randomTime (seed);
+    #ifdef _WIN32
+      localtime_s (&Tm, &t);
+    #else
+      localtime_r (&t, &Tm);
+    #endif
+    sink += Tm.tm_mday;
+    }
+  const double libcLoc = seconds (start);
+
+  // first pass builds the time zone table for every year, second pass is the cached cost
+  ImPlot::BustTimeZoneCache();
+  seed = 12345;
+  start = std::chrono::steady_clock::now();
+  for (int i = 0; i < count; i++) {
+    ImPlot::GetLocTime (ImPlotTime (randomTime (seed)), &Tm);
+    sink += Tm.tm_mday;
+    }
+  const double implotLocCold = seconds (start);
+
+  seed = 12345;
+  start = std::chrono::steady_clock::now();
+  for (int i = 0; i < count; i++) {
+    ImPlot::GetLocTime (ImPlotTime (randomTime (seed)), &Tm);
+    sink += Tm.tm_mday;
+    }
+  const double implotLoc = seconds (start);
+
+  seed = 12345;
+  start = std::chrono::steady_clock::now();
+  for (int i = 0; i < count; i++) {
+    time_t t = randomTime (seed);
+    #ifdef _WIN32
+      localtime_s (&Tm, &t);
+    #else
+      localtime_r (&t, &Tm);
+    #endif
+    Tm.tm_isdst = -1;
+    sink += (int)mktime (&Tm);
+    }
+  const double libcMk = seconds (start) - libcLoc;
+
+  seed = 12345;
+  start = std::chrono::steady_clock::now();
+  for (int i = 0; i < count; i++) {
+    ImPlot::GetLocTime (ImPlotTime (randomTime (seed)), &Tm);
+    sink += (int)ImPlot::MkLocTime (&Tm).S;
+    }
+  const double implotMk = seconds (start) - implotLoc;
+
+  printf ("gmtime    libc %6.1f ns, implot %6.1f ns\n", libcGmt * 1e9 / count, implotGmt * 1e9 / count);
+  printf ("localtime libc %6.1f ns, implot %6.1f ns, %.1f ms to build %d time zone spans\n",
+          libcLoc * 1e9 / count, implotLoc * 1e9 / count, (implotLocCold - implotLoc) * 1e3, GImPlot->TimeZoneSpans.Size);
+  printf ("mktime    libc %6.1f ns, implot %6.1f ns\n", libcMk * 1e9 / count, implotMk * 1e9 / count);
+  }
+//}}}
+
+int main (int argc, char** argv) {
+
+  int generations = (argc > 1) ? atoi (argv[1]) : 1000;
+
+  IMGUI_CHECKVERSION();
+  ImGui::CreateContext();
+  ImPlot::CreateContext();
+
+  // labels are measured, needs a font and a frame
+  ImGuiIO& io = ImGui::GetIO();
+  io.IniFilename = nullptr;
+  io.DisplaySize = ImVec2 (1920.f, 1080.f);
+  unsigned char* pixels;
+  int width;
+  int height;
+  io.Fonts->GetTexDataAsRGBA32 (&pixels, &width, &height);
+  ImGui::NewFrame();
+
+  benchTicks (false, generations);
+  benchTicks (true, generations);
+  benchConversions (generations * 1000);
+
+  ImGui::EndFrame();
+  ImPlot::DestroyContext();
+  ImGui::DestroyContext();
+  return 0;
+  }
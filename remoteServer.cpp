@@ -0,0 +1,75 @@
+//{{{
+// remoteServer - headless imgui + implot demo windows served with imgui_impl_remote, no window or gpu needed
+//   remoteServer [address]   default tcp:7007, view with remoteViewer [address]
+//}}}
+//{{{  includes
+#include "imgui.h"
+#include "implot.h"
+#include "imgui_impl_remote.h"
+#include <stdio.h>
+//}}}
+
+int main (int argc, char** argv) {
+
+  const char* address = (argc > 1) ? argv[1] : "tcp:7007";
+
+  IMGUI_CHECKVERSION();
+  ImGui::CreateContext();
+  ImPlot::CreateContext();
+  ImGuiIO& io = ImGui::GetIO();
+  io.IniFilename = nullptr;
+  io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;
+  ImGui::StyleColorsDark();
+
+  // no platform backend, remote becomes the platform + renderer, the viewer window is the display
+  if (!ImGui_ImplRemote_Init (address)) {
+    printf ("remoteServer failed to listen on %s\n", address);
+    return 1;
+    }
+  printf ("remoteServer listening on %s\n", address);
+
+  bool show_demo_window = true;
+  bool show_plot_demo_window = true;
+  bool quit = false;
+  bool connected = false;
+
+  while (!quit) {
+    // wake on viewer input, otherwise 60 fps while viewed, 1 fps when nobody is watching
+    ImGui_ImplRemote_WaitEvents (ImGui_ImplRemote_IsViewerConnected() ? 1.0 / 60.0 : 1.0);
+
+    ImGui_ImplRemote_NewFrame();
+    if (connected != ImGui_ImplRemote_IsViewerConnected()) {
+      connected = !connected;
+      printf ("viewer %s\n", connected ? "connected" : "disconnected");
+      }
+    ImGui::NewFrame();
+
+    if (show_demo_window)
+      ImGui::ShowDemoWindow (&show_demo_window);
+    if (show_plot_demo_window)
+      ImPlot::ShowDemoWindow (&show_plot_demo_window);
+
+    ImGui::Begin ("remoteServer");
+    ImGui::Checkbox ("Demo Window", &show_demo_window);
+    ImGui::Checkbox ("Plot Demo Window", &show_plot_demo_window);
+
+    ImGui_ImplRemote_Stats stats;
+    ImGui_ImplRemote_GetStats (&stats);
+    ImGui::Text ("frames sent:%d dropped:%d", stats.FramesSent, stats.FramesDropped);
+    ImGui::Text ("drawLists sent:%d skipped:%d", stats.ListsSent, stats.ListsSkipped);
+    ImGui::Text ("%.1f MB raw, %.1f MB sent, %.1fx", stats.RawBytes / 1000000.0, stats.SentBytes / 1000000.0,
+                 stats.SentBytes ? (double)stats.RawBytes / (double)stats.SentBytes : 0.0);
+    if (ImGui::Button ("quit server"))
+      quit = true;
+    ImGui::End();
+
+    ImGui::Render();
+    ImGui_ImplRemote_RenderDrawData (ImGui::GetDrawData());
+    }
+
+  // Cleanup
+  ImGui_ImplRemote_Shutdown();
+  ImPlot::DestroyContext();
+  ImGui::DestroyContext();
+  return 0;
+  }
@@ -0,0 +1,156 @@
+//{{{
+// remoteViewer - render an imgui_impl_remote server with GLFW + OpenGL3, send our input back
+//   remoteViewer [address]   default tcp:7007, tcp:host:port or unix:path
+//}}}
+//{{{  includes
+#include "imgui.h"
+#include "imgui_impl_glfw.h"
+#include "imgui_impl_opengl3.h"
+#include "imgui_impl_remote.h"
+#include <stdio.h>
+#include <string.h>
+#include <string>
+
+#include <GLFW/glfw3.h> // Will drag system OpenGL headers
+//}}}
+
+//{{{
+static void glfw_error_callback(int error, const char* description) {
+  fprintf(stderr, "Glfw Error %d: %s\n", error, description);
+  }
+//}}}
+//{{{
+static void setFontAtlas (ImGui_ImplRemote_Client* client) {
+// server atlas replaces ours, renderer texture rebuilt from it
+
+  const unsigned int* pixels;
+  int width;
+  int height;
+  bool changed;
+  if (!ImGui_ImplRemote_GetFontAtlas (client, &pixels, &width, &height, &changed) || !changed)
+    return;
+
+  ImFontAtlas* fonts = ImGui::GetIO().Fonts;
+  size_t bytes = (size_t)width * height * 4;
+  IM_FREE (fonts->TexPixelsRGBA32);
+  fonts->TexPixelsRGBA32 = (unsigned int*)IM_ALLOC (bytes);
+  memcpy (fonts->TexPixelsRGBA32, pixels, bytes);
+  fonts->TexWidth = width;
+  fonts->TexHeight = height;
+
+  ImGui_ImplOpenGL3_DestroyFontsTexture();
+  ImGui_ImplOpenGL3_CreateFontsTexture();
+  ImGui_ImplRemote_SetTextureID (client, fonts->TexID);
+  }
+//}}}
+
+int main (int argc, char** argv) {
+
+  const char* address = (argc > 1) ? argv[1] : "tcp:7007";
+
+  // Setup window
+  glfwSetErrorCallback (glfw_error_callback);
+  if (!glfwInit())
+    return 1;
+
+  // Decide GL+GLSL versions
+  #if defined(__APPLE__)
+    //{{{  GL 3.2 + GLSL 150
+    const char* glsl_version = "#version 150";
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 2);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);  // 3.2+ only
+    glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);            // Required on Mac
+    //}}}
+  #else
+    //{{{  GL 3.0 + GLSL 130
+    const char* glsl_version = "#version 130";
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
+    //}}}
+  #endif
+
+  std::string title = std::string("remoteViewer ") + address;
+  GLFWwindow* window = glfwCreateWindow (1280, 720, title.c_str(), NULL, NULL);
+  if (window == NULL)
+    return 1;
+  glfwMakeContextCurrent (window);
+  glfwSwapInterval (1);
+
+  // our context only carries input and the renderer, ImGui::NewFrame is never called
+  IMGUI_CHECKVERSION();
+  ImGui::CreateContext();
+  ImGuiIO& io = ImGui::GetIO();
+  io.IniFilename = nullptr;
+
+  ImGui_ImplGlfw_InitForOpenGL (window, true);
+  ImGui_ImplOpenGL3_Init (glsl_version);
+  ImGui_ImplOpenGL3_NewFrame();
+
+  ImGui_ImplRemote_Client* client = nullptr;
+  double connectTime = 0.0;
+
+  while (!glfwWindowShouldClose (window)) {
+    //{{{  main loop
+    glfwPollEvents();
+
+    if (!ImGui_ImplRemote_IsConnected (client)) {
+      //{{{  (re)connect, once a second
+      if (client) {
+        printf ("remoteViewer disconnected from %s\n", address);
+        ImGui_ImplRemote_Disconnect (client);
+        client = nullptr;
+        }
+
+      if (glfwGetTime() - connectTime < 1.0) {
+        glfwWaitEventsTimeout (0.1);
+        continue;
+        }
+      connectTime = glfwGetTime();
+
+      client = ImGui_ImplRemote_Connect (address);
+      if (!client)
+        continue;
+      printf ("remoteViewer connected to %s\n", address);
+      ImGui_ImplRemote_SetTextureID (client, io.Fonts->TexID);
+      }
+      //}}}
+
+    // platform backend fills our io, the server gets it as its input
+    ImGui_ImplGlfw_NewFrame();
+    ImGui_ImplRemote_SendInput (client, io);
+
+    // short wait keeps glfw events flowing while the server has nothing new
+    ImDrawData* drawData = ImGui_ImplRemote_ReceiveFrame (client, 1.0 / 240.0);
+    setFontAtlas (client);
+    if (!drawData)
+      continue;
+
+    // server cursor shape, glfw backend applies it on the next NewFrame
+    ImGui::SetMouseCursor (ImGui_ImplRemote_GetMouseCursor (client));
+
+    // draw 1:1 into our window, the server display size follows ours a frame later
+    drawData->DisplaySize = io.DisplaySize;
+    drawData->FramebufferScale = io.DisplayFramebufferScale;
+
+    int display_w, display_h;
+    glfwGetFramebufferSize (window, &display_w, &display_h);
+    glViewport (0, 0, display_w, display_h);
+    glClearColor (0.45f, 0.55f, 0.60f, 1.00f);
+    glClear (GL_COLOR_BUFFER_BIT);
+    ImGui_ImplOpenGL3_RenderDrawData (drawData);
+    glfwSwapBuffers (window);
+    }
+    //}}}
+
+  // Cleanup
+  ImGui_ImplRemote_Disconnect (client);
+  ImGui_ImplOpenGL3_Shutdown();
+  ImGui_ImplGlfw_Shutdown();
+  ImGui::DestroyContext();
+
+  glfwDestroyWindow (window);
+  glfwTerminate();
+
+  return 0;
+  }
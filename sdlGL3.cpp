@@ -9,6 +9,7 @@
 #include "imgui.h"
 #include "imgui_impl_sdl.h"
 #include "imgui_impl_opengl3.h"
+#include "utils/cIdleLoop.h"
 
 #include <stdio.h>
 
@@ -22,6 +23,17 @@
 #endif
 //}}}
 
+//{{{
+static void wakeEventWait() {
+// push dummy event to wake SDL_WaitEventTimeout from another thread
+
+  SDL_Event event;
+  SDL_zero (event);
+  event.type = SDL_USEREVENT;
+  SDL_PushEvent (&event);
+  }
+//}}}
+
 int main (int numArgs, char* args[]) {
 
   (void)numArgs; 
@@ -122,6 +134,10 @@ int main (int numArgs, char* args[]) {
   bool show_another_window = false;
   ImVec4 clear_color = ImVec4(0.45f, 0.55f, 0.60f, 1.00f);
 
+  // block on events when idle, skip render + swap when frame unchanged
+  cIdleLoop idleLoop;
+  idleLoop.setWakeFunc (wakeEventWait);
+
   // Main loop
   bool done = false;
   while (!done) {
@@ -132,12 +148,16 @@ int main (int numArgs, char* args[]) {
     // - When io.WantCaptureKeyboard is true, do not dispatch keyboard input data to your main application.
     // Generally you may always pass all inputs to dear imgui, and hide them from your application based on those two flags.
     SDL_Event event;
-    while (SDL_PollEvent (&event)) {
+    bool gotEvent = idleLoop.waitEvent (&event, SDL_PollEvent, SDL_WaitEventTimeout);
+    while (gotEvent) {
       ImGui_ImplSDL2_ProcessEvent (&event);
       if (event.type == SDL_QUIT)
         done = true;
       if (event.type == SDL_WINDOWEVENT && event.window.event == SDL_WINDOWEVENT_CLOSE && event.window.windowID == SDL_GetWindowID(window))
          done = true;
+      if (event.type == SDL_WINDOWEVENT && event.window.event == SDL_WINDOWEVENT_EXPOSED)
+        idleLoop.forceRender();
+      gotEvent = SDL_PollEvent (&event);
       }
 
     // Start the Dear ImGui frame
@@ -168,7 +188,15 @@ int main (int numArgs, char* args[]) {
     ImGui::SameLine();
     ImGui::Text ("counter = %d", counter);
 
-    ImGui::Text ("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / ImGui::GetIO().Framerate, ImGui::GetIO().Framerate);
+    // idle loop only renders when the frame changes, a per frame fps readout would change every frame
+    bool idle = idleLoop.getEnabled();
+    if (ImGui::Checkbox ("idle loop", &idle))
+      idleLoop.setEnabled (idle);
+    if (ImGui::IsItemHovered())
+      ImGui::SetTooltip ("frames:%llu renders:%llu waits:%llu %.1fs", (unsigned long long)idleLoop.getFrames(), (unsigned long long)idleLoop.getRenders(),
+                         (unsigned long long)idleLoop.getWaits(), idleLoop.getWaitSeconds());
+    if (!idle)
+      ImGui::Text ("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / ImGui::GetIO().Framerate, ImGui::GetIO().Framerate);
     ImGui::End();
     }
 
@@ -183,10 +211,13 @@ int main (int numArgs, char* args[]) {
 
     // Rendering
     ImGui::Render();
-    glViewport(0, 0, (int)io.DisplaySize.x, (int)io.DisplaySize.y);
-    glClearColor(clear_color.x * clear_color.w, clear_color.y * clear_color.w, clear_color.z * clear_color.w, clear_color.w);
-    glClear(GL_COLOR_BUFFER_BIT);
-    ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+    bool render = idleLoop.isDrawDataChanged();
+    if (render) {
+      glViewport(0, 0, (int)io.DisplaySize.x, (int)io.DisplaySize.y);
+      glClearColor(clear_color.x * clear_color.w, clear_color.y * clear_color.w, clear_color.z * clear_color.w, clear_color.w);
+      glClear(GL_COLOR_BUFFER_BIT);
+      ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+      }
 
     #ifdef DOCKING
       if (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable) {
@@ -196,12 +227,14 @@ int main (int numArgs, char* args[]) {
         SDL_Window* backup_current_window = SDL_GL_GetCurrentWindow();
         SDL_GLContext backup_current_context = SDL_GL_GetCurrentContext();
         ImGui::UpdatePlatformWindows();
-        ImGui::RenderPlatformWindowsDefault();
+        if (render)
+          ImGui::RenderPlatformWindowsDefault();
         SDL_GL_MakeCurrent(backup_current_window, backup_current_context);
         }
     #endif
 
-    SDL_GL_SwapWindow(window);
+    if (render)
+      SDL_GL_SwapWindow(window);
     }
     //}}}
 
@@ -0,0 +1,189 @@
+//{{{
+// softrasterBench - imgui_impl_softraster ms/frame on the imgui + implot demo windows, no window or gpu needed
+//   softrasterBench [frames] [width] [height] [out.ppm]
+//}}}
+//{{{  includes
+#include "imgui.h"
+#include "implot.h"
+#include "imgui_impl_softraster.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <vector>
+//}}}
+
+//{{{
+static void newFrame (double time) {
+// imgui + implot demo windows and style editor, spread over the framebuffer
+
+  ImGui::GetIO().DeltaTime = 1.0f / 60.0f;
+  ImGui::NewFrame();
+
+  ImGui::SetNextWindowPos (ImVec2(10.f, 10.f), ImGuiCond_Once);
+  ImGui::SetNextWindowSize (ImVec2(550.f, 680.f), ImGuiCond_Once);
+  ImGui::ShowDemoWindow();
+
+  ImGui::SetNextWindowPos (ImVec2(580.f, 10.f), ImGuiCond_Once);
+  ImGui::SetNextWindowSize (ImVec2(600.f, 750.f), ImGuiCond_Once);
+  ImPlot::ShowDemoWindow();
+
+  ImGui::SetNextWindowPos (ImVec2(1200.f, 10.f), ImGuiCond_Once);
+  ImGui::SetNextWindowSize (ImVec2(500.f, 500.f), ImGuiCond_Once);
+  ImGui::Begin ("Style Editor");
+  ImGui::ShowStyleEditor();
+  ImGui::End();
+
+  // some per frame movement, text and curves, so frames aren't all identical
+  ImGui::SetNextWindowPos (ImVec2(1200.f, 530.f), ImGuiCond_Once);
+  ImGui::SetNextWindowSize (ImVec2(500.f, 300.f), ImGuiCond_Once);
+  ImGui::Begin ("bench");
+  ImGui::Text ("time %.3f", time);
+  ImDrawList* drawList = ImGui::GetWindowDrawList();
+  ImVec2 pos = ImGui::GetCursorScreenPos();
+  for (int i = 0; i < 32; i++)
+    drawList->AddCircleFilled (ImVec2(pos.x + 20.f + i * 14.f, pos.y + 60.f + 40.f * (float)sin (time * 2.0 + i * 0.3)),
+                               6.f, IM_COL32(255, 128 + i * 4, 64, 200));
+  drawList->AddBezierCubic (ImVec2(pos.x, pos.y + 200.f), ImVec2(pos.x + 150.f, pos.y + 100.f),
+                            ImVec2(pos.x + 300.f, pos.y + 250.f), ImVec2(pos.x + 450.f, pos.y + 150.f), IM_COL32_WHITE, 3.f);
+  ImGui::End();
+
+  ImGui::Render();
+  }
+//}}}
+//{{{
+static bool writePpm (const char* fileName, const std::vector<unsigned int>& pixels, int width, int height) {
+
+  FILE* file = fopen (fileName, "wb");
+  if (!file)
+    return false;
+
+  fprintf (file, "P6\n%d %d\n255\n", width, height);
+  std::vector<unsigned char> row (width * 3);
+  for (int y = 0; y < height; y++) {
+    for (int x = 0; x < width; x++) {
+      unsigned int pixel = pixels[y * width + x];
+      row[x*3] = pixel & 0xFF;
+      row[x*3 + 1] = (pixel >> 8) & 0xFF;
+      row[x*3 + 2] = (pixel >> 16) & 0xFF;
+      }
+    fwrite (row.data(), 1, row.size(), file);
+    }
+
+  fclose (file);
+  return true;
+  }
+//}}}
+
+int main (int argc, char** argv) {
+
+  int frames = (argc > 1) ? atoi (argv[1]) : 200;
+  int width = (argc > 2) ? atoi (argv[2]) : 1920;
+  int height = (argc > 3) ? atoi (argv[3]) : 1080;
+  const char* ppmFileName = (argc > 4) ? argv[4] : nullptr;
+
+  IMGUI_CHECKVERSION();
+  ImGui::CreateContext();
+  ImPlot::CreateContext();
+
+  ImGuiIO& io = ImGui::GetIO();
+  io.IniFilename = nullptr;
+  io.DisplaySize = ImVec2 ((float)width, (float)height);
+  ImGui::StyleColorsDark();
+
+  ImGui_ImplSoftRaster_Init();
+  int maxThreads = ImGui_ImplSoftRaster_GetThreadsCount();
+
+  std::vector<unsigned int> pixels (width * height);
+  const unsigned int clearColour = IM_COL32(115, 140, 153, 255);
+
+  // settle layout, window sizes, auto fit columns
+  double time = 0.0;
+  for (int i = 0; i < 10; i++, time += 1.0 / 60.0) {
+    ImGui_ImplSoftRaster_NewFrame();
+    newFrame (time);
+    }
+
+  ImDrawData* drawData = ImGui::GetDrawData();
+  ImDrawDataMerger drawDataMerger;
+  drawDataMerger.Merge (drawData);
+  printf ("softrasterBench %dx%d %d frames, %d drawLists %d vertices %d indices, %d draw calls %d merged\n",
+          width, height, frames, drawData->CmdListsCount, drawData->TotalVtxCount, drawData->TotalIdxCount,
+          drawDataMerger.CmdCountIn, drawDataMerger.CmdCountOut);
+
+  // time rasterization only, the imgui frame is rebuilt outside the timed region
+  for (int threads = 1; ; threads = (threads * 2 > maxThreads) ? maxThreads : threads * 2) {
+    ImGui_ImplSoftRaster_SetThreadsCount (threads);
+
+    double seconds = 0.0;
+    for (int i = 0; i < frames; i++, time += 1.0 / 60.0) {
+      ImGui_ImplSoftRaster_NewFrame();
+      newFrame (time);
+
+      auto start = std::chrono::steady_clock::now();
+      std::fill (pixels.begin(), pixels.end(), clearColour);
+      ImGui_ImplSoftRaster_RenderDrawData (ImGui::GetDrawData(), pixels.data(), width, height, width);
+      seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      }
+
+    printf ("threads %2d %7.3f ms/frame\n", threads, seconds * 1000.0 / frames);
+    if (threads == maxThreads)
+      break;
+    }
+
+  // same again through ImDrawDataMerger, merge pass included in the timing
+  double mergeSeconds = 0.0;
+  double mergedSeconds = 0.0;
+  for (int i = 0; i < frames; i++, time += 1.0 / 60.0) {
+    ImGui_ImplSoftRaster_NewFrame();
+    newFrame (time);
+
+    auto start = std::chrono::steady_clock::now();
+    ImDrawData* mergedDrawData = drawDataMerger.Merge (ImGui::GetDrawData());
+    auto merged = std::chrono::steady_clock::now();
+    std::fill (pixels.begin(), pixels.end(), clearColour);
+    ImGui_ImplSoftRaster_RenderDrawData (mergedDrawData, pixels.data(), width, height, width);
+    mergeSeconds += std::chrono::duration<double>(merged - start).count();
+    mergedSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+  printf ("threads %2d %7.3f ms/frame merged, merge %.3f ms, %d draw calls %d merged\n",
+          maxThreads, mergedSeconds * 1000.0 / frames, mergeSeconds * 1000.0 / frames, drawDataMerger.CmdCountIn, drawDataMerger.CmdCountOut);
+
+  // same again with damage tracking, only the damage rects are cleared + redrawn, the imgui compare runs in ImGui::Render
+  io.ConfigDamageTracking = true;
+  double damagedSeconds = 0.0;
+  double damagedArea = 0.0;
+  for (int i = 0; i < frames; i++, time += 1.0 / 60.0) {
+    ImGui_ImplSoftRaster_NewFrame();
+    newFrame (time);
+
+    ImDrawData* damagedDrawData = ImGui::GetDrawData();
+    for (int n = 0; n < damagedDrawData->DamageRectsCount; n++) {
+      const ImVec4& r = damagedDrawData->DamageRects[n];
+      damagedArea += (r.z - r.x) * (r.w - r.y);
+      }
+    if (!damagedDrawData->HasDamageRects)
+      damagedArea += (double)width * height;
+
+    auto start = std::chrono::steady_clock::now();
+    ImGui_ImplSoftRaster_RenderDrawDataDamaged (damagedDrawData, pixels.data(), width, height, width, clearColour);
+    damagedSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+  io.ConfigDamageTracking = false;
+  printf ("threads %2d %7.3f ms/frame damaged, %.1f%% of the frame\n",
+          maxThreads, damagedSeconds * 1000.0 / frames, damagedArea * 100.0 / ((double)width * height * frames));
+
+  if (ppmFileName) {
+    if (writePpm (ppmFileName, pixels, width, height))
+      printf ("wrote %s\n", ppmFileName);
+    else
+      printf ("failed to write %s\n", ppmFileName);
+    }
+
+  drawDataMerger.ClearFreeMemory();
+  ImGui_ImplSoftRaster_Shutdown();
+  ImPlot::DestroyContext();
+  ImGui::DestroyContext();
+  return 0;
+  }
@@ -0,0 +1,602 @@
+// cDrawCapture.cpp - ImDrawData capture to file, async writer thread, and reader for replay
+//{{{  includes
+#ifdef _WIN32
+  #define _CRT_SECURE_NO_WARNINGS
+#endif
+
+#include "cDrawCapture.h"
+
+#include <cstring>
+#include <algorithm>
+
+#include "imgui.h"
+
+using namespace std;
+//}}}
+
+namespace {
+  const char kMagic[4] = { 'I','M','D','C' };
+  const uint32_t kVersion = 1;
+
+  const uint8_t kRecordAtlas = 'A';
+  const uint8_t kRecordFrame = 'F';
+
+  const uint8_t kFrameKey = 0x01;
+
+  const uint8_t kCmdDraw = 0;
+  const uint8_t kCmdResetRenderState = 1;
+  const uint8_t kCmdUserCallback = 2;
+
+  // literal run ends at this many zero bytes, shorter zero runs are cheaper kept in the literal
+  const size_t kMinZeroRun = 4;
+
+  //{{{
+  void putU32 (vector<uint8_t>& buf, uint32_t value) {
+
+    for (int i = 0; i < 4; i++)
+      buf.push_back ((value >> (i * 8)) & 0xFF);
+    }
+  //}}}
+  //{{{
+  void putFloat (vector<uint8_t>& buf, float value) {
+
+    uint32_t bits;
+    memcpy (&bits, &value, 4);
+    putU32 (buf, bits);
+    }
+  //}}}
+  //{{{
+  void putVarint (vector<uint8_t>& buf, uint64_t value) {
+
+    while (value >= 0x80) {
+      buf.push_back ((uint8_t)(value | 0x80));
+      value >>= 7;
+      }
+    buf.push_back ((uint8_t)value);
+    }
+  //}}}
+  //{{{
+  void putXorZeroRuns (vector<uint8_t>& buf, const uint8_t* data, size_t size, const vector<uint8_t>& base) {
+  // data xor base, base shorter than data xors with zero
+  // - (zero run length, literal length, literal bytes) until size is covered
+
+    const size_t baseSize = min (base.size(), size);
+    auto byteAt = [&](size_t i) { return (uint8_t)(data[i] ^ ((i < baseSize) ? base[i] : 0)); };
+
+    size_t i = 0;
+    while (i < size) {
+      size_t zeros = 0;
+      while ((i + zeros < size) && (byteAt (i + zeros) == 0))
+        zeros++;
+      i += zeros;
+
+      // literal up to next long zero run
+      size_t literalEnd = i;
+      size_t zeroRun = 0;
+      while (literalEnd < size) {
+        if (byteAt (literalEnd) == 0) {
+          if (++zeroRun == kMinZeroRun) {
+            literalEnd -= kMinZeroRun - 1;
+            break;
+            }
+          }
+        else
+          zeroRun = 0;
+        literalEnd++;
+        }
+      if (literalEnd == size)
+        literalEnd -= zeroRun;
+
+      putVarint (buf, zeros);
+      putVarint (buf, literalEnd - i);
+      for (; i < literalEnd; i++)
+        buf.push_back (byteAt (i));
+
+      // trailing zeros, next loop takes them as a run
+      }
+    }
+  //}}}
+
+  //{{{
+  class cDecoder {
+  public:
+    cDecoder (const uint8_t* data, size_t size) : mData(data), mEnd(data + size) {}
+
+    bool isOk() const { return mOk; }
+    bool isEnd() const { return mData >= mEnd; }
+
+    //{{{
+    uint8_t getU8() {
+      if (mData + 1 > mEnd) { mOk = false; return 0; }
+      return *mData++;
+      }
+    //}}}
+    //{{{
+    uint32_t getU32() {
+
+      if (mData + 4 > mEnd) { mOk = false; return 0; }
+
+      uint32_t value = mData[0] | (mData[1] << 8) | (mData[2] << 16) | ((uint32_t)mData[3] << 24);
+      mData += 4;
+      return value;
+      }
+    //}}}
+    //{{{
+    float getFloat() {
+
+      uint32_t bits = getU32();
+      float value;
+      memcpy (&value, &bits, 4);
+      return value;
+      }
+    //}}}
+    //{{{
+    uint64_t getVarint() {
+
+      uint64_t value = 0;
+      for (int shift = 0; shift < 64; shift += 7) {
+        if (mData >= mEnd) { mOk = false; return 0; }
+        uint8_t byte = *mData++;
+        value |= (uint64_t)(byte & 0x7F) << shift;
+        if (!(byte & 0x80))
+          return value;
+        }
+
+      mOk = false;
+      return 0;
+      }
+    //}}}
+    //{{{
+    bool getXorZeroRuns (uint8_t* out, size_t size, const vector<uint8_t>& base) {
+
+      size_t i = 0;
+      while (i < size) {
+        size_t zeros = (size_t)getVarint();
+        size_t literal = (size_t)getVarint();
+        if (!mOk || (zeros > size - i) || (literal > size - i - zeros) || (literal > (size_t)(mEnd - mData)))
+          return mOk = false;
+
+        memset (out + i, 0, zeros);
+        i += zeros;
+        memcpy (out + i, mData, literal);
+        mData += literal;
+        i += literal;
+        }
+
+      const size_t baseSize = min (base.size(), size);
+      for (size_t j = 0; j < baseSize; j++)
+        out[j] ^= base[j];
+      return true;
+      }
+    //}}}
+
+  private:
+    const uint8_t* mData;
+    const uint8_t* mEnd;
+    bool mOk = true;
+    };
+  //}}}
+  }
+
+// cDrawCapture
+//{{{
+bool cDrawCapture::start (const string& fileName, size_t maxQueueBytes) {
+
+  stop();
+
+  mFile = fopen (fileName.c_str(), "wb");
+  if (!mFile)
+    return false;
+
+  vector<uint8_t> header (kMagic, kMagic + 4);
+  putU32 (header, kVersion);
+  putU32 (header, sizeof(ImDrawVert));
+  putU32 (header, sizeof(ImDrawIdx));
+  fwrite (header.data(), 1, header.size(), mFile);
+
+  mMaxQueueBytes = maxQueueBytes;
+  mPrevVtx.clear();
+  mPrevIdx.clear();
+  mKeyFrame = true;
+  mAtlasTexId = 0;
+  mAtlasWidth = 0;
+  mAtlasHeight = 0;
+
+  mFrames = 0;
+  mDroppedFrames = 0;
+  mRawBytes = 0;
+  mWrittenBytes = header.size();
+
+  mExit = false;
+  mThread = thread ([this]() { writerThread(); });
+  return true;
+  }
+//}}}
+//{{{
+void cDrawCapture::stop() {
+// flushes queued frames before closing
+
+  if (!mFile)
+    return;
+
+  {
+  lock_guard<mutex> lock (mMutex);
+  mExit = true;
+  }
+  mCond.notify_one();
+  mThread.join();
+
+  fclose (mFile);
+  mFile = nullptr;
+  }
+//}}}
+
+//{{{
+void cDrawCapture::captureFrame (const ImDrawData* drawData) {
+
+  if (!mFile || !drawData || !drawData->Valid)
+    return;
+
+  {
+  // writer behind, drop the frame rather than stall, delta chain restarts with a keyframe
+  lock_guard<mutex> lock (mMutex);
+  if (mQueueBytes > mMaxQueueBytes) {
+    mDroppedFrames++;
+    mKeyFrame = true;
+    return;
+    }
+  }
+
+  ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+  if (((uint64_t)(intptr_t)atlas->TexID != mAtlasTexId) || (atlas->TexWidth != mAtlasWidth) || (atlas->TexHeight != mAtlasHeight)) {
+    vector<uint8_t> atlasRecord;
+    encodeAtlas (atlasRecord);
+    queueRecord (atlasRecord);
+    }
+
+  if (mKeyFrame) {
+    mPrevVtx.clear();
+    mPrevIdx.clear();
+    }
+
+  vector<uint8_t> record;
+  record.reserve (4096);
+  record.push_back (kRecordFrame);
+  putU32 (record, 0);
+
+  record.push_back (mKeyFrame ? kFrameKey : 0);
+  putFloat (record, drawData->DisplayPos.x);
+  putFloat (record, drawData->DisplayPos.y);
+  putFloat (record, drawData->DisplaySize.x);
+  putFloat (record, drawData->DisplaySize.y);
+  putFloat (record, drawData->FramebufferScale.x);
+  putFloat (record, drawData->FramebufferScale.y);
+  putVarint (record, drawData->CmdListsCount);
+
+  if ((int)mPrevVtx.size() < drawData->CmdListsCount) {
+    mPrevVtx.resize (drawData->CmdListsCount);
+    mPrevIdx.resize (drawData->CmdListsCount);
+    }
+
+  uint64_t rawBytes = 0;
+  for (int i = 0; i < drawData->CmdListsCount; i++) {
+    const ImDrawList* drawList = drawData->CmdLists[i];
+    putVarint (record, drawList->VtxBuffer.Size);
+    putVarint (record, drawList->IdxBuffer.Size);
+    putVarint (record, drawList->CmdBuffer.Size);
+    #ifdef IMGUI_USE_COMPACT_DRAWVERT
+      putFloat (record, drawList->VtxOrigin.x);
+      putFloat (record, drawList->VtxOrigin.y);
+    #endif
+
+    for (int cmd = 0; cmd < drawList->CmdBuffer.Size; cmd++) {
+      const ImDrawCmd& drawCmd = drawList->CmdBuffer[cmd];
+      putFloat (record, drawCmd.ClipRect.x);
+      putFloat (record, drawCmd.ClipRect.y);
+      putFloat (record, drawCmd.ClipRect.z);
+      putFloat (record, drawCmd.ClipRect.w);
+      putVarint (record, (uint64_t)(intptr_t)drawCmd.TextureId);
+      putVarint (record, drawCmd.VtxOffset);
+      putVarint (record, drawCmd.IdxOffset);
+      putVarint (record, drawCmd.ElemCount);
+      record.push_back (!drawCmd.UserCallback ? kCmdDraw :
+                          (drawCmd.UserCallback == ImDrawCallback_ResetRenderState) ? kCmdResetRenderState : kCmdUserCallback);
+      }
+
+    const uint8_t* vtx = (const uint8_t*)drawList->VtxBuffer.Data;
+    const uint8_t* idx = (const uint8_t*)drawList->IdxBuffer.Data;
+    const size_t vtxBytes = drawList->VtxBuffer.size_in_bytes();
+    const size_t idxBytes = drawList->IdxBuffer.size_in_bytes();
+    putXorZeroRuns (record, vtx, vtxBytes, mPrevVtx[i]);
+    putXorZeroRuns (record, idx, idxBytes, mPrevIdx[i]);
+    mPrevVtx[i].assign (vtx, vtx + vtxBytes);
+    mPrevIdx[i].assign (idx, idx + idxBytes);
+
+    rawBytes += vtxBytes + idxBytes + drawList->CmdBuffer.size_in_bytes();
+    }
+
+  mKeyFrame = false;
+  mFrames++;
+  mRawBytes += rawBytes;
+  queueRecord (record);
+  }
+//}}}
+
+// cDrawCapture private
+//{{{
+void cDrawCapture::encodeAtlas (vector<uint8_t>& record) {
+
+  ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+  mAtlasTexId = (uint64_t)(intptr_t)atlas->TexID;
+  mAtlasWidth = atlas->TexWidth;
+  mAtlasHeight = atlas->TexHeight;
+
+  // RGBA32 as the backends upload it, expand alpha8 if that's all the atlas kept
+  vector<uint8_t> pixels;
+  if (atlas->TexPixelsRGBA32)
+    pixels.assign ((const uint8_t*)atlas->TexPixelsRGBA32, (const uint8_t*)atlas->TexPixelsRGBA32 + mAtlasWidth * mAtlasHeight * 4);
+  else if (atlas->TexPixelsAlpha8) {
+    pixels.resize (mAtlasWidth * mAtlasHeight * 4);
+    for (int i = 0; i < mAtlasWidth * mAtlasHeight; i++) {
+      uint32_t pixel = IM_COL32(255, 255, 255, atlas->TexPixelsAlpha8[i]);
+      memcpy (&pixels[i * 4], &pixel, 4);
+      }
+    }
+
+  record.push_back (kRecordAtlas);
+  putU32 (record, 0);
+  putVarint (record, mAtlasTexId);
+  putVarint (record, pixels.empty() ? 0 : mAtlasWidth);
+  putVarint (record, pixels.empty() ? 0 : mAtlasHeight);
+  putXorZeroRuns (record, pixels.data(), pixels.size(), vector<uint8_t>());
+  }
+//}}}
+//{{{
+void cDrawCapture::queueRecord (vector<uint8_t>& record) {
+// patch payload size, hand over to writer thread
+
+  uint32_t payloadSize = (uint32_t)(record.size() - 5);
+  for (int i = 0; i < 4; i++)
+    record[1 + i] = (payloadSize >> (i * 8)) & 0xFF;
+
+  {
+  lock_guard<mutex> lock (mMutex);
+  mQueueBytes += record.size();
+  mQueue.push_back (move (record));
+  }
+  mCond.notify_one();
+  }
+//}}}
+//{{{
+void cDrawCapture::writerThread() {
+
+  unique_lock<mutex> lock (mMutex);
+  while (true) {
+    mCond.wait (lock, [this]() { return mExit || !mQueue.empty(); });
+    if (mQueue.empty() && mExit)
+      break;
+
+    vector<uint8_t> record = move (mQueue.front());
+    mQueue.pop_front();
+
+    lock.unlock();
+    fwrite (record.data(), 1, record.size(), mFile);
+    mWrittenBytes += record.size();
+    lock.lock();
+
+    mQueueBytes -= record.size();
+    }
+
+  fflush (mFile);
+  }
+//}}}
+
+// cDrawCaptureReader
+//{{{
+bool cDrawCaptureReader::load (const string& fileName) {
+
+  clear();
+
+  FILE* file = fopen (fileName.c_str(), "rb");
+  if (!file) {
+    mError = "can't open " + fileName;
+    return false;
+    }
+
+  vector<uint8_t> bytes;
+  uint8_t chunk[65536];
+  size_t bytesRead;
+  while ((bytesRead = fread (chunk, 1, sizeof(chunk), file)) > 0)
+    bytes.insert (bytes.end(), chunk, chunk + bytesRead);
+  fclose (file);
+
+  cDecoder decoder (bytes.data(), bytes.size());
+  if ((bytes.size() < 16) || memcmp (bytes.data(), kMagic, 4)) {
+    mError = fileName + " not a capture";
+    return false;
+    }
+  decoder.getU32();
+  if (decoder.getU32() != kVersion) {
+    mError = fileName + " unknown version";
+    return false;
+    }
+  if ((decoder.getU32() != sizeof(ImDrawVert)) || (decoder.getU32() != sizeof(ImDrawIdx))) {
+    mError = fileName + " ImDrawVert or ImDrawIdx size differs from this build";
+    return false;
+    }
+
+  size_t offset = 16;
+  while (offset + 5 <= bytes.size()) {
+    uint8_t type = bytes[offset];
+    uint32_t payloadSize = bytes[offset+1] | (bytes[offset+2] << 8) | (bytes[offset+3] << 16) | ((uint32_t)bytes[offset+4] << 24);
+    offset += 5;
+    if (payloadSize > bytes.size() - offset) {
+      // truncated last record, capture killed mid write, keep what decoded
+      break;
+      }
+
+    bool ok = (type == kRecordAtlas) ? decodeAtlas (bytes.data() + offset, payloadSize) :
+              (type == kRecordFrame) ? decodeFrame (bytes.data() + offset, payloadSize) : true;
+    if (!ok) {
+      mError = fileName + " corrupt record";
+      return false;
+      }
+    offset += payloadSize;
+    }
+
+  mPrevVtx.clear();
+  mPrevIdx.clear();
+  return true;
+  }
+//}}}
+//{{{
+void cDrawCaptureReader::clear() {
+
+  for (auto& frame : mFrames) {
+    for (auto drawList : frame.mDrawLists)
+      IM_DELETE (drawList);
+    IM_DELETE (frame.mDrawData);
+    }
+
+  mFrames.clear();
+  mPrevVtx.clear();
+  mPrevIdx.clear();
+  mAtlasPixels.clear();
+  mAtlasWidth = 0;
+  mAtlasHeight = 0;
+  mError.clear();
+  }
+//}}}
+//{{{
+void cDrawCaptureReader::setTextureId (void* textureId) {
+
+  for (auto& frame : mFrames)
+    for (auto drawList : frame.mDrawLists)
+      for (int cmd = 0; cmd < drawList->CmdBuffer.Size; cmd++)
+        drawList->CmdBuffer[cmd].TextureId = (ImTextureID)textureId;
+  }
+//}}}
+
+// cDrawCaptureReader private
+//{{{
+bool cDrawCaptureReader::decodeAtlas (const uint8_t* data, size_t size) {
+
+  cDecoder decoder (data, size);
+  decoder.getVarint();
+  int width = (int)decoder.getVarint();
+  int height = (int)decoder.getVarint();
+  if (!decoder.isOk() || (width < 0) || (height < 0) || ((size_t)width * height > (1u << 28)))
+    return false;
+
+  vector<uint32_t> pixels (width * height);
+  if (!decoder.getXorZeroRuns ((uint8_t*)pixels.data(), pixels.size() * 4, vector<uint8_t>()))
+    return false;
+
+  // atlas with no pixels, texture already released by the app, keep the previous snapshot
+  if (width && height) {
+    mAtlasPixels = move (pixels);
+    mAtlasWidth = width;
+    mAtlasHeight = height;
+    }
+
+  return true;
+  }
+//}}}
+//{{{
+bool cDrawCaptureReader::decodeFrame (const uint8_t* data, size_t size) {
+
+  cDecoder decoder (data, size);
+
+  cFrame frame;
+  frame.mDrawData = IM_NEW(ImDrawData)();
+  ImDrawData* drawData = frame.mDrawData;
+
+  uint8_t flags = decoder.getU8();
+  if (flags & kFrameKey) {
+    mPrevVtx.clear();
+    mPrevIdx.clear();
+    }
+
+  drawData->Valid = true;
+  drawData->DisplayPos.x = decoder.getFloat();
+  drawData->DisplayPos.y = decoder.getFloat();
+  drawData->DisplaySize.x = decoder.getFloat();
+  drawData->DisplaySize.y = decoder.getFloat();
+  drawData->FramebufferScale.x = decoder.getFloat();
+  drawData->FramebufferScale.y = decoder.getFloat();
+  drawData->OwnerViewport = ImGui::GetMainViewport();
+
+  size_t numDrawLists = (size_t)decoder.getVarint();
+  if (!decoder.isOk() || (numDrawLists > size)) {
+    IM_DELETE (drawData);
+    return false;
+    }
+  if (mPrevVtx.size() < numDrawLists) {
+    mPrevVtx.resize (numDrawLists);
+    mPrevIdx.resize (numDrawLists);
+    }
+
+  bool ok = true;
+  for (size_t i = 0; ok && (i < numDrawLists); i++) {
+    ImDrawList* drawList = IM_NEW(ImDrawList)(ImGui::GetDrawListSharedData());
+    frame.mDrawLists.push_back (drawList);
+
+    int numVtx = (int)decoder.getVarint();
+    int numIdx = (int)decoder.getVarint();
+    int numCmds = (int)decoder.getVarint();
+    #ifdef IMGUI_USE_COMPACT_DRAWVERT
+      drawList->VtxOrigin.x = decoder.getFloat();
+      drawList->VtxOrigin.y = decoder.getFloat();
+    #endif
+    if (!decoder.isOk() || (numVtx < 0) || (numIdx < 0) || (numCmds < 0) || ((size_t)numCmds > size)) {
+      ok = false;
+      break;
+      }
+
+    for (int cmd = 0; cmd < numCmds; cmd++) {
+      ImDrawCmd drawCmd;
+      drawCmd.ClipRect.x = decoder.getFloat();
+      drawCmd.ClipRect.y = decoder.getFloat();
+      drawCmd.ClipRect.z = decoder.getFloat();
+      drawCmd.ClipRect.w = decoder.getFloat();
+      drawCmd.TextureId = (ImTextureID)(intptr_t)decoder.getVarint();
+      drawCmd.VtxOffset = (unsigned int)decoder.getVarint();
+      drawCmd.IdxOffset = (unsigned int)decoder.getVarint();
+      drawCmd.ElemCount = (unsigned int)decoder.getVarint();
+      uint8_t type = decoder.getU8();
+      if (type == kCmdResetRenderState)
+        drawCmd.UserCallback = ImDrawCallback_ResetRenderState;
+
+      // app callbacks can't be replayed, skip them
+      if (type != kCmdUserCallback)
+        drawList->CmdBuffer.push_back (drawCmd);
+      }
+
+    drawList->VtxBuffer.resize (numVtx);
+    drawList->IdxBuffer.resize (numIdx);
+    if (!decoder.getXorZeroRuns ((uint8_t*)drawList->VtxBuffer.Data, drawList->VtxBuffer.size_in_bytes(), mPrevVtx[i]) ||
+        !decoder.getXorZeroRuns ((uint8_t*)drawList->IdxBuffer.Data, drawList->IdxBuffer.size_in_bytes(), mPrevIdx[i])) {
+      ok = false;
+      break;
+      }
+    mPrevVtx[i].assign ((const uint8_t*)drawList->VtxBuffer.Data, (const uint8_t*)drawList->VtxBuffer.Data + drawList->VtxBuffer.size_in_bytes());
+    mPrevIdx[i].assign ((const uint8_t*)drawList->IdxBuffer.Data, (const uint8_t*)drawList->IdxBuffer.Data + drawList->IdxBuffer.size_in_bytes());
+
+    drawData->TotalVtxCount += numVtx;
+    drawData->TotalIdxCount += numIdx;
+    }
+
+  if (ok) {
+    // ImDrawData points at the drawLists vector storage, stable once the frame is complete
+    drawData->CmdListsCount = (int)frame.mDrawLists.size();
+    drawData->CmdLists = frame.mDrawLists.data();
+    mFrames.push_back (move (frame));
+    return true;
+    }
+
+  for (auto drawList : frame.mDrawLists)
+    IM_DELETE (drawList);
+  IM_DELETE (drawData);
+  return false;
+  }
+//}}}
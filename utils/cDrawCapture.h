@@ -0,0 +1,117 @@
+// cDrawCapture.h - ImDrawData capture to file for backend benchmarking, and reader for replay
+// - cDrawCapture::captureFrame (ImGui::GetDrawData()) after ImGui::Render
+//   encodes on the calling thread, a writer thread streams to disk
+//   queue over maxQueueBytes drops frames rather than stall the app, next frame is then a keyframe
+// - file, "IMDC" version sizeof(ImDrawVert) sizeof(ImDrawIdx), then records
+//   type u8, payload size u32, payload
+//   'A' font atlas snapshot, written at start and when the atlas texture changes
+//   'F' frame, display pos/size/scale, per drawList cmds + vertex/index bytes
+//       vertex/index bytes xor previous frame same drawList index, zero runs + literals, varint counts
+// - cDrawCaptureReader decodes a whole capture into ImDrawData, ready to feed a backend in a tight loop
+//{{{  includes
+#pragma once
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <deque>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+
+struct ImDrawData;
+struct ImDrawList;
+//}}}
+
+class cDrawCapture {
+public:
+  cDrawCapture() = default;
+  ~cDrawCapture() { stop(); }
+
+  bool start (const std::string& fileName, size_t maxQueueBytes = 64 * 1024 * 1024);
+  void stop();
+
+  void captureFrame (const ImDrawData* drawData);
+
+  // gets
+  bool isCapturing() const { return mFile != nullptr; }
+  uint64_t getFrames() const { return mFrames; }
+  uint64_t getDroppedFrames() const { return mDroppedFrames; }
+  uint64_t getRawBytes() const { return mRawBytes; }
+  uint64_t getWrittenBytes() const { return mWrittenBytes; }
+
+private:
+  void encodeAtlas (std::vector<uint8_t>& record);
+  void queueRecord (std::vector<uint8_t>& record);
+  void writerThread();
+
+  FILE* mFile = nullptr;
+  size_t mMaxQueueBytes = 0;
+
+  // delta base, previous frame bytes per drawList index
+  std::vector<std::vector<uint8_t>> mPrevVtx;
+  std::vector<std::vector<uint8_t>> mPrevIdx;
+  bool mKeyFrame = true;
+
+  uint64_t mAtlasTexId = 0;
+  int mAtlasWidth = 0;
+  int mAtlasHeight = 0;
+
+  // writer thread
+  std::thread mThread;
+  std::mutex mMutex;
+  std::condition_variable mCond;
+  std::deque<std::vector<uint8_t>> mQueue;
+  size_t mQueueBytes = 0;
+  bool mExit = false;
+
+  // stats
+  std::atomic<uint64_t> mFrames = { 0 };
+  std::atomic<uint64_t> mDroppedFrames = { 0 };
+  std::atomic<uint64_t> mRawBytes = { 0 };
+  std::atomic<uint64_t> mWrittenBytes = { 0 };
+  };
+
+class cDrawCaptureReader {
+public:
+  cDrawCaptureReader() = default;
+  ~cDrawCaptureReader() { clear(); }
+
+  bool load (const std::string& fileName);
+  void clear();
+
+  // gets
+  const std::string& getError() const { return mError; }
+  size_t getNumFrames() const { return mFrames.size(); }
+  ImDrawData* getFrame (size_t frame) { return mFrames[frame].mDrawData; }
+
+  // last atlas snapshot, RGBA32 as ImFontAtlas::GetTexDataAsRGBA32
+  const std::vector<uint32_t>& getAtlasPixels() const { return mAtlasPixels; }
+  int getAtlasWidth() const { return mAtlasWidth; }
+  int getAtlasHeight() const { return mAtlasHeight; }
+
+  // captured texture ids mean nothing to the replay backend, point every cmd at one of its textures
+  void setTextureId (void* textureId);
+
+private:
+  //{{{
+  struct cFrame {
+    ImDrawData* mDrawData;
+    std::vector<ImDrawList*> mDrawLists;
+    };
+  //}}}
+
+  bool decodeAtlas (const uint8_t* data, size_t size);
+  bool decodeFrame (const uint8_t* data, size_t size);
+
+  std::string mError;
+  std::vector<cFrame> mFrames;
+
+  std::vector<std::vector<uint8_t>> mPrevVtx;
+  std::vector<std::vector<uint8_t>> mPrevIdx;
+
+  std::vector<uint32_t> mAtlasPixels;
+  int mAtlasWidth = 0;
+  int mAtlasHeight = 0;
+  };
@@ -0,0 +1,270 @@
+// cIdleLoop.h - idle aware main loop helper, header only
+// - getWaitTimeout() says how long the platform event wait can block before the next frame
+//   0 means poll, keep running frames, >0 means glfwWaitEventsTimeout/SDL_WaitEventTimeout
+// - isDrawDataChanged() after ImGui::Render hashes the produced ImDrawData with ImHashData64,
+//   backend render + swap can be skipped when it matches the previous frame
+//   with io.ConfigDamageTracking imgui has already compared them, its damage rects are used instead
+// - setDirty() from any thread when app data changes, wake() function kicks the blocked wait
+// - ui that changes every frame, fps readouts, running clocks, never goes idle, show them on hover
+//
+// usage, glfw:
+//   cIdleLoop idleLoop;
+//   idleLoop.setWakeFunc (glfwPostEmptyEvent);
+//   while (!glfwWindowShouldClose (window)) {
+//     idleLoop.waitEvents (glfwPollEvents, glfwWaitEventsTimeout);
+//     ... NewFrame, ui, ImGui::Render()
+//     if (idleLoop.isDrawDataChanged()) {
+//       ... RenderDrawData, swap
+//       }
+//     }
+//{{{  includes
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <atomic>
+#include <chrono>
+
+#include "imgui.h"
+#include "imgui_internal.h"
+//}}}
+
+class cIdleLoop {
+public:
+  cIdleLoop (double idleTimeout = 1.0) : mIdleTimeout(idleTimeout) {}
+  ~cIdleLoop() = default;
+
+  // gets
+  bool getEnabled() const { return mEnabled; }
+  double getIdleTimeout() const { return mIdleTimeout; }
+
+  uint64_t getFrames() const { return mFrames; }
+  uint64_t getRenders() const { return mRenders; }
+  uint64_t getWaits() const { return mWaits; }
+  double getWaitSeconds() const { return mWaitSeconds; }
+  //{{{
+  double getWaitTimeout() {
+  // how long platform event wait can block before next frame, 0 = poll
+
+    if (!mEnabled || (ImGui::GetCurrentContext() == nullptr))
+      return 0.0;
+
+    // user declared dirty data, or keepAwake timer running
+    if (mDirty.exchange (false) || (now() < mAwakeUntil))
+      return 0.0;
+
+    // frame output still changing, layout, scrolling, window appearing can take a few frames to settle
+    if (mSettleFrames > 0)
+      return 0.0;
+
+    ImGuiContext& g = *GImGui;
+    ImGuiIO& io = g.IO;
+
+    // mouse held, dragging, sliders, nav windowing, drag and drop
+    if (g.ActiveId || g.DragDropActive || g.NavWindowingTarget || g.MovingWindow)
+      return 0.0;
+    for (int i = 0; i < IM_ARRAYSIZE (io.MouseDown); i++)
+      if (io.MouseDown[i])
+        return 0.0;
+
+    // unprocessed input
+    if (io.InputQueueCharacters.Size > 0)
+      return 0.0;
+
+    double timeout = mIdleTimeout;
+
+    // text cursor blink, wake on the blink phase
+    if (io.WantTextInput && io.ConfigInputTextCursorBlink)
+      timeout = ImMin (timeout, kBlinkTimeout);
+
+    // pending hover tooltip delays
+    if (g.HoveredId && (g.HoveredIdTimer < kHoverDelay))
+      timeout = ImMin (timeout, (double)(kHoverDelay - g.HoveredIdTimer));
+
+    return timeout;
+    }
+  //}}}
+
+  // sets
+  void setEnabled (bool enabled) { mEnabled = enabled; }
+  void setIdleTimeout (double idleTimeout) { mIdleTimeout = idleTimeout; }
+  void setWakeFunc (void (*wakeFunc)()) { mWakeFunc = wakeFunc; }
+
+  //{{{
+  void setDirty() {
+  // app data changed, safe from any thread, wakes blocked wait if wakeFunc set
+
+    mDirty = true;
+    if (mWakeFunc)
+      mWakeFunc();
+    }
+  //}}}
+  //{{{
+  void keepAwake (double seconds) {
+  // run frames for seconds, app animations, timers
+
+    mAwakeUntil = ImMax (mAwakeUntil, now() + seconds);
+    }
+  //}}}
+
+  //{{{
+  template <typename tPoll, typename tWait> void waitEvents (tPoll poll, tWait waitTimeout) {
+  // glfw style, poll() or waitTimeout (seconds)
+
+    double timeout = getWaitTimeout();
+    if (timeout > 0.0) {
+      double waitStart = now();
+      waitTimeout (timeout);
+      mWaitSeconds += now() - waitStart;
+      mWaits++;
+      }
+    else
+      poll();
+    }
+  //}}}
+  //{{{
+  template <typename tEvent, typename tPoll, typename tWait> bool waitEvent (tEvent* event, tPoll poll, tWait waitTimeout) {
+  // SDL style, first event of frame, poll (event) or waitTimeout (event, milliseconds)
+  // - carry on with poll (event) for the rest
+
+    double timeout = getWaitTimeout();
+    if (timeout > 0.0) {
+      double waitStart = now();
+      bool gotEvent = waitTimeout (event, (int)(timeout * 1000.0) + 1) != 0;
+      mWaitSeconds += now() - waitStart;
+      mWaits++;
+      return gotEvent;
+      }
+
+    return poll (event) != 0;
+    }
+  //}}}
+
+  //{{{
+  bool isDrawDataChanged() {
+  // call after ImGui::Render, hash all viewport drawData against last frame, true if must render + swap
+
+    mFrames++;
+
+    uint64_t hash = kHashSeed;
+    bool hasCallback = false;
+    bool damaged = false;
+    const bool damageTracking = ImGui::GetIO().ConfigDamageTracking;
+
+    ImGuiPlatformIO& platformIO = ImGui::GetPlatformIO();
+    if (platformIO.Viewports.Size > 0) {
+      for (int i = 0; i < platformIO.Viewports.Size; i++)
+        if (platformIO.Viewports[i]->DrawData) {
+          if (damageTracking)
+            damaged |= isDamaged (platformIO.Viewports[i]->DrawData);
+          else
+            hash = hashDrawData (platformIO.Viewports[i]->DrawData, hash, hasCallback);
+          }
+      }
+    else if (ImGui::GetDrawData()) {
+      if (damageTracking)
+        damaged |= isDamaged (ImGui::GetDrawData());
+      else
+        hash = hashDrawData (ImGui::GetDrawData(), hash, hasCallback);
+      }
+
+    // user callbacks can draw anything, never skip them, damage tracking always counts them as damaged
+    bool changed = !mEnabled || hasCallback || damaged || mForce || (!damageTracking && (hash != mLastHash)) || (mFrames == 1);
+    mLastHash = hash;
+    mForced = mForce;
+    mForce = false;
+
+    if (changed) {
+      mSettleFrames = kSettleFrames;
+      mRenders++;
+      }
+    else if (mSettleFrames > 0)
+      mSettleFrames--;
+
+    return changed;
+    }
+  //}}}
+  //{{{
+  void forceRender() {
+  // next frame renders regardless of hash, swapchain rebuilt, context lost, window exposed
+
+    mLastHash = 0;
+    mForce = true;
+    }
+  //}}}
+  //{{{
+  bool wasForced() const {
+  // last isDrawDataChanged was forced, back buffer contents unknown, render everything, not just the damage
+
+    return mForced;
+    }
+  //}}}
+
+private:
+  static constexpr double kBlinkTimeout = 0.1;
+  static constexpr float kHoverDelay = 1.0f;
+  static constexpr int kSettleFrames = 3;
+  static constexpr uint64_t kHashSeed = 0xcbf29ce484222325ull;
+
+  //{{{
+  static double now() {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+  //}}}
+  //{{{
+  static bool isDamaged (const ImDrawData* drawData) {
+  // damage rects from io.ConfigDamageTracking, no damage rects yet means a first frame
+
+    return !drawData->HasDamageRects || (drawData->DamageRectsCount > 0);
+    }
+  //}}}
+  //{{{
+  static uint64_t hashDrawData (const ImDrawData* drawData, uint64_t hash, bool& hasCallback) {
+  // same ImHashData64 as the damage tracker and remote backend, every field that changes what the backend draws
+
+    hash = ImHashData64 (&drawData->DisplayPos, sizeof(ImVec2), hash);
+    hash = ImHashData64 (&drawData->DisplaySize, sizeof(ImVec2), hash);
+    hash = ImHashData64 (&drawData->FramebufferScale, sizeof(ImVec2), hash);
+    hash = ImHashData64 (&drawData->CmdListsCount, sizeof(int), hash);
+
+    for (int i = 0; i < drawData->CmdListsCount; i++) {
+      const ImDrawList* drawList = drawData->CmdLists[i];
+      hash = ImHashData64 (&drawList->CmdBuffer.Size, sizeof(int), hash);
+      for (int cmd = 0; cmd < drawList->CmdBuffer.Size; cmd++) {
+        const ImDrawCmd& drawCmd = drawList->CmdBuffer[cmd];
+        hasCallback |= (drawCmd.UserCallback != nullptr);
+        hash = ImHashData64 (&drawCmd.ClipRect, sizeof(ImVec4), hash);
+        hash = ImHashData64 (&drawCmd.TextureId, sizeof(ImTextureID), hash);
+        hash = ImHashData64 (&drawCmd.VtxOffset, sizeof(unsigned int), hash);
+        hash = ImHashData64 (&drawCmd.IdxOffset, sizeof(unsigned int), hash);
+        hash = ImHashData64 (&drawCmd.ElemCount, sizeof(unsigned int), hash);
+        }
+      hash = ImHashData64 (drawList->VtxBuffer.Data, drawList->VtxBuffer.size_in_bytes(), hash);
+      #ifdef IMGUI_USE_COMPACT_DRAWVERT
+        // compact vertices are relative to the list origin, moving it alone moves everything
+        hash = ImHashData64 (&drawList->VtxOrigin, sizeof(drawList->VtxOrigin), hash);
+      #endif
+      hash = ImHashData64 (drawList->IdxBuffer.Data, drawList->IdxBuffer.size_in_bytes(), hash);
+      }
+
+    return hash;
+    }
+  //}}}
+
+  // vars
+  bool mEnabled = true;
+  double mIdleTimeout = 1.0;
+  void (*mWakeFunc)() = nullptr;
+
+  std::atomic<bool> mDirty = { false };
+  double mAwakeUntil = 0.0;
+
+  uint64_t mLastHash = 0;
+  bool mForce = false;
+  bool mForced = false;
+  int mSettleFrames = kSettleFrames;
+
+  uint64_t mFrames = 0;
+  uint64_t mRenders = 0;
+  uint64_t mWaits = 0;
+  double mWaitSeconds = 0.0;
+  };
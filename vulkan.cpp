@@ -14,6 +14,7 @@
 #include "imgui.h"
 #include "imgui_impl_glfw.h"
 #include "imgui_impl_vulkan.h"
+#include "utils/cIdleLoop.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -68,6 +69,12 @@ static void glfwErrorCallback (int error, const char* description) {
   }
 //}}}
 //{{{
+static void glfwRefreshCallback (GLFWwindow* window) {
+// window exposed or uncovered, its contents may be lost, render even if the frame is unchanged
+  ((cIdleLoop*)glfwGetWindowUserPointer (window))->forceRender();
+  }
+//}}}
+//{{{
 static void checkVkResult (VkResult result) {
 
   if (result == 0)
@@ -548,9 +555,15 @@ int main (int, char**) {
   bool show_another_window = false;
   ImVec4 clearColor = ImVec4 (0.45f, 0.55f, 0.60f, 1.00f);
 
+  // block on events when idle, skip render + present when frame unchanged
+  cIdleLoop idleLoop;
+  idleLoop.setWakeFunc (glfwPostEmptyEvent);
+  glfwSetWindowUserPointer (glfwWindow, &idleLoop);
+  glfwSetWindowRefreshCallback (glfwWindow, glfwRefreshCallback);
+
   // Main loop
   while (!glfwWindowShouldClose (glfwWindow)) {
-    glfwPollEvents();
+    idleLoop.waitEvents (glfwPollEvents, glfwWaitEventsTimeout);
 
     // Resize swap chain?
     if (gSwapChainRebuild) {
@@ -564,6 +577,7 @@ int main (int, char**) {
                                                 gAllocator, width, height, gMinImageCount);
         gMainWindowData.FrameIndex = 0;
         gSwapChainRebuild = false;
+        idleLoop.forceRender();
         }
       }
 
@@ -595,7 +609,18 @@ int main (int, char**) {
     ImGui::SameLine();
     ImGui::Text ("counter = %d", counter);
 
-    ImGui::Text ("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / ImGui::GetIO().Framerate, ImGui::GetIO().Framerate);
+    // idle loop only renders when the frame changes, a per frame fps readout would change every frame
+    bool idle = idleLoop.getEnabled();
+    if (ImGui::Checkbox ("idle loop", &idle))
+      idleLoop.setEnabled (idle);
+    if (ImGui::IsItemHovered())
+      ImGui::SetTooltip ("frames:%llu renders:%llu waits:%llu %.1fs", (unsigned long long)idleLoop.getFrames(), (unsigned long long)idleLoop.getRenders(),
+                         (unsigned long long)idleLoop.getWaits(), idleLoop.getWaitSeconds());
+    // experimental, off by default, idle loop skips render + present when nothing is damaged
+    // - render pass clears every swapchain image, no buffer age, so no partial redraw
+    ImGui::Checkbox ("damage tracking", &ImGui::GetIO().ConfigDamageTracking);
+    if (!idle)
+      ImGui::Text ("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / ImGui::GetIO().Framerate, ImGui::GetIO().Framerate);
     ImGui::End();
     }
     //}}}
@@ -612,22 +637,25 @@ int main (int, char**) {
     // Rendering
     ImGui::Render();
     ImDrawData* drawData = ImGui::GetDrawData();
+    // minimized main window skips only its own draw, platform windows still render
     const bool minimized = (drawData->DisplaySize.x <= 0.0f || drawData->DisplaySize.y <= 0.0f);
+    const bool render = idleLoop.isDrawDataChanged();
     vulkanWindow->ClearValue.color.float32[0] = clearColor.x * clearColor.w;
     vulkanWindow->ClearValue.color.float32[1] = clearColor.y * clearColor.w;
     vulkanWindow->ClearValue.color.float32[2] = clearColor.z * clearColor.w;
     vulkanWindow->ClearValue.color.float32[3] = clearColor.w;
-    if (!minimized)
+    if (render && !minimized)
       renderDrawData (vulkanWindow, drawData);
 
     #ifdef DOCKING
       if (ImGui::GetIO().ConfigFlags & ImGuiConfigFlags_ViewportsEnable) {
         ImGui::UpdatePlatformWindows();
-        ImGui::RenderPlatformWindowsDefault();
+        if (render)
+          ImGui::RenderPlatformWindowsDefault();
         }
     #endif
 
-    if (!minimized)
+    if (render && !minimized)
       present (vulkanWindow);
     }
 